@@ -0,0 +1,204 @@
+import argparse
+import struct
+import sys
+
+from PIL import Image, ImageSequence
+
+# LMA1 container, see include/anim_codec.h for the layout
+MAGIC = b"LMA1"
+HEADER = struct.Struct("<4sHHHHI")
+FRAME_HEADER = struct.Struct("<BBHI")
+
+FRAME_KEY = 0
+FRAME_DELTA = 1
+
+OP_SKIP = 0
+OP_FILL = 1
+OP_COPY = 2
+OP_SHIFT = 6
+OP_MAX_COUNT = 64
+
+# Size of the anim partition in partitions.csv
+PARTITION_SIZE = 0xF0000
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Encode images or GIFs into an LMA1 animation for the anim partition. "
+        "Flash the result with: parttool.py write_partition --partition-name anim --input <file>"
+    )
+
+    parser.add_argument(
+        "inputs",
+        nargs="+",
+        help="Frames in order. Animated GIFs contribute all of their frames",
+    )
+
+    parser.add_argument(
+        "-o",
+        "--output",
+        type=str,
+        required=True,
+        help="Path of the animation file to write",
+    )
+
+    parser.add_argument(
+        "--width",
+        type=int,
+        required=True,
+        help="Panel width in pixels (display columns)",
+    )
+
+    parser.add_argument(
+        "--height",
+        type=int,
+        required=True,
+        help="Panel height in pixels (display rows)",
+    )
+
+    parser.add_argument(
+        "-d",
+        "--duration",
+        type=int,
+        default=None,
+        help="Milliseconds per frame (default: the GIF's own timing, or 100)",
+    )
+
+    parser.add_argument(
+        "-k",
+        "--keyframe-interval",
+        type=int,
+        default=0,
+        help="Force a keyframe every N frames (default: 0, only the first)",
+    )
+
+    return parser.parse_args()
+
+
+def load_frames(paths, width, height, duration):
+    """Returns a list of (pixels, duration_ms), pixels a list of (r, g, b) tuples."""
+    frames = []
+    for path in paths:
+        with Image.open(path) as image:
+            for frame in ImageSequence.Iterator(image):
+                ms = duration if duration is not None else frame.info.get("duration", 100)
+                rgb = frame.convert("RGB").resize((width, height), Image.NEAREST).tobytes()
+                pixels = [tuple(rgb[i:i + 3]) for i in range(0, len(rgb), 3)]
+                frames.append((pixels, max(0, min(ms, 0xFFFF))))
+    return frames
+
+
+def encode_ops(pixels, previous):
+    """Op bytes for a frame. With previous=None it is a keyframe and covers every pixel."""
+    ops = bytearray()
+    count = len(pixels)
+    i = 0
+    while i < count:
+        # Unchanged pixels cost one byte per 64
+        if previous is not None and pixels[i] == previous[i]:
+            run = 1
+            while i + run < count and run < OP_MAX_COUNT and pixels[i + run] == previous[i + run]:
+                run += 1
+            if i + run == count:
+                break  # Trailing pixels are left as they are anyway
+            ops.append((OP_SKIP << OP_SHIFT) | (run - 1))
+            i += run
+            continue
+
+        # Repeated colours
+        run = 1
+        while i + run < count and run < OP_MAX_COUNT and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            ops.append((OP_FILL << OP_SHIFT) | (run - 1))
+            ops += bytes(pixels[i])
+            i += run
+            continue
+
+        # Literals, up to the next repeat or unchanged pixel
+        run = 1
+        while i + run < count and run < OP_MAX_COUNT:
+            j = i + run
+            if previous is not None and pixels[j] == previous[j]:
+                break
+            if j + 1 < count and pixels[j + 1] == pixels[j]:
+                break
+            run += 1
+        ops.append((OP_COPY << OP_SHIFT) | (run - 1))
+        for pixel in pixels[i:i + run]:
+            ops += bytes(pixel)
+        i += run
+    return bytes(ops)
+
+
+def encode(frames, width, height, keyframe_interval):
+    body = bytearray()
+    previous = None
+    for index, (pixels, duration) in enumerate(frames):
+        key = previous is None or (keyframe_interval > 0 and index % keyframe_interval == 0)
+        ops = encode_ops(pixels, None if key else previous)
+        if not key:
+            # A delta that is no smaller than a keyframe buys nothing
+            key_ops = encode_ops(pixels, None)
+            if len(key_ops) <= len(ops):
+                key, ops = True, key_ops
+        body += FRAME_HEADER.pack(FRAME_KEY if key else FRAME_DELTA, 0, duration, len(ops))
+        body += ops
+        previous = pixels
+    header = HEADER.pack(MAGIC, width, height, len(frames), 0, HEADER.size + len(body))
+    return header + body
+
+
+def decode(data):
+    """Mirror of anim_codec_decodeFrame, to check the output before it goes to flash."""
+    magic, width, height, frame_count, _, size = HEADER.unpack_from(data)
+    assert magic == MAGIC and size == len(data)
+    pixels = [None] * (width * height)
+    offset = HEADER.size
+    for _ in range(frame_count):
+        _, _, duration, length = FRAME_HEADER.unpack_from(data, offset)
+        offset += FRAME_HEADER.size
+        end = offset + length
+        i = 0
+        while offset < end:
+            op, count = data[offset] >> OP_SHIFT, (data[offset] & (OP_MAX_COUNT - 1)) + 1
+            offset += 1
+            if op == OP_FILL:
+                pixels[i:i + count] = [tuple(data[offset:offset + 3])] * count
+                offset += 3
+            elif op == OP_COPY:
+                for n in range(count):
+                    pixels[i + n] = tuple(data[offset:offset + 3])
+                    offset += 3
+            i += count
+        yield list(pixels), duration
+
+
+def main():
+    args = parse_args()
+
+    frames = load_frames(args.inputs, args.width, args.height, args.duration)
+    if not frames:
+        sys.exit("No frames to encode")
+    if len(frames) > 0xFFFF:
+        sys.exit(f"Too many frames: {len(frames)}")
+
+    data = encode(frames, args.width, args.height, args.keyframe_interval)
+
+    # Round trip before writing anything
+    for index, (decoded, original) in enumerate(zip(decode(data), frames)):
+        if decoded != original:
+            sys.exit(f"Frame {index} does not decode back to the original")
+
+    if len(data) > PARTITION_SIZE:
+        sys.exit(f"Animation is {len(data)} bytes, the anim partition holds {PARTITION_SIZE}")
+
+    with open(args.output, "wb") as output_file:
+        output_file.write(data)
+
+    raw = len(frames) * args.width * args.height * 3
+    print(f"{len(frames)} frames, {len(data)} bytes ({100 * len(data) / raw:.1f}% of raw RGB)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// LMA1 animation container, made by anim_encoder.py and played straight out of
+// memory-mapped flash. Multi-byte fields are little-endian.
+//
+// Header, 16 bytes:
+//   0-3   magic        "LMA1"
+//   4-5   width        Pixels, the panel resolution it was made for
+//   6-7   height
+//   8-9   frame_count
+//   10-11 reserved     0
+//   12-15 size         Bytes in the whole container, header included
+//
+// Then frame_count frames, each an 8 byte header followed by its ops:
+//   0     type         ANIM_FRAME_KEY or ANIM_FRAME_DELTA
+//   1     reserved     0
+//   2-3   duration     Milliseconds to show the frame for
+//   4-7   length       Bytes of ops that follow
+//
+// Ops walk the frame's pixels in row-major order from the top-left. Each starts
+// with a byte holding the op in its top 2 bits and count - 1 (1-64 pixels) below:
+//   SKIP  Leave count pixels as they are in the previous frame
+//   FILL  Followed by R, G, B: count pixels of that colour
+//   COPY  Followed by count R, G, B triples
+// Pixels after the last op are left as they are. A keyframe covers every pixel
+// without SKIPs, so playback can start on it; the first frame is always one.
+//
+// Plain C with no ESP-IDF dependencies, so it builds and runs on a host as well.
+
+#define ANIM_MAGIC "LMA1"
+#define ANIM_HEADER_SIZE 16
+#define ANIM_FRAME_HEADER_SIZE 8
+
+#define ANIM_OP_SKIP 0
+#define ANIM_OP_FILL 1
+#define ANIM_OP_COPY 2
+#define ANIM_OP_SHIFT 6
+#define ANIM_OP_COUNT_MASK 0x3F
+#define ANIM_OP_MAX_COUNT 64
+
+#define ANIM_BYTES_PER_PIXEL 3
+
+typedef enum
+{
+    ANIM_FRAME_KEY = 0,   // Every pixel set, does not depend on the previous frame
+    ANIM_FRAME_DELTA = 1, // Changes against the previous frame
+} anim_codec_frameType_E;
+
+typedef enum
+{
+    ANIM_OK = 0,
+    ANIM_END,             // No frames left, anim_codec_rewind to play it again
+    ANIM_ERR_MAGIC,       // Not an LMA1 container (an erased partition reads as 0xFF)
+    ANIM_ERR_TRUNCATED,   // A header or frame runs past the end of the data
+    ANIM_ERR_CORRUPT,     // Bad op, frame type or pixel count
+} anim_codec_result_E;
+
+typedef struct
+{
+    uint16_t width;
+    uint16_t height;
+    uint16_t frame_count;
+    uint32_t size;
+} anim_codec_header_t;
+
+// Playback position in a container. Holds no pixels; frames are decoded into the caller's
+typedef struct
+{
+    const uint8_t* data;
+    anim_codec_header_t header;
+    uint32_t next;        // Offset of the next frame
+    uint16_t frame;       // Index of the next frame
+} anim_codec_t;
+
+// Read the container header, e.g. to find out how much flash to map
+anim_codec_result_E anim_codec_readHeader(const uint8_t* data, size_t size, anim_codec_header_t* header);
+// Start playing the container at data. size may run past the end of the container
+anim_codec_result_E anim_codec_open(anim_codec_t* anim, const uint8_t* data, size_t size);
+// Back to the first frame, a keyframe
+void anim_codec_rewind(anim_codec_t* anim);
+// Decode the next frame into pixels (width * height, 0xRRGGBB). Pixels a delta frame
+// leaves as they are come from previous, or stay as they are in pixels if it is NULL,
+// so a keyframe never reads previous. On error the frame may be partly written
+anim_codec_result_E anim_codec_decodeFrame(anim_codec_t* anim, uint32_t* pixels, const uint32_t* previous,
+                                           uint32_t* duration_ms);
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "app_manager.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Loops the LMA1 animation (see anim_codec.h) stored in the "anim" data partition
+// on the background layer. Frames are decoded from memory-mapped flash straight
+// into the display buffer; flash it with anim_encoder.py
+
+#define ANIM_PLAYER_PARTITION "anim"
+
+bool anim_player_init(void);
+void anim_player_task(void* pvParameter);
+esp_err_t anim_player_app_register(void);
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// DDP (Distributed Display Protocol, as sent by xLights, WLED and friends) over UDP.
+// Every packet starts with a 10 byte header, multi-byte fields big-endian:
+//
+//   0     flags     0x40 version 1, 0x10 timecode, 0x08 storage, 0x04 reply,
+//                   0x02 query, 0x01 push (last packet of a frame: show it)
+//   1     sequence  Low 4 bits, 1-15 and wrapping. 0 means unsequenced
+//   2     type      Pixel format, 0x0B (RGB, 8 bits each) or 0 (undefined, RGB assumed)
+//   3     id        Destination, 1 is the display
+//   4-7   offset    Byte offset of the payload within the frame
+//   8-9   length    Payload bytes
+//   10-13 timecode  Only present with the timecode flag, ignored
+//
+// The frame is R, G, B bytes per pixel, row-major from the top-left of the display.
+// A frame can span several packets; all of them carry the same sequence number.
+//
+// Plain C with no ESP-IDF dependencies, so it builds and runs on a host as well.
+
+#define DDP_PORT 4048
+#define DDP_HEADER_SIZE 10
+#define DDP_TIMECODE_SIZE 4
+
+#define DDP_FLAG_VERSION_MASK 0xC0
+#define DDP_FLAG_VERSION_1 0x40
+#define DDP_FLAG_TIMECODE 0x10
+#define DDP_FLAG_STORAGE 0x08
+#define DDP_FLAG_REPLY 0x04
+#define DDP_FLAG_QUERY 0x02
+#define DDP_FLAG_PUSH 0x01
+
+#define DDP_SEQUENCE_MASK 0x0F
+#define DDP_TYPE_UNDEFINED 0x00
+#define DDP_TYPE_RGB24 0x0B
+#define DDP_ID_DISPLAY 1
+
+#define DDP_BYTES_PER_PIXEL 3
+
+typedef enum
+{
+    DDP_OK = 0,
+    DDP_ERR_SHORT,        // Shorter than its header or declared payload
+    DDP_ERR_VERSION,      // Not DDP version 1
+    DDP_ERR_UNSUPPORTED,  // Query, reply, other destination or pixel format
+} ddp_result_E;
+
+typedef struct
+{
+    uint8_t flags;
+    uint8_t sequence;
+    uint8_t type;
+    uint8_t id;
+    uint32_t offset;
+    uint16_t length;
+    const uint8_t* data;  // Points into the packet
+} ddp_packet_t;
+
+typedef enum
+{
+    DDP_FRAME_PARTIAL = 0, // Pixels written, more to come
+    DDP_FRAME_COMPLETE,    // Push flag seen, the frame is ready to show
+    DDP_FRAME_LATE,        // Belongs to a frame that was already shown or replaced, dropped
+} ddp_frame_E;
+
+// Assembles packets into a caller-owned pixel array, without staging copies
+typedef struct
+{
+    uint32_t* pixels;      // 0xRRGGBB per pixel, written in place. May be swapped between frames
+    uint32_t num_pixels;
+    // The last frame shown, when pixels does not hold it (e.g. a canvas from two frames
+    // back). Bytes a frame does not send are taken from here, so pixels needs no copy
+    // of it up front and senders of whole frames cost no copying at all. NULL keeps
+    // whatever pixels holds
+    const uint32_t* previous;
+    uint8_t sequence;      // Frame being assembled, 0 before the first sequenced packet
+    bool shown;            // That frame was pushed; stragglers with its sequence are late
+    uint32_t written;      // Bytes of the frame in place from its start
+    uint32_t frames;       // Frames completed
+    uint32_t late;         // Packets dropped as late
+    uint32_t kept;         // Bytes taken from previous
+} ddp_frame_t;
+
+ddp_result_E ddp_parse(const uint8_t* packet, size_t len, ddp_packet_t* out);
+
+void ddp_frame_init(ddp_frame_t* frame, uint32_t* pixels, uint32_t num_pixels);
+// Forget the sequence, e.g. after the sender has been quiet long enough to restart
+void ddp_frame_reset(ddp_frame_t* frame);
+// Write a parsed packet's pixels. Payload past the end of the frame is ignored
+ddp_frame_E ddp_frame_apply(ddp_frame_t* frame, const ddp_packet_t* packet);
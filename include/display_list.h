@@ -0,0 +1,113 @@
+#pragma once
+
+#include "display_manager.h"
+#include "fonts.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Retained drawing. Instead of writing pixels, an app records what its buffer shows
+// as a short list of commands and submits it. The display task replays the list into
+// the buffer before composing, and only when its contents changed: submitting the
+// same commands again costs a hash and nothing else.
+//
+// A list is the buffer's whole content; replay starts from a transparent buffer.
+// Only the area the last list drew on is cleared for it, and only that area and
+// the new list's are marked dirty.
+// Lists trade three command slots the way double-buffered canvases trade pixels:
+// the app records into one, the latest submitted one waits in another and the
+// display task replays from the third.
+
+#ifndef DISPLAY_LIST_MAX_COMMANDS
+#define DISPLAY_LIST_MAX_COMMANDS 32
+#endif
+
+#define DISPLAY_LIST_SLOTS 3
+#define DISPLAY_LIST_FRESH 0x80   // Set in ready while it holds a list the display task has not taken
+
+typedef enum
+{
+    DISPLAY_LIST_CHAR = 0,  // graphics_drawChar
+    DISPLAY_LIST_RECT,      // graphics_fillRect
+    DISPLAY_LIST_LINE,      // graphics_drawLine
+    DISPLAY_LIST_BLIT,      // graphics_blit
+} displayList_op_E;
+
+typedef struct
+{
+    uint8_t op;             // displayList_op_E
+    uint8_t font;           // CHAR: font_size_E
+    char c;                 // CHAR
+    int16_t x;
+    int16_t y;
+    int16_t a;              // RECT, BLIT: width. LINE: x of the other end
+    int16_t b;              // RECT, BLIT: height. LINE: y of the other end
+    int16_t src_x;          // BLIT
+    int16_t src_y;
+    uint32_t color;
+    const displayManager_buffer_t* src; // BLIT, by reference (see display_list_invalidate)
+} displayList_command_t;
+
+// Inclusive area of the buffer, empty while x0 > x1
+typedef struct
+{
+    int32_t x0;
+    int32_t y0;
+    int32_t x1;
+    int32_t y1;
+} displayList_bounds_t;
+
+typedef struct displayList
+{
+    displayManager_buffer_t* buffer;
+    displayList_command_t commands[DISPLAY_LIST_SLOTS][DISPLAY_LIST_MAX_COMMANDS];
+    uint32_t count[DISPLAY_LIST_SLOTS];
+    uint32_t hash[DISPLAY_LIST_SLOTS];
+    bool force[DISPLAY_LIST_SLOTS];     // Replay even if the hash matches
+
+    // App side
+    uint32_t record;         // Slot being recorded
+    uint32_t submitted_hash; // Last list handed over
+    bool submitted;
+    bool invalidated;
+    bool overflowed;         // Commands were dropped from the list being recorded
+
+    uint32_t ready;          // Slot index, | DISPLAY_LIST_FRESH once submitted
+
+    // Display task side
+    uint32_t drawn;          // Slot last replayed
+    uint32_t drawn_hash;
+    bool has_drawn;
+    displayList_bounds_t drawn_bounds; // Area the last replay drew on, all of it at first
+
+    uint32_t submits;        // Lists handed over
+    uint32_t unchanged;      // Submits skipped because nothing changed
+    uint32_t replays;        // Lists rasterized into the buffer
+} displayList_t;
+
+// Give a buffer a display list. The buffer's pixels then belong to the display task;
+// draw through the list only. Not for double-buffered buffers, which lists replace
+displayList_t* display_list_create(displayManager_buffer_t* buffer);
+
+// Start recording the next list
+void display_list_begin(displayList_t* list);
+// Each returns false, and drops the command, once the list is full or if a coordinate
+// or size does not fit the commands' int16_t fields
+bool display_list_char(displayList_t* list, int32_t x, int32_t y, char c, font_size_E font, uint32_t color);
+bool display_list_rect(displayList_t* list, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color);
+bool display_list_line(displayList_t* list, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+bool display_list_blit(displayList_t* list, int32_t x, int32_t y,
+                       const displayManager_buffer_t* src, int32_t src_x, int32_t src_y,
+                       int32_t width, int32_t height);
+// Hand the recorded list to the display task. Returns false, without handing anything
+// over, if it is the same as the last one submitted
+bool display_list_submit(displayList_t* list);
+// Replay the next submitted list even if it is unchanged, e.g. because a blit source's
+// pixels changed
+void display_list_invalidate(displayList_t* list);
+
+// Display task: replay the latest submitted list into the buffer if it changed.
+// Returns true if the buffer was redrawn
+bool display_list_rasterize(displayList_t* list);
+// Display task: release a list along with its buffer
+void display_list_destroy(displayList_t* list);
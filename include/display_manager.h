@@ -2,8 +2,11 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "esp_err.h"
 
+// Default geometry for units without rows/cols in genealogy. The actual size is
+// only known after display_manager_init
 #ifndef NEOPIXEL_NUM_ROWS
 #define NEOPIXEL_NUM_ROWS (8)
 #endif
@@ -12,12 +15,37 @@
 #define NEOPIXEL_NUM_COLS (32)
 #endif
 
-#define DISPLAY_WIDTH NEOPIXEL_NUM_COLS
-#define DISPLAY_HEIGHT NEOPIXEL_NUM_ROWS
+// Largest rows * cols a stored geometry may have. The neopixel library keeps two I2S
+// frames of WS2182B_BYTES_PER_PIXEL (9) bytes per LED, and at 2.6 Mbps a 1024-LED frame
+// takes 28 ms to send, within a frame period at 30 fps
+#ifndef DISPLAY_MANAGER_MAX_PIXELS
+#define DISPLAY_MANAGER_MAX_PIXELS 1024
+#endif
+
+#define DISPLAY_WIDTH display_manager_getWidth()
+#define DISPLAY_HEIGHT display_manager_getHeight()
 
 
 #define MAX_DISPLAY_BUFFERS 8
 
+// Buffer pixels come from a pool of chunks, each one full-screen RGB888 buffer rounded
+// up to a power of two. Chunks are split into blocks of DISPLAY_MANAGER_POOL_MIN_BLOCK
+// bytes and up, so compact and small buffers share one. Chunks are taken from the heap
+// as needed, up to this many, and kept
+#ifndef DISPLAY_MANAGER_POOL_CHUNKS
+#define DISPLAY_MANAGER_POOL_CHUNKS MAX_DISPLAY_BUFFERS
+#endif
+#define DISPLAY_MANAGER_POOL_MIN_BLOCK 64
+
+// Composition runs at up to this rate while something changes and idles otherwise.
+// Override per build, e.g. -D DISPLAY_MANAGER_MAX_FPS=60
+#ifndef DISPLAY_MANAGER_MAX_FPS
+#define DISPLAY_MANAGER_MAX_FPS 30
+#endif
+#define DISPLAY_MANAGER_FRAME_PERIOD_MS (1000 / DISPLAY_MANAGER_MAX_FPS)
+#define DISPLAY_MANAGER_IDLE_POLL_MS 100  // Potentiometer poll while the display is idle
+#define DISPLAY_MANAGER_MAX_WAITERS 8      // Tasks that can block in display_manager_waitFrames at once
+
 typedef enum
 {
     DISPLAY_ROTATION_0 = 0,
@@ -26,6 +54,14 @@ typedef enum
     DISPLAY_ROTATION_270 = 3,
 } displayManager_rotation_E;
 
+// How the LED strip snakes through the panel, starting at LED 0 in the panel's
+// native top-left corner
+typedef enum
+{
+    DISPLAY_WIRING_ROW_SERPENTINE = 0,    // Along a row, back along the next one
+    DISPLAY_WIRING_COLUMN_SERPENTINE = 1, // Down a column, back up the next one
+} displayManager_wiring_E;
+
 typedef enum
 {
     DISPLAY_MANAGER_LAYER_BACKGROUND = 0,
@@ -34,34 +70,190 @@ typedef enum
     DISPLAY_MANAGER_LAYER_SYSTEM = 3,
 } displayManager_layer_E;
 
+// How a buffer stores its pixels. Compact formats are expanded while compositing
+typedef enum
+{
+    DISPLAY_FORMAT_RGB888 = 0,   // uint32_t 0xRRGGBB, TRANSPARENT marks unset pixels
+    DISPLAY_FORMAT_RGB565 = 1,   // uint16_t, green LSB is the opaque bit (0x0000 is transparent)
+    DISPLAY_FORMAT_INDEXED8 = 2, // One palette index per byte
+    DISPLAY_FORMAT_INDEXED4 = 3, // Two palette indexes per byte, even x in the high nibble
+} displayManager_format_E;
+
+#define DISPLAY_PALETTE_TRANSPARENT_INDEX 0 // palette[0] is always TRANSPARENT
+
+#define DISPLAY_CANVAS_COUNT 3      // Draw, ready and front canvases of a double-buffered buffer
+#define DISPLAY_CANVAS_FRESH 0x80   // Set in ready while it holds a canvas the compositor has not shown
+
 typedef struct
 {
-    uint32_t* buffer;
-    uint32_t width;
+    union {
+        uint32_t* buffer;   // DISPLAY_FORMAT_RGB888
+        uint16_t* buffer16; // DISPLAY_FORMAT_RGB565
+        uint8_t* buffer8;   // DISPLAY_FORMAT_INDEXED8/4
+    };
+    displayManager_format_E format;
+    uint32_t stride;     // Bytes per row
+    uint32_t* palette;   // Indexed formats only
+    uint32_t palette_size;
+    uint32_t palette_used; // Entries handed out so far, including the transparent one
+    uint32_t width;      // Canvas size, which may be larger than the display
     uint32_t height;
     uint32_t x;          // X position on display
     uint32_t y;          // Y position on display
-    displayManager_layer_E layer;
+    uint32_t view_width; // Part of the canvas shown on screen (see display_manager_setBufferView)
+    uint32_t view_height;
+    int32_t scroll_x;    // Canvas coordinates of the view's top-left corner
+    int32_t scroll_y;
+    bool wrap;           // The view wraps around the canvas edges instead of showing nothing past them
+    displayManager_layer_E layer; // Change with display_manager_setBufferOrder
+    uint8_t order;       // Stacking within the layer, higher is in front
     bool active;
     uint8_t opacity;     // 0-255 for transparency
+    bool pixel_alpha;    // Pixels are 0xAARRGGBB instead of RGB with the TRANSPARENT sentinel
     const char* owner;   // Name of the app that owns this buffer
+
+    // Managed by the display manager
+    bool dirty;          // Pixels changed since the last composition
+    uint32_t dirty_x0;   // Inclusive dirty rectangle, in buffer coordinates
+    uint32_t dirty_y0;
+    uint32_t dirty_x1;
+    uint32_t dirty_y1;
+    uint8_t* storage;    // Pixel (and palette) block from the buffer pool
+    size_t storage_size;
+    bool composed_active; // active/position/view as of the last composition
+    uint32_t composed_x;
+    uint32_t composed_y;
+    uint32_t composed_view_width;
+    uint32_t composed_view_height;
+    int32_t composed_scroll_x;
+    int32_t composed_scroll_y;
+    bool composed_wrap;
+
+    // Double buffering (see display_manager_enableDoubleBuffer). The app owns
+    // canvas[draw], which buffer/buffer16/buffer8 point at, and the compositor
+    // owns canvas[front]. They trade canvases through ready with atomic exchanges
+    bool double_buffered;
+    uint8_t* canvas[DISPLAY_CANVAS_COUNT];
+    uint32_t draw;
+    uint32_t ready;      // Canvas index, | DISPLAY_CANVAS_FRESH once presented
+    uint32_t front;
+
+    // Retained drawing (see display_list.h): the display task replays the list into the pixels
+    struct displayList* display_list;
 } displayManager_buffer_t;
 
+// Buffer pool usage. Pixels larger than a chunk, or that find the pool full, come from the heap
+typedef struct
+{
+    uint32_t buffers_in_use;
+    uint32_t buffers_high_water;
+    uint32_t pool_bytes_in_use;   // Blocks handed out, rounded up to their power of two
+    uint32_t pool_bytes_high_water;
+    uint32_t chunks;              // Chunks taken from the heap so far
+    uint32_t chunk_limit;
+    uint32_t chunk_size;          // Bytes, one full-screen RGB888 buffer rounded up
+    uint32_t heap_bytes;
+    uint32_t heap_bytes_high_water;
+} displayManager_poolStats_t;
+
 
 
 // Buffer management functions
+// Loads the geometry from genealogy (call genealogy_init first) and sizes every frame buffer.
+// Falls back to the default geometry if the stored one does not fit in memory
 esp_err_t display_manager_init(void);
+uint32_t display_manager_getWidth(void);
+uint32_t display_manager_getHeight(void);
+void display_manager_getGeometry(uint32_t* rows, uint32_t* cols,
+                                 displayManager_wiring_E* wiring,
+                                 displayManager_rotation_E* rotation);
+// Store this unit's panel geometry in genealogy; used from the next boot. rows * cols
+// must not exceed DISPLAY_MANAGER_MAX_PIXELS
+esp_err_t display_manager_saveGeometry(uint32_t rows, uint32_t cols,
+                                       displayManager_wiring_E wiring,
+                                       displayManager_rotation_E rotation);
 displayManager_buffer_t* display_manager_create_buffer(const char* owner_name, 
                                                      uint32_t width, 
                                                      uint32_t height,
                                                      uint32_t x,
                                                      uint32_t y,
                                                      displayManager_layer_E layer);
+displayManager_buffer_t* display_manager_create_buffer_ex(const char* owner_name,
+                                                        uint32_t width,
+                                                        uint32_t height,
+                                                        uint32_t x,
+                                                        uint32_t y,
+                                                        displayManager_layer_E layer,
+                                                        displayManager_format_E format);
+// Replace palette entries 1..count of an indexed buffer. Without this, colours
+// passed to display_manager_setBufferPixel are added to the palette as they appear
+esp_err_t display_manager_setBufferPalette(displayManager_buffer_t* buffer,
+                                           const uint32_t* colors,
+                                           uint32_t count);
+// Remove a buffer from the display. Its memory is reused once the current frame is done
 void display_manager_free_buffer(displayManager_buffer_t* buffer);
+void display_manager_getPoolStats(displayManager_poolStats_t* stats);
 void display_manager_setBufferPixel(displayManager_buffer_t* buffer, 
                                           uint32_t x, 
                                           uint32_t y, 
                                           uint32_t color);
+// Fill a rectangle with one colour, clipped to the buffer, and mark it dirty once
+void display_manager_fillBufferRect(displayManager_buffer_t* buffer,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t width, uint32_t height,
+                                    uint32_t color);
+// Copy a width x height block of src at (src_x, src_y) to dst at (x, y), clipped to
+// both. Transparent pixels are copied too; colours are converted if the formats differ
+void display_manager_copyBufferRect(displayManager_buffer_t* dst,
+                                    uint32_t x, uint32_t y,
+                                    const displayManager_buffer_t* src,
+                                    uint32_t src_x, uint32_t src_y,
+                                    uint32_t width, uint32_t height);
+// Flag a region as changed after writing buffer->buffer directly
+void display_manager_markDirty(displayManager_buffer_t* buffer,
+                               uint32_t x,
+                               uint32_t y,
+                               uint32_t width,
+                               uint32_t height);
+// Opt in to double buffering: drawing goes to a back canvas that only reaches
+// the screen, all at once, when display_manager_present is called
+esp_err_t display_manager_enableDoubleBuffer(displayManager_buffer_t* buffer);
+// Publish the back canvas. Drawing continues on a copy of what was presented
+void display_manager_present(displayManager_buffer_t* buffer);
+// Publish the back canvas without the copy, for writers that replace every pixel of a
+// frame. Drawing continues on an older frame. The presented canvas is left as it is
+// until the next present, so the writer can still read unchanged pixels from it
+void display_manager_presentDiscard(displayManager_buffer_t* buffer);
+// Show only a view_width x view_height window of the canvas, at the buffer's x/y.
+// Content is rendered once and the window is moved with display_manager_setBufferScroll
+esp_err_t display_manager_setBufferView(displayManager_buffer_t* buffer,
+                                        uint32_t view_width,
+                                        uint32_t view_height,
+                                        bool wrap);
+// Move the view within the canvas. Takes effect on the next frame without touching any pixels
+void display_manager_setBufferScroll(displayManager_buffer_t* buffer, int32_t scroll_x, int32_t scroll_y);
+void display_manager_setBufferActive(displayManager_buffer_t* buffer, bool active);
+// Move a buffer in the stacking order; later buffers win ties
+void display_manager_setBufferOrder(displayManager_buffer_t* buffer,
+                                    displayManager_layer_E layer,
+                                    uint8_t order);
+void display_manager_setBufferOpacity(displayManager_buffer_t* buffer, uint8_t opacity);
+// Switch an RGB888 buffer to per-pixel alpha; its contents are cleared to fully transparent.
+// Call before display_manager_enableDoubleBuffer
+void display_manager_setBufferPixelAlpha(displayManager_buffer_t* buffer, bool enable);
+// Frames recomposed and sent vs frame periods that sent nothing because nothing changed
+void display_manager_getFrameCounts(uint32_t* composed, uint32_t* skipped);
+
+// Frame ticks so far, counting skipped frames. Ticks keep pace with
+// DISPLAY_MANAGER_MAX_FPS while idle, but are counted when the display task wakes
+uint32_t display_manager_getFrameCount(void);
+// Block the calling task until `frames` more frames have been composed. Uses the
+// task's notification value. Returns false if the display manager is not ticking
+bool display_manager_waitFrames(uint32_t frames);
+// Whole frames in a period, at least one
+uint32_t display_manager_msToFrames(uint32_t ms);
+// Wake the display task, e.g. after handing it work it would otherwise find on the next tick
+void display_manager_wake(void);
 
 // Existing functions
 void display_manager_setRawPixel(uint32_t row, uint32_t col, uint32_t color);
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_timer.h"
+
+// Stages of the frame pipeline, in the order a frame goes through them
+typedef enum
+{
+    FRAME_STATS_POT_SAMPLE = 0,  // Potentiometer read and brightness update
+    FRAME_STATS_COMPOSE,         // merge_buffers
+    FRAME_STATS_MAP,             // Logical to LED order mapping
+    FRAME_STATS_BRIGHTNESS,      // Level map rebuild, only when brightness changed
+    FRAME_STATS_ENCODE,          // neopixel_SetPixel
+    FRAME_STATS_TRANSFER,        // I2S transfer in the neopixel library
+    FRAME_STATS_STAGE_COUNT,
+} frame_stats_stage_E;
+
+// Bucket n counts durations in [2^(n-1), 2^n) us, bucket 0 is under 1 us.
+// The last bucket also takes everything longer (~0.5 s and up)
+#define FRAME_STATS_BUCKETS 20
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t buckets[FRAME_STATS_BUCKETS];
+} frame_stats_histogram_t;
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t avg_us;
+    uint32_t max_us;
+    uint32_t p99_us;    // Upper bound of the bucket holding the 99th percentile
+} frame_stats_summary_t;
+
+void frame_stats_record(frame_stats_stage_E stage, uint32_t duration_us);
+void frame_stats_get(frame_stats_stage_E stage, frame_stats_summary_t* summary);
+const char* frame_stats_stageName(frame_stats_stage_E stage);
+void frame_stats_reset(void);
+// Log a summary line per stage
+void frame_stats_log(void);
+
+// Timestamp to pass to frame_stats_end
+static inline uint32_t frame_stats_begin(void)
+{
+    return (uint32_t)esp_timer_get_time();
+}
+
+// Record the time since frame_stats_begin for a stage
+static inline void frame_stats_end(frame_stats_stage_E stage, uint32_t start)
+{
+    frame_stats_record(stage, (uint32_t)esp_timer_get_time() - start);
+}
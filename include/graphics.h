@@ -4,6 +4,17 @@
 #include "display_manager.h"
 #include "fonts.h"
 
+#define GRAPHICS_MAX_POLYGON_POINTS 16
+// Lines and shapes with an end, corner, centre or radius past this are not drawn,
+// which keeps their clipping and edge math within 64 bits
+#define GRAPHICS_MAX_COORD (1 << 29)
+
+typedef struct
+{
+    int32_t x;
+    int32_t y;
+} graphics_point_t;
+
 // Drawing functions that work with display buffers
 void graphics_drawChar(displayManager_buffer_t* buffer, 
                       uint8_t x, uint8_t y, 
@@ -11,14 +22,80 @@ void graphics_drawChar(displayManager_buffer_t* buffer,
                       font_size_E size, 
                       uint32_t color);
 
+// Shapes are clipped to the buffer once and written a row at a time.
+// Coordinates may lie partly or wholly off the buffer
+
+void graphics_fillRect(displayManager_buffer_t* buffer,
+                       int32_t x, int32_t y,
+                       int32_t width, int32_t height,
+                       uint32_t color);
+
+// One pixel wide outline
+void graphics_drawRect(displayManager_buffer_t* buffer,
+                       int32_t x, int32_t y,
+                       int32_t width, int32_t height,
+                       uint32_t color);
+
+void graphics_drawHLine(displayManager_buffer_t* buffer,
+                        int32_t x, int32_t y,
+                        int32_t length,
+                        uint32_t color);
+
+void graphics_drawVLine(displayManager_buffer_t* buffer,
+                        int32_t x, int32_t y,
+                        int32_t length,
+                        uint32_t color);
+
+// Copy a width x height block of src at (src_x, src_y) into dst at (x, y)
+void graphics_blit(displayManager_buffer_t* dst,
+                   int32_t x, int32_t y,
+                   const displayManager_buffer_t* src,
+                   int32_t src_x, int32_t src_y,
+                   int32_t width, int32_t height);
+
+// Filled, same as graphics_fillRect
 void graphics_drawRectangle(displayManager_buffer_t* buffer,
                           uint8_t x, uint8_t y,
                           uint8_t width, uint8_t height,
                           uint32_t color);
 
+// Clipped to the buffer before it is stepped. Ends must lie within GRAPHICS_MAX_COORD
 void graphics_drawLine(displayManager_buffer_t* buffer,
-                      uint8_t x1, uint8_t y1,
-                      uint8_t x2, uint8_t y2,
+                      int32_t x1, int32_t y1,
+                      int32_t x2, int32_t y2,
                       uint32_t color);
 
-// Add more graphics functions as needed...
\ No newline at end of file
+// Circles, triangles and polygons are rasterized a row at a time with integer math.
+// Filled shapes cover exactly the pixels of their outlines and everything between.
+// Coordinates and radii must lie within GRAPHICS_MAX_COORD
+
+void graphics_drawCircle(displayManager_buffer_t* buffer,
+                         int32_t cx, int32_t cy, int32_t radius,
+                         uint32_t color);
+
+void graphics_fillCircle(displayManager_buffer_t* buffer,
+                         int32_t cx, int32_t cy, int32_t radius,
+                         uint32_t color);
+
+// Edges are the same pixels graphics_drawLine draws between the corners
+void graphics_drawTriangle(displayManager_buffer_t* buffer,
+                           int32_t x1, int32_t y1,
+                           int32_t x2, int32_t y2,
+                           int32_t x3, int32_t y3,
+                           uint32_t color);
+
+void graphics_fillTriangle(displayManager_buffer_t* buffer,
+                           int32_t x1, int32_t y1,
+                           int32_t x2, int32_t y2,
+                           int32_t x3, int32_t y3,
+                           uint32_t color);
+
+// Closed outline through up to GRAPHICS_MAX_POLYGON_POINTS corners
+void graphics_drawPolygon(displayManager_buffer_t* buffer,
+                          const graphics_point_t* points, uint32_t count,
+                          uint32_t color);
+
+// Convex polygons only; anything else is filled out to each row's outermost edges
+void graphics_fillPolygon(displayManager_buffer_t* buffer,
+                          const graphics_point_t* points, uint32_t count,
+                          uint32_t color);
\ No newline at end of file
@@ -2,11 +2,16 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "neopixel.h"
+#include "esp_err.h"
 
+// Number of LEDs on the strip. Call before any task starts: it also sets up the
+// frame buffer, so frames can be submitted before neopixel_task runs
+esp_err_t neopixel_driver_configure(uint32_t leds);
 void neopixel_task(void* pvParameter);
-void neopixel_driver_addToQueue(tNeopixel* pixel, uint32_t pixelCount);
-void neopixel_driver_setRawPixel(tNeopixel* pixel);
+// Publish a whole frame of n RGB values (physical LED order) with a single lock
+void neopixel_driver_submitFrame(const uint32_t* rgb, size_t n);
 void neopixel_driver_fill_matrix(uint32_t rgb);
 void neopixel_driver_setBrightness(float b);
 void neopixel_driver_setPixel(int index, uint32_t color);
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "app_manager.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Frames streamed from a host over UDP (DDP, see ddp.h) shown on the popup layer.
+// The layer appears with the first frame and hides again once the sender goes quiet
+
+#define UDP_STREAM_TIMEOUT_MS 2000   // Hide the stream after this long without a frame
+#define UDP_STREAM_MAX_PACKET 1500   // Largest datagram accepted, one Ethernet MTU
+
+bool udp_stream_init(void);
+void udp_stream_task(void* pvParameter);
+esp_err_t udp_stream_app_register(void);
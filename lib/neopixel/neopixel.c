@@ -10,6 +10,7 @@
 #include "esp_heap_caps.h"
 #include "esp_system.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "driver/i2s_std.h"
 #include "driver/i2s_common.h"
 #include "ws2812b_protocol.h"
@@ -24,18 +25,39 @@ typedef struct sNpContext
    portMUX_TYPE lock;
    SemaphoreHandle_t newData;
    SemaphoreHandle_t dataSent;
+   SemaphoreHandle_t frameDone;
    i2s_chan_handle_t i2s;
    uint32_t pixels;
    bool terminate;
    uint32_t bytesSent;
+   uint32_t lastTransferUs;
 
-   uint8_t *buffer;
+   /* Ping-pong frame buffers. Writers encode into buffer[back] with
+      interrupts enabled, then set 'ready'. The transmit task swaps 'back'
+      under the lock only while 'ready' is set and sends the other buffer, so
+      neither side ever touches the buffer the other one is using */
+   uint8_t *buffer[2];
    uint32_t bufferSize;
+   uint32_t back;
+   bool ready;
+   bool pending;              /* a new level map is waiting for the next neopixel_SetPixel */
+
+   uint32_t *shadow;          /* last RGB value written for each pixel */
+   uint32_t *dirtyGroups[2];  /* per buffer, one bit per WS2812B_GROUP_PIXELS pixels that need re-encoding */
+   uint32_t dirtyWords;
+   uint32_t lastDirty;        /* pixels changed by the most recent neopixel_SetPixel call */
+
+   uint32_t codeMap[256];     /* color value -> serialized bits, with the level map applied */
 }  tNpContext;
 
 static void neopixel_task(void *arg);
 static bool i2s_tx_queue_sent_callback(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx);
-static void setpixel(uint8_t *buffer, uint32_t index, uint32_t rgb);
+static void setpixel(uint8_t *buffer, uint32_t index, uint32_t rgb, const uint32_t *codeMap);
+static void encode_group(uint32_t *out, const uint32_t *rgb, const uint32_t *codeMap);
+static void publish(tNpContext *c);
+static uint8_t *take_frame(tNpContext *c);
+static void encode_dirty(tNpContext *c, uint32_t which);
+static void free_buffers(tNpContext *c);
 
 /* -------------------------------------------------------------------------------------------------------------
  * Exported Functions
@@ -80,13 +102,34 @@ tNeopixelContext *neopixel_Init(uint32_t pixels, int dout_pin)
    portMUX_INITIALIZE(&c->lock);
    c->newData = xSemaphoreCreateBinary();
    c->dataSent = xSemaphoreCreateBinary();
+   c->frameDone = xSemaphoreCreateBinary();
    c->terminate = false;
    c->bytesSent = 0;
 
-   c->buffer = (uint8_t *)malloc(c->bufferSize);
-   memset(c->buffer, 0, c->bufferSize); /* initializes the reset bytes to zero */
-   for(int i = 0; i < c->pixels; ++i)
-      setpixel(c->buffer, i, NP_RGB(0, 0, 0));  /* turn off all pixels */
+   c->dirtyWords = (((c->pixels + WS2812B_GROUP_PIXELS - 1) / WS2812B_GROUP_PIXELS) + 31) / 32;
+   memcpy(c->codeMap, ws2812b_code_map, sizeof(c->codeMap));
+   c->shadow = (uint32_t *)calloc(c->pixels, sizeof(uint32_t)); /* all pixels start off */
+   for(int i = 0; i < 2; ++i)
+   {
+      c->buffer[i] = (uint8_t *)calloc(1, c->bufferSize); /* initializes the reset bytes to zero */
+      c->dirtyGroups[i] = (uint32_t *)malloc(c->dirtyWords * sizeof(uint32_t));
+   }
+   if(NULL == c->shadow || NULL == c->buffer[0] || NULL == c->buffer[1]
+      || NULL == c->dirtyGroups[0] || NULL == c->dirtyGroups[1])
+   {
+      ESP_LOGE(TAG, "Failed to allocate pixel buffers");
+      free_buffers(c);
+      free(c);
+      return NULL;
+   }
+   for(int i = 0; i < 2; ++i)
+   {
+      memset(c->dirtyGroups[i], 0xFF, c->dirtyWords * sizeof(uint32_t));
+      encode_dirty(c, i);  /* turn off all pixels */
+   }
+   c->back = 0;
+   c->ready = false;
+   c->pending = false;
 
    i2s_new_channel(&chan_cfg, &c->i2s, NULL);  /* Tx channel only (no Rx) */
    i2s_channel_init_std_mode(c->i2s, &std_cfg);
@@ -115,32 +158,85 @@ void neopixel_Deinit(tNeopixelContext ctx)
    }
 
    i2s_del_channel(c->i2s);
-   free(c->buffer);
+   vSemaphoreDelete(c->newData);
+   vSemaphoreDelete(c->dataSent);
+   vSemaphoreDelete(c->frameDone);
+   free_buffers(c);
    free(c);
 }
 
-bool neopixel_SetPixel(tNeopixelContext ctx, tNeopixel *pixel, uint32_t pixelCount)
+bool neopixel_SetPixel(tNeopixelContext ctx, const uint32_t *rgb, uint32_t first, uint32_t pixelCount)
 {
    tNpContext *c = (tNpContext*) ctx;
    bool success = true;
+   uint32_t dirty = 0;
 
-   taskENTER_CRITICAL(&c->lock);
+   if(first >= c->pixels || pixelCount > c->pixels - first)
+   {
+      ESP_LOGI(TAG, "Invalid pixel run (%" PRIu32 " + %" PRIu32 ")", first, pixelCount);
+      if(first >= c->pixels)
+         return false;
+      pixelCount = c->pixels - first;
+      success = false;
+   }
+
+   /* Compare against the last values written; only groups holding a changed
+      pixel are re-encoded. The shadow copy is only touched by callers of this
+      function, so the comparison runs outside the critical section */
    for(uint32_t i = 0; i < pixelCount; ++i)
    {
-      tNeopixel *p = &pixel[i];
-      if(p->index >= c->pixels)
+      uint32_t index = first + i;
+      if(c->shadow[index] != rgb[i])
       {
-         ESP_LOGI(TAG, "Invalid pixel (%" PRIu32 ")", p->index);
-         success = false;
+         uint32_t group = index / WS2812B_GROUP_PIXELS;
+         c->shadow[index] = rgb[i];
+         c->dirtyGroups[0][group / 32] |= 1UL << (group % 32);
+         c->dirtyGroups[1][group / 32] |= 1UL << (group % 32);
+         ++dirty;
       }
-      else
-         setpixel(c->buffer, p->index, p->rgb);
    }
-   taskEXIT_CRITICAL(&c->lock);
-   xSemaphoreGive(c->newData);
+   c->lastDirty = dirty;
+   if(0 == dirty && !c->pending)
+      return success;  /* nothing changed, the LEDs already show this frame */
+
+   /* One frame carries both the changed pixels and a new level map */
+   c->pending = false;
+   publish(c);
    return success;
 }
 
+void neopixel_SetLevelMap(tNeopixelContext ctx, const uint8_t *levels)
+{
+   tNpContext *c = (tNpContext*) ctx;
+
+   for(int i = 0; i < 256; ++i)
+      c->codeMap[i] = ws2812b_code_map[(NULL == levels) ? i : levels[i]];
+
+   /* Every encoded pixel is stale now; the next neopixel_SetPixel re-encodes
+      and sends them, so a level change and new pixels go out as one frame */
+   for(int i = 0; i < 2; ++i)
+      memset(c->dirtyGroups[i], 0xFF, c->dirtyWords * sizeof(uint32_t));
+   c->pending = true;
+}
+
+uint32_t neopixel_GetDirtyCount(tNeopixelContext ctx)
+{
+   tNpContext *c = (tNpContext*) ctx;
+   return c->lastDirty;
+}
+
+bool neopixel_WaitFrameDone(tNeopixelContext ctx, uint32_t ticks)
+{
+   tNpContext *c = (tNpContext*) ctx;
+   return xSemaphoreTake(c->frameDone, ticks) == pdTRUE;
+}
+
+uint32_t neopixel_GetLastTransferUs(tNeopixelContext ctx)
+{
+   tNpContext *c = (tNpContext*) ctx;
+   return c->lastTransferUs;
+}
+
 uint32_t neopixel_GetRefreshRate(tNeopixelContext ctx)
 {
    tNpContext *c = (tNpContext*) ctx;
@@ -154,12 +250,13 @@ uint32_t neopixel_GetRefreshRate(tNeopixelContext ctx)
 static IRAM_ATTR bool i2s_tx_queue_sent_callback(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
 {
    tNpContext *c = (tNpContext*)user_ctx;
+   BaseType_t woken = pdFALSE;
    c->bytesSent += event->size;
    if(c->bytesSent >= c->bufferSize)
    {
-      xSemaphoreGive(c->dataSent);
+      xSemaphoreGiveFromISR(c->dataSent, &woken);
    }
-   return false;
+   return woken == pdTRUE;
 }
 
 static void neopixel_task(void *arg)
@@ -168,13 +265,6 @@ static void neopixel_task(void *arg)
    size_t bytesLoaded;
    uint8_t *buffer;
 
-   buffer = (uint8_t *)malloc(c->bufferSize);
-   if(NULL == buffer)
-   {
-      ESP_LOGE(TAG, "[%s] Failed to allocate buffer", __func__);
-      return;
-   }
-
    ESP_LOGD(TAG, "[%s] Started", __func__);
    while(!c->terminate)
    {
@@ -187,12 +277,12 @@ static void neopixel_task(void *arg)
       if(c->terminate)
          continue;
 
-      /* Make a local copy of the current pixel buffer to be sent to the hardware */
-      taskENTER_CRITICAL(&c->lock);
-      memcpy(buffer, c->buffer, c->bufferSize);
-      taskEXIT_CRITICAL(&c->lock);
+      buffer = take_frame(c);
+      if(NULL == buffer)
+         continue;  /* a writer is still encoding; it signals again when done */
 
       c->bytesSent = 0;
+      int64_t start = esp_timer_get_time();
       i2s_channel_preload_data(c->i2s, buffer, c->bufferSize, &bytesLoaded);
       i2s_channel_enable(c->i2s);
       if(bytesLoaded < c->bufferSize)
@@ -202,24 +292,135 @@ static void neopixel_task(void *arg)
       }
       xSemaphoreTake(c->dataSent, portMAX_DELAY); /* Wait for buffer to be transferred to hardware */
       i2s_channel_disable(c->i2s);
+      c->lastTransferUs = (uint32_t)(esp_timer_get_time() - start);
+      xSemaphoreGive(c->frameDone);
    }
    ESP_LOGD(TAG, "[%s] Finished", __func__);
 
-   free(buffer);
    c->terminate = false;
    vTaskDelete(NULL); /* Destroy context */
 }
 
-static void setpixel(uint8_t *buffer, uint32_t index, uint32_t rgb)
+static void setpixel(uint8_t *buffer, uint32_t index, uint32_t rgb, const uint32_t *codeMap)
 {
    uint32_t offset = index * WS2182B_BYTES_PER_PIXEL;
-   const uint8_t *sequence = ws2812b_color_map[NP_RGB2GREEN(rgb)];
+   uint32_t codes[WS2182B_COLORS_PER_PIXEL] = {
+      codeMap[NP_RGB2GREEN(rgb)], codeMap[NP_RGB2RED(rgb)], codeMap[NP_RGB2BLUE(rgb)]
+   };
    for(int i = 0; i < WS2182B_BYTES_PER_PIXEL; ++i, ++offset)
    {
-      if(i == 3)
-         sequence = ws2812b_color_map[NP_RGB2RED(rgb)];
-      if(i == 6)
-         sequence = ws2812b_color_map[NP_RGB2BLUE(rgb)];
-      buffer[offset ^ 1] = sequence[i % WS2182B_BYTES_PER_COLOR];  /* Fill buffer in 16-bit little-endian format */
+      uint32_t code = codes[i / WS2182B_BYTES_PER_COLOR];
+      uint32_t shift = 8 * (WS2182B_BYTES_PER_COLOR - 1 - (i % WS2182B_BYTES_PER_COLOR));
+      buffer[offset ^ 1] = (uint8_t)(code >> shift);  /* Fill buffer in 16-bit little-endian format */
    }
-}
\ No newline at end of file
+}
+
+#define I2S_SWAP16(w) (((w) << 16) | ((w) >> 16))
+
+/* Encode WS2812B_GROUP_PIXELS pixels into WS2812B_GROUP_WORDS words. The twelve
+   24-bit color codes are concatenated into the serialized stream (G,R,B per
+   pixel) and cut into big-endian words; rotating each word by 16 produces the
+   same 16-bit little-endian byte order that setpixel() writes one byte at a time. */
+static void encode_group(uint32_t *out, const uint32_t *rgb, const uint32_t *codeMap)
+{
+   uint32_t g0 = codeMap[NP_RGB2GREEN(rgb[0])];
+   uint32_t r0 = codeMap[NP_RGB2RED(rgb[0])];
+   uint32_t b0 = codeMap[NP_RGB2BLUE(rgb[0])];
+   uint32_t g1 = codeMap[NP_RGB2GREEN(rgb[1])];
+   uint32_t r1 = codeMap[NP_RGB2RED(rgb[1])];
+   uint32_t b1 = codeMap[NP_RGB2BLUE(rgb[1])];
+   uint32_t g2 = codeMap[NP_RGB2GREEN(rgb[2])];
+   uint32_t r2 = codeMap[NP_RGB2RED(rgb[2])];
+   uint32_t b2 = codeMap[NP_RGB2BLUE(rgb[2])];
+   uint32_t g3 = codeMap[NP_RGB2GREEN(rgb[3])];
+   uint32_t r3 = codeMap[NP_RGB2RED(rgb[3])];
+   uint32_t b3 = codeMap[NP_RGB2BLUE(rgb[3])];
+   uint32_t w;
+
+   w = (g0 << 8)  | (r0 >> 16); out[0] = I2S_SWAP16(w);
+   w = (r0 << 16) | (b0 >> 8);  out[1] = I2S_SWAP16(w);
+   w = (b0 << 24) | g1;         out[2] = I2S_SWAP16(w);
+   w = (r1 << 8)  | (b1 >> 16); out[3] = I2S_SWAP16(w);
+   w = (b1 << 16) | (g2 >> 8);  out[4] = I2S_SWAP16(w);
+   w = (g2 << 24) | r2;         out[5] = I2S_SWAP16(w);
+   w = (b2 << 8)  | (g3 >> 16); out[6] = I2S_SWAP16(w);
+   w = (g3 << 16) | (r3 >> 8);  out[7] = I2S_SWAP16(w);
+   w = (r3 << 24) | b3;         out[8] = I2S_SWAP16(w);
+}
+
+/* Re-encode every group flagged in the dirty bitmap of buffer[which] from the
+   shadow copy and clear the flags. A trailing group with fewer than
+   WS2812B_GROUP_PIXELS pixels is encoded one pixel at a time */
+static void encode_dirty(tNpContext *c, uint32_t which)
+{
+   uint32_t fullGroups = c->pixels / WS2812B_GROUP_PIXELS;
+   uint32_t *dirtyGroups = c->dirtyGroups[which];
+   uint8_t *buffer = c->buffer[which];
+
+   for(uint32_t word = 0; word < c->dirtyWords; ++word)
+   {
+      uint32_t bits = dirtyGroups[word];
+      dirtyGroups[word] = 0;
+      while(bits != 0)
+      {
+         uint32_t group = (word * 32) + __builtin_ctz(bits);
+         uint32_t index = group * WS2812B_GROUP_PIXELS;
+         bits &= bits - 1;
+
+         if(group < fullGroups)
+            encode_group((uint32_t *)&buffer[index * WS2182B_BYTES_PER_PIXEL], &c->shadow[index], c->codeMap);
+         else
+         {
+            for(; index < c->pixels; ++index)
+               setpixel(buffer, index, c->shadow[index], c->codeMap);
+         }
+      }
+   }
+}
+
+/* Encode the pending changes into the back buffer and hand it to the transmit
+   task. 'ready' is cleared while encoding so the task cannot swap out a
+   half-written frame */
+static void publish(tNpContext *c)
+{
+   uint32_t back;
+
+   taskENTER_CRITICAL(&c->lock);
+   c->ready = false;
+   back = c->back;
+   taskEXIT_CRITICAL(&c->lock);
+
+   encode_dirty(c, back);
+
+   taskENTER_CRITICAL(&c->lock);
+   c->ready = true;
+   taskEXIT_CRITICAL(&c->lock);
+   xSemaphoreGive(c->newData);
+}
+
+/* Take the most recently published frame, or NULL if there is none; the
+   previous front buffer becomes the new back buffer for writers */
+static uint8_t *take_frame(tNpContext *c)
+{
+   uint8_t *buffer = NULL;
+
+   taskENTER_CRITICAL(&c->lock);
+   if(c->ready)
+   {
+      buffer = c->buffer[c->back];
+      c->back ^= 1;
+      c->ready = false;
+   }
+   taskEXIT_CRITICAL(&c->lock);
+   return buffer;
+}
+
+static void free_buffers(tNpContext *c)
+{
+   for(int i = 0; i < 2; ++i)
+   {
+      free(c->buffer[i]);
+      free(c->dirtyGroups[i]);
+   }
+   free(c->shadow);
+}
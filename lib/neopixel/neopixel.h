@@ -21,12 +21,6 @@ typedef void *tNeopixelContext;
                        | ((uint32_t)(g) & 0xFF) << 8   \
                        | ((uint32_t)(b) & 0xFF) )
 
-typedef struct sNeopixel 
-{
-   uint32_t index;
-   uint32_t rgb;
-} tNeopixel;
-
 /*! \brief Create a neopixel context
   * \param pixels Number of pixels
   * \param dout_pin Physical pin to send neopixel data (e.g. GPIO_NUM_27) 
@@ -50,13 +44,49 @@ uint32_t neopixel_GetRefreshRate(tNeopixelContext ctx);
  */ 
 void neopixel_Deinit(tNeopixelContext ctx);
 
-/*! \brief Set one or more pixels 
+/*! \brief Set a run of consecutive pixels
  *  \param ctx Neopixel context received from successful neopixel_Init calls
- *  \param pixel Pointer to array of tNeopixel, pixels to set
- *  \param pixelCount Number of pixels in tNeopixel array
- *  \returns true on success, false on failure
+ *  \param rgb Pointer to array of packed RGB values (see NP_RGB), one per pixel
+ *  \param first Index of the pixel that rgb[0] is written to
+ *  \param pixelCount Number of pixels in the rgb array
+ *  \returns true on success, false if the run extends past the last pixel
+ *  \note Only pixels whose color differs from the last value written are
+ *        re-encoded. If no pixel changed and no new level map is waiting, no
+ *        new frame is sent to the LEDs.
  */ 
-bool neopixel_SetPixel(tNeopixelContext ctx, tNeopixel *pixel, uint32_t pixelCount);
+bool neopixel_SetPixel(tNeopixelContext ctx, const uint32_t *rgb, uint32_t first, uint32_t pixelCount);
+
+/*! \brief Get the number of pixels changed by the most recent neopixel_SetPixel call
+ *  \param ctx Neopixel context received from successful neopixel_Init calls
+ *  \returns Number of pixels whose color changed (0 if the frame was identical)
+ */
+uint32_t neopixel_GetDirtyCount(tNeopixelContext ctx);
+
+/*! \brief Block until the LEDs have received a published frame
+ *  \param ctx Neopixel context received from successful neopixel_Init calls
+ *  \param ticks Maximum number of ticks to wait
+ *  \returns true once a frame transfer has completed, false on timeout
+ *  \note Only frames that were actually sent complete; a neopixel_SetPixel call
+ *        with no changed pixels does not send a frame.
+ */
+bool neopixel_WaitFrameDone(tNeopixelContext ctx, uint32_t ticks);
+
+/*! \brief Duration of the most recent frame transfer
+ *  \param ctx Neopixel context received from successful neopixel_Init calls
+ *  \returns Microseconds from starting the I2S transfer until it completed
+ */
+uint32_t neopixel_GetLastTransferUs(tNeopixelContext ctx);
+
+/*! \brief Set the output level used for each 8-bit color value
+ *  \param ctx Neopixel context received from successful neopixel_Init calls
+ *  \param levels Array of 256 output levels indexed by color value, applied to all
+ *                three channels (e.g. brightness and gamma), or NULL for identity
+ *  \note The levels are folded into the encode table, so they cost nothing per
+ *        pixel. All pixels are re-encoded and sent with the next neopixel_SetPixel
+ *        call, even if it changes no pixels. Must not be called concurrently with
+ *        neopixel_SetPixel.
+ */
+void neopixel_SetLevelMap(tNeopixelContext ctx, const uint8_t *levels);
 
 #ifdef __cplusplus
 }
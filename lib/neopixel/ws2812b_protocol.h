@@ -298,4 +298,84 @@ const ws2812b_pixel ws2812b_color_map[256] =
    { 0xdb, 0x6d, 0xb6 }, /* 255 */
 };
 
+/* Word-at-a-time variant of ws2812b_color_map. Each entry holds the same
+   three serialized bytes packed into the low 24 bits of a word, first byte
+   most significant, so whole pixel groups can be assembled with shifts.
+
+   WS2812B_GROUP_PIXELS pixels (4 x 72 bits) fill exactly WS2812B_GROUP_WORDS
+   32-bit words, so a group starts on a word boundary of the I2S buffer.
+
+   This table is 1024 bytes in size
+ */
+#define WS2812B_GROUP_PIXELS 4
+#define WS2812B_GROUP_WORDS  ((WS2812B_GROUP_PIXELS * WS2182B_BYTES_PER_PIXEL) / sizeof(uint32_t))
+
+const uint32_t ws2812b_code_map[256] =
+{
+   0x924924, 0x924926, 0x924934, 0x924936, /* 0 - 3 */
+   0x9249a4, 0x9249a6, 0x9249b4, 0x9249b6, /* 4 - 7 */
+   0x924d24, 0x924d26, 0x924d34, 0x924d36, /* 8 - 11 */
+   0x924da4, 0x924da6, 0x924db4, 0x924db6, /* 12 - 15 */
+   0x926924, 0x926926, 0x926934, 0x926936, /* 16 - 19 */
+   0x9269a4, 0x9269a6, 0x9269b4, 0x9269b6, /* 20 - 23 */
+   0x926d24, 0x926d26, 0x926d34, 0x926d36, /* 24 - 27 */
+   0x926da4, 0x926da6, 0x926db4, 0x926db6, /* 28 - 31 */
+   0x934924, 0x934926, 0x934934, 0x934936, /* 32 - 35 */
+   0x9349a4, 0x9349a6, 0x9349b4, 0x9349b6, /* 36 - 39 */
+   0x934d24, 0x934d26, 0x934d34, 0x934d36, /* 40 - 43 */
+   0x934da4, 0x934da6, 0x934db4, 0x934db6, /* 44 - 47 */
+   0x936924, 0x936926, 0x936934, 0x936936, /* 48 - 51 */
+   0x9369a4, 0x9369a6, 0x9369b4, 0x9369b6, /* 52 - 55 */
+   0x936d24, 0x936d26, 0x936d34, 0x936d36, /* 56 - 59 */
+   0x936da4, 0x936da6, 0x936db4, 0x936db6, /* 60 - 63 */
+   0x9a4924, 0x9a4926, 0x9a4934, 0x9a4936, /* 64 - 67 */
+   0x9a49a4, 0x9a49a6, 0x9a49b4, 0x9a49b6, /* 68 - 71 */
+   0x9a4d24, 0x9a4d26, 0x9a4d34, 0x9a4d36, /* 72 - 75 */
+   0x9a4da4, 0x9a4da6, 0x9a4db4, 0x9a4db6, /* 76 - 79 */
+   0x9a6924, 0x9a6926, 0x9a6934, 0x9a6936, /* 80 - 83 */
+   0x9a69a4, 0x9a69a6, 0x9a69b4, 0x9a69b6, /* 84 - 87 */
+   0x9a6d24, 0x9a6d26, 0x9a6d34, 0x9a6d36, /* 88 - 91 */
+   0x9a6da4, 0x9a6da6, 0x9a6db4, 0x9a6db6, /* 92 - 95 */
+   0x9b4924, 0x9b4926, 0x9b4934, 0x9b4936, /* 96 - 99 */
+   0x9b49a4, 0x9b49a6, 0x9b49b4, 0x9b49b6, /* 100 - 103 */
+   0x9b4d24, 0x9b4d26, 0x9b4d34, 0x9b4d36, /* 104 - 107 */
+   0x9b4da4, 0x9b4da6, 0x9b4db4, 0x9b4db6, /* 108 - 111 */
+   0x9b6924, 0x9b6926, 0x9b6934, 0x9b6936, /* 112 - 115 */
+   0x9b69a4, 0x9b69a6, 0x9b69b4, 0x9b69b6, /* 116 - 119 */
+   0x9b6d24, 0x9b6d26, 0x9b6d34, 0x9b6d36, /* 120 - 123 */
+   0x9b6da4, 0x9b6da6, 0x9b6db4, 0x9b6db6, /* 124 - 127 */
+   0xd24924, 0xd24926, 0xd24934, 0xd24936, /* 128 - 131 */
+   0xd249a4, 0xd249a6, 0xd249b4, 0xd249b6, /* 132 - 135 */
+   0xd24d24, 0xd24d26, 0xd24d34, 0xd24d36, /* 136 - 139 */
+   0xd24da4, 0xd24da6, 0xd24db4, 0xd24db6, /* 140 - 143 */
+   0xd26924, 0xd26926, 0xd26934, 0xd26936, /* 144 - 147 */
+   0xd269a4, 0xd269a6, 0xd269b4, 0xd269b6, /* 148 - 151 */
+   0xd26d24, 0xd26d26, 0xd26d34, 0xd26d36, /* 152 - 155 */
+   0xd26da4, 0xd26da6, 0xd26db4, 0xd26db6, /* 156 - 159 */
+   0xd34924, 0xd34926, 0xd34934, 0xd34936, /* 160 - 163 */
+   0xd349a4, 0xd349a6, 0xd349b4, 0xd349b6, /* 164 - 167 */
+   0xd34d24, 0xd34d26, 0xd34d34, 0xd34d36, /* 168 - 171 */
+   0xd34da4, 0xd34da6, 0xd34db4, 0xd34db6, /* 172 - 175 */
+   0xd36924, 0xd36926, 0xd36934, 0xd36936, /* 176 - 179 */
+   0xd369a4, 0xd369a6, 0xd369b4, 0xd369b6, /* 180 - 183 */
+   0xd36d24, 0xd36d26, 0xd36d34, 0xd36d36, /* 184 - 187 */
+   0xd36da4, 0xd36da6, 0xd36db4, 0xd36db6, /* 188 - 191 */
+   0xda4924, 0xda4926, 0xda4934, 0xda4936, /* 192 - 195 */
+   0xda49a4, 0xda49a6, 0xda49b4, 0xda49b6, /* 196 - 199 */
+   0xda4d24, 0xda4d26, 0xda4d34, 0xda4d36, /* 200 - 203 */
+   0xda4da4, 0xda4da6, 0xda4db4, 0xda4db6, /* 204 - 207 */
+   0xda6924, 0xda6926, 0xda6934, 0xda6936, /* 208 - 211 */
+   0xda69a4, 0xda69a6, 0xda69b4, 0xda69b6, /* 212 - 215 */
+   0xda6d24, 0xda6d26, 0xda6d34, 0xda6d36, /* 216 - 219 */
+   0xda6da4, 0xda6da6, 0xda6db4, 0xda6db6, /* 220 - 223 */
+   0xdb4924, 0xdb4926, 0xdb4934, 0xdb4936, /* 224 - 227 */
+   0xdb49a4, 0xdb49a6, 0xdb49b4, 0xdb49b6, /* 228 - 231 */
+   0xdb4d24, 0xdb4d26, 0xdb4d34, 0xdb4d36, /* 232 - 235 */
+   0xdb4da4, 0xdb4da6, 0xdb4db4, 0xdb4db6, /* 236 - 239 */
+   0xdb6924, 0xdb6926, 0xdb6934, 0xdb6936, /* 240 - 243 */
+   0xdb69a4, 0xdb69a6, 0xdb69b4, 0xdb69b6, /* 244 - 247 */
+   0xdb6d24, 0xdb6d26, 0xdb6d34, 0xdb6d36, /* 248 - 251 */
+   0xdb6da4, 0xdb6da6, 0xdb6db4, 0xdb6db6, /* 252 - 255 */
+};
+
 #endif /* _WS2812B_PROTOCOL_H */
\ No newline at end of file
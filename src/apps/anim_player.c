@@ -0,0 +1,132 @@
+#include "anim_player.h"
+
+#include "telnet_log.h"
+#include "display_manager.h"
+#include "app_manager.h"
+#include "anim_codec.h"
+
+#include "esp_partition.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define TAG "ANIM_PLAYER"
+
+static app_manager_app_t anim_player_app =
+{
+    .name = "Animation",
+    .init_function = anim_player_init,
+    .task_function = anim_player_task,
+    .deinit_function = NULL, // No specific deinit function
+    .active = true,
+    .priority = 5,
+    .refresh_rate_ms = 0, // Each frame carries its own duration
+    .stack_size = 4096,
+    .state = APP_STATE_STOPPED,
+};
+
+static displayManager_buffer_t* anim_display_buffer = NULL;
+static esp_partition_mmap_handle_t anim_mmap_handle;
+static anim_codec_t anim;
+static const uint32_t* anim_shown = NULL; // Canvas of the last frame presented
+static uint32_t anim_late_ms = 0;         // Frame time owed from rounding to whole display frames
+
+bool anim_player_init(void)
+{
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                                ESP_PARTITION_SUBTYPE_ANY,
+                                                                ANIM_PLAYER_PARTITION);
+    if (partition == NULL) {
+        LOGE("No '%s' partition", ANIM_PLAYER_PARTITION);
+        return false;
+    }
+
+    // Only map as much flash as the animation uses, the header says how much
+    uint8_t raw[ANIM_HEADER_SIZE];
+    anim_codec_header_t header;
+    if (esp_partition_read(partition, 0, raw, sizeof(raw)) != ESP_OK ||
+        anim_codec_readHeader(raw, sizeof(raw), &header) != ANIM_OK ||
+        header.size > partition->size) {
+        LOGE("No animation in the '%s' partition", ANIM_PLAYER_PARTITION);
+        return false;
+    }
+
+    const void* data = NULL;
+    esp_err_t err = esp_partition_mmap(partition, 0, header.size, ESP_PARTITION_MMAP_DATA,
+                                       &data, &anim_mmap_handle);
+    if (err != ESP_OK) {
+        LOGE("Failed to map animation: %s", esp_err_to_name(err));
+        return false;
+    }
+    anim_codec_result_E result = anim_codec_open(&anim, data, header.size);
+    if (result != ANIM_OK) {
+        LOGE("Bad animation (%d)", result);
+        esp_partition_munmap(anim_mmap_handle);
+        return false;
+    }
+
+    // Made for this panel, but a different size still plays from the top-left corner
+    if (header.width != DISPLAY_WIDTH || header.height != DISPLAY_HEIGHT) {
+        LOGW("Animation is %ux%u, display is %lux%lu", header.width, header.height,
+             DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    }
+    anim_display_buffer = display_manager_create_buffer("Animation",
+                                                        header.width, header.height,
+                                                        0, 0,
+                                                        DISPLAY_MANAGER_LAYER_BACKGROUND);
+    if (anim_display_buffer == NULL) {
+        LOGE("Failed to create animation display buffer");
+        esp_partition_munmap(anim_mmap_handle);
+        return false;
+    }
+    // Each frame is decoded into a spare canvas, delta frames take what they leave
+    // from the last one presented
+    if (display_manager_enableDoubleBuffer(anim_display_buffer) != ESP_OK) {
+        LOGE("Failed to double buffer animation display");
+    }
+    LOGI("Playing %u frames, %lu bytes of flash", header.frame_count, header.size);
+    return true;
+}
+
+void anim_player_task(void* pvParameter)
+{
+    while (1) {
+        uint32_t duration_ms = 0;
+        anim_codec_result_E result = anim_codec_decodeFrame(&anim, anim_display_buffer->buffer,
+                                                            anim_shown, &duration_ms);
+        if (result == ANIM_END) {
+            anim_codec_rewind(&anim);
+            continue;
+        }
+        if (result != ANIM_OK) {
+            LOGE("Animation frame %u is bad (%d), stopping", anim.frame, result);
+            display_manager_setBufferActive(anim_display_buffer, false);
+            vTaskDelete(NULL);
+            return;
+        }
+        if (anim_display_buffer->double_buffered) {
+            anim_shown = anim_display_buffer->buffer;
+            display_manager_presentDiscard(anim_display_buffer);
+        } else {
+            display_manager_markDirty(anim_display_buffer, 0, 0,
+                                      anim_display_buffer->width, anim_display_buffer->height);
+        }
+
+        // Durations rarely divide into display frames. Carry what is left over to the
+        // next frame so the animation keeps its speed instead of running fast
+        uint32_t due_ms = duration_ms + anim_late_ms;
+        uint32_t frames = display_manager_msToFrames(due_ms);
+        uint32_t shown_ms = frames * DISPLAY_MANAGER_FRAME_PERIOD_MS;
+        anim_late_ms = (due_ms > shown_ms) ? due_ms - shown_ms : 0;
+        display_manager_waitFrames(frames);
+    }
+}
+
+esp_err_t anim_player_app_register(void)
+{
+    return app_manager_register_app(&anim_player_app);
+}
@@ -3,7 +3,7 @@
 #include "http_manager.h"
 #include "telnet_log.h"
 #include "display_manager.h"
-#include "graphics.h"
+#include "display_list.h"
 #include "fonts.h"
 #include "app_manager.h"
 
@@ -28,6 +28,7 @@
 static clock_datetime_t current_time = {0};
 static gptimer_handle_t timer = NULL; // Timer handle
 static displayManager_buffer_t* clock_display_buffer = NULL;
+static displayList_t* clock_display_list = NULL;
 
 static app_manager_app_t clock_app =
 {
@@ -212,6 +213,12 @@ bool clock_init(void)
         while(1);
         return false; // Buffer creation failed
     }
+    // The display task draws the time, and only when it changes
+    clock_display_list = display_list_create(clock_display_buffer);
+    if (clock_display_list == NULL) {
+        LOGE("Failed to create clock display list");
+        return false;
+    }
     
     while (!http_manager_readyForDependencies()) // Wait for the IP address to be obtained
     {
@@ -249,20 +256,18 @@ void clock_task(void* pvParameter)
 {
     while (1)
     {
-        graphics_drawChar(clock_display_buffer, 0, 0, clock_getHourTens12(), FONT_SIZE_5x3, 0xFF0000);
-        graphics_drawChar(clock_display_buffer, 3, 0, clock_getHourOnes12(), FONT_SIZE_5x3, 0x00FF00);
-        if (current_time.second % 2 == 0) {
-            display_manager_setBufferPixel(clock_display_buffer, 6, 1, 0xFFFF00); // Draw the colon
-            display_manager_setBufferPixel(clock_display_buffer, 6, 3, 0xFFFF00); // Draw the colon
-        } else {
-            display_manager_setBufferPixel(clock_display_buffer, 6, 1, 0x000000); // Clear the colon
-            display_manager_setBufferPixel(clock_display_buffer, 6, 3, 0x000000); // Clear the colon
-        }
-        graphics_drawChar(clock_display_buffer, 7, 0, clock_getMinuteTens(), FONT_SIZE_5x3, 0x0000FF);
-        graphics_drawChar(clock_display_buffer, 10, 0, clock_getMinuteOnes(), FONT_SIZE_5x3, 0xFFFF00);
-
-
-        vTaskDelay(pdMS_TO_TICKS(1000)); // Wait for 1 second
+        display_list_begin(clock_display_list);
+        display_list_char(clock_display_list, 0, 0, clock_getHourTens12(), FONT_SIZE_5x3, 0xFF0000);
+        display_list_char(clock_display_list, 3, 0, clock_getHourOnes12(), FONT_SIZE_5x3, 0x00FF00);
+        uint32_t colon = (current_time.second % 2 == 0) ? 0xFFFF00 : 0x000000; // Blink the colon
+        display_list_rect(clock_display_list, 6, 1, 1, 1, colon);
+        display_list_rect(clock_display_list, 6, 3, 1, 1, colon);
+        display_list_char(clock_display_list, 7, 0, clock_getMinuteTens(), FONT_SIZE_5x3, 0x0000FF);
+        display_list_char(clock_display_list, 10, 0, clock_getMinuteOnes(), FONT_SIZE_5x3, 0xFFFF00);
+        display_list_submit(clock_display_list); // Skipped if nothing changed
+
+        // Redraw in step with composition rather than on a free-running delay
+        display_manager_waitFrames(display_manager_msToFrames(clock_app.refresh_rate_ms));
     }
 }
 
@@ -1,6 +1,8 @@
 #include "telnet_log.h"
 
 #include "http_manager.h"
+#include "frame_stats.h"
+#include "display_manager.h"
 
 #include "lwip/sockets.h"
 
@@ -8,6 +10,8 @@
 #include "freertos/task.h"
 
 #include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 
@@ -20,6 +24,86 @@ static const uint8_t MAX_CLIENTS = 1;
 static int server_socket = -1;
 static int client_socket = -1;
 
+// Per-task CPU time, to see what the display pipeline costs. Needs
+// CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS and CONFIG_FREERTOS_USE_STATS_FORMATTING_FUNCTIONS
+static void telnet_log_printTasks(void)
+{
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS && CONFIG_FREERTOS_USE_STATS_FORMATTING_FUNCTIONS
+    // Roughly 40 characters per task
+    size_t size = uxTaskGetNumberOfTasks() * 48 + 1;
+    char* stats = malloc(size);
+    if (stats == NULL) {
+        telnet_log_write("Out of memory\n\r");
+        return;
+    }
+    vTaskGetRunTimeStats(stats);
+
+    // One line per write, the table is larger than a log line
+    char* saveptr = NULL;
+    for (char* line = strtok_r(stats, "\r\n", &saveptr); line != NULL; line = strtok_r(NULL, "\r\n", &saveptr)) {
+        telnet_log_write("%s\n\r", line);
+    }
+    free(stats);
+#else
+    telnet_log_write("Run-time stats are disabled in this build\n\r");
+#endif
+}
+
+// "geometry" shows the display geometry, "geometry <rows> <cols> <wiring> <rotation>"
+// stores a new one for the next boot
+static void telnet_log_geometry(const char* args)
+{
+    unsigned rows, cols, wiring, rotation;
+    if (*args == '\0') {
+        uint32_t curRows, curCols;
+        displayManager_wiring_E curWiring;
+        displayManager_rotation_E curRotation;
+        display_manager_getGeometry(&curRows, &curCols, &curWiring, &curRotation);
+        telnet_log_write("%lu rows, %lu cols, wiring %d, rotation %d\n\r",
+                         curRows, curCols, curWiring, curRotation);
+    } else if (sscanf(args, "%u %u %u %u", &rows, &cols, &wiring, &rotation) == 4 &&
+               display_manager_saveGeometry(rows, cols, wiring, rotation) == ESP_OK) {
+        telnet_log_write("Geometry saved, reboot to apply\n\r");
+    } else {
+        telnet_log_write("Usage: geometry <rows> <cols> <wiring 0-1> <rotation 0-3>, "
+                         "rows * cols up to %d\n\r", DISPLAY_MANAGER_MAX_PIXELS);
+    }
+}
+
+// Run a command typed by the telnet client
+static void telnet_log_handleCommand(char* cmd)
+{
+    // Strip the line ending and any trailing whitespace
+    size_t len = strlen(cmd);
+    while (len > 0 && (cmd[len - 1] == '\r' || cmd[len - 1] == '\n' || cmd[len - 1] == ' ')) {
+        cmd[--len] = '\0';
+    }
+
+    if (strcmp(cmd, "stats") == 0) {
+        frame_stats_log();
+        uint32_t composed, skipped;
+        display_manager_getFrameCounts(&composed, &skipped);
+        telnet_log_write("frames composed %lu, idle %lu\n\r", composed, skipped);
+    } else if (strncmp(cmd, "geometry", 8) == 0 && (cmd[8] == '\0' || cmd[8] == ' ')) {
+        telnet_log_geometry(cmd[8] ? &cmd[9] : &cmd[8]);
+    } else if (strcmp(cmd, "tasks") == 0) {
+        telnet_log_printTasks();
+    } else if (strcmp(cmd, "stats reset") == 0) {
+        frame_stats_reset();
+        telnet_log_write("Frame stats reset\n\r");
+    } else if (strcmp(cmd, "pool") == 0) {
+        displayManager_poolStats_t pool;
+        display_manager_getPoolStats(&pool);
+        telnet_log_write("buffers %lu (max %lu), pool %lu B (max %lu) in %lu/%lu x %lu B chunks, heap %lu B (max %lu)\n\r",
+                         pool.buffers_in_use, pool.buffers_high_water,
+                         pool.pool_bytes_in_use, pool.pool_bytes_high_water,
+                         pool.chunks, pool.chunk_limit, pool.chunk_size,
+                         pool.heap_bytes, pool.heap_bytes_high_water);
+    } else if (len > 0) {
+        telnet_log_write("Unknown command: %s\n\r", cmd);
+    }
+}
+
 void telnet_log_task(void* pvParameter)
 {
     while (!http_manager_readyForDependencies()) {
@@ -69,6 +153,7 @@ void telnet_log_task(void* pvParameter)
             }
             buf[len] = '\0'; // Null-terminate the received string
             ESP_LOGI("TELNET_LOG", "Received: %s", buf);
+            telnet_log_handleCommand(buf);
         }
     }
 }
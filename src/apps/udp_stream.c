@@ -0,0 +1,126 @@
+#include "udp_stream.h"
+
+#include "http_manager.h"
+#include "telnet_log.h"
+#include "display_manager.h"
+#include "app_manager.h"
+#include "ddp.h"
+
+#include "lwip/sockets.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define TAG "UDP_STREAM"
+
+static app_manager_app_t udp_stream_app =
+{
+    .name = "Stream",
+    .init_function = udp_stream_init,
+    .task_function = udp_stream_task,
+    .deinit_function = NULL, // No specific deinit function
+    .active = true,
+    .priority = 5,
+    .refresh_rate_ms = 0, // Driven by incoming packets
+    .stack_size = 4096,
+    .state = APP_STATE_STOPPED,
+};
+
+static displayManager_buffer_t* stream_display_buffer = NULL;
+static ddp_frame_t stream_frame;
+static uint8_t packet[UDP_STREAM_MAX_PACKET]; // Pixels go from here straight into the canvas
+
+bool udp_stream_init(void)
+{
+    stream_display_buffer = display_manager_create_buffer("Stream",
+                                                          DISPLAY_WIDTH, DISPLAY_HEIGHT,
+                                                          0, 0,
+                                                          DISPLAY_MANGER_LAYER_POPUP);
+    if (stream_display_buffer == NULL) {
+        LOGE("Failed to create stream display buffer");
+        return false;
+    }
+    // Packets land in the back canvas; a frame only shows once its last packet is in
+    if (display_manager_enableDoubleBuffer(stream_display_buffer) != ESP_OK) {
+        LOGE("Failed to double buffer stream display");
+        return false;
+    }
+    display_manager_setBufferActive(stream_display_buffer, false); // Hidden until a sender shows up
+
+    ddp_frame_init(&stream_frame, stream_display_buffer->buffer,
+                   stream_display_buffer->width * stream_display_buffer->height);
+    return true;
+}
+
+void udp_stream_task(void* pvParameter)
+{
+    while (!http_manager_readyForDependencies()) {
+        vTaskDelay(pdMS_TO_TICKS(1000)); // Wait for 1 second
+    }
+
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock < 0) {
+        LOGE("Failed to create socket");
+        vTaskDelete(NULL);
+        return;
+    }
+
+    struct sockaddr_in addr = {0};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = INADDR_ANY; // Bind to all interfaces
+    addr.sin_port = htons(DDP_PORT);
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        LOGE("Failed to bind socket");
+        close(sock);
+        vTaskDelete(NULL);
+        return;
+    }
+
+    // Wake up now and then while idle to notice the sender has gone
+    struct timeval timeout = {
+        .tv_sec = UDP_STREAM_TIMEOUT_MS / 1000,
+        .tv_usec = (UDP_STREAM_TIMEOUT_MS % 1000) * 1000,
+    };
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    LOGI("Listening for DDP frames on UDP port %d", DDP_PORT);
+
+    bool streaming = false;
+    TickType_t lastFrame = 0;
+    while (1) {
+        int len = recv(sock, packet, sizeof(packet), 0);
+        if (len > 0) {
+            ddp_packet_t ddp;
+            if (ddp_parse(packet, len, &ddp) == DDP_OK &&
+                ddp_frame_apply(&stream_frame, &ddp) == DDP_FRAME_COMPLETE) {
+                // Show the frame and assemble the next one into the canvas we get back.
+                // It holds an older frame; whatever the sender leaves out comes from this one
+                stream_frame.previous = stream_display_buffer->buffer;
+                display_manager_presentDiscard(stream_display_buffer);
+                stream_frame.pixels = stream_display_buffer->buffer;
+                lastFrame = xTaskGetTickCount();
+                if (!streaming) {
+                    LOGI("Stream started");
+                    display_manager_setBufferActive(stream_display_buffer, true);
+                    streaming = true;
+                }
+            }
+        }
+
+        if (streaming && (xTaskGetTickCount() - lastFrame) > pdMS_TO_TICKS(UDP_STREAM_TIMEOUT_MS)) {
+            LOGI("Stream stopped after %lu frames, %lu late packets dropped",
+                 stream_frame.frames, stream_frame.late);
+            display_manager_setBufferActive(stream_display_buffer, false);
+            ddp_frame_reset(&stream_frame); // A new sender may start its sequence anywhere
+            streaming = false;
+        }
+    }
+}
+
+esp_err_t udp_stream_app_register(void)
+{
+    return app_manager_register_app(&udp_stream_app);
+}
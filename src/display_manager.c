@@ -14,6 +14,8 @@
 #include "esp_wifi.h"
 #include "telnet_log.h"
 #include "esp_heap_caps.h"
+#include "frame_stats.h"
+#include "display_list.h"
 
 #include <stdint.h>
 #include <string.h>
@@ -22,15 +24,384 @@
 
 #define TAG "DISPLAY_MANAGER"
 
+// Inclusive rectangle in screen coordinates
 typedef struct {
-    displayManager_buffer_t* buffers[MAX_DISPLAY_BUFFERS];
+    int32_t x0;
+    int32_t y0;
+    int32_t x1;
+    int32_t y1;
+} display_manager_rect_t;
+
+// Frame period in ticks, at least one
+#define DISPLAY_MANAGER_PERIOD_TICKS MAX(pdMS_TO_TICKS(DISPLAY_MANAGER_FRAME_PERIOD_MS), 1)
+
+#define DISPLAY_POOL_MAX_ORDERS 16
+#define DISPLAY_POOL_FREE 0x80
+#define DISPLAY_POOL_USED 0x40
+#define DISPLAY_POOL_ORDER_MASK 0x3F
+
+// Header kept in the first bytes of a free pool block
+typedef struct display_manager_freeBlock {
+    struct display_manager_freeBlock* next;
+    struct display_manager_freeBlock* prev;
+} display_manager_freeBlock_t;
+
+typedef struct {
+    // Geometry, fixed at init (see display_manager_loadGeometry)
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t num_pixels;        // rows * cols
+    displayManager_rotation_E rotation;
+    displayManager_wiring_E wiring;
+
+    displayManager_buffer_t* buffers[MAX_DISPLAY_BUFFERS]; // Back to front by layer, then order
     uint32_t num_buffers;
     uint32_t* output_buffer;
+    uint32_t* physical_buffer;  // output_buffer in LED wiring order, submitted to the driver
+    uint16_t* index_map;        // Logical (row * cols + col) to LED index
+    uint32_t* line_buffer;      // One row of a compact-format buffer expanded to RGB888
+    uint16_t* coverage;         // Per pixel, how much of what is below still shows (0-256)
+    uint16_t* row_remaining;    // Per row, pixels with coverage left
     bool initialized;
+    bool full_redraw;           // Compose the whole screen on the next frame
+    TaskHandle_t task;          // Display task, notified when something changes while it idles
+    TickType_t last_tick;       // Time of the last frame tick, on the period grid
+    bool period_composed;       // A frame was sent since the last tick
+    uint32_t frames_composed;
+    uint32_t frames_skipped;
+    volatile uint32_t frame_count; // Every tick, composed or skipped
+    struct {
+        TaskHandle_t task;
+        uint32_t target;        // Wake once frame_count reaches this
+    } waiters[DISPLAY_MANAGER_MAX_WAITERS];
+
+    // Pools so apps can come and go without fragmenting the heap. Pixels come from a
+    // buddy allocator over chunks: a free block is merged with its equal-sized neighbour
+    uint32_t chunk_size;        // One full-screen RGB888 buffer, rounded up to a power of two
+    uint32_t max_order;         // Order of a whole chunk, in DISPLAY_MANAGER_POOL_MIN_BLOCK doublings
+    uint8_t* chunks[DISPLAY_MANAGER_POOL_CHUNKS];
+    uint32_t num_chunks;
+    uint8_t* block_state;       // Per chunk and minimum block: DISPLAY_POOL_FREE/USED | order at a block start, 0 inside
+    display_manager_freeBlock_t* free_blocks[DISPLAY_POOL_MAX_ORDERS]; // Per order
+    uint8_t free_descriptors[MAX_DISPLAY_BUFFERS];
+    uint32_t num_free_descriptors;
+    displayManager_buffer_t* pending_free[MAX_DISPLAY_BUFFERS]; // Reclaimed at the next frame start
+    uint32_t num_pending_free;
+    bool freed_dirty;           // Freed buffers left freed_rect to recompose
+    display_manager_rect_t freed_rect;
+    displayManager_poolStats_t pool_stats;
 } display_manager_ctx_t;
 
 static display_manager_ctx_t dm_ctx = {0};
-static const displayManager_rotation_E rotation = DISPLAY_ROTATION_270;
+static displayManager_buffer_t buffer_pool[MAX_DISPLAY_BUFFERS];
+static portMUX_TYPE dm_lock = portMUX_INITIALIZER_UNLOCKED; // Guards the buffers' dirty state and the pools
+
+// Wake the display task in case it is idling on a static screen
+void display_manager_wake(void)
+{
+    TaskHandle_t task = dm_ctx.task;
+    // Drawing done by the display task itself, e.g. replaying display lists, is picked up this frame
+    if (task != NULL && task != xTaskGetCurrentTaskHandle()) {
+        xTaskNotifyGive(task);
+    }
+}
+
+// Redraw everything a buffer covers, e.g. after its palette or opacity changed.
+// Unlike display_manager_markDirty this applies to double-buffered buffers too
+static void display_manager_markAllDirty(displayManager_buffer_t* buffer)
+{
+    taskENTER_CRITICAL(&dm_lock);
+    bool wake = !buffer->dirty;
+    buffer->dirty_x0 = 0;
+    buffer->dirty_y0 = 0;
+    buffer->dirty_x1 = buffer->width - 1;
+    buffer->dirty_y1 = buffer->height - 1;
+    buffer->dirty = true;
+    taskEXIT_CRITICAL(&dm_lock);
+    if (wake) {
+        display_manager_wake();
+    }
+}
+
+// Grow rect to cover a w x h area at screen position (x, y), clipped to the screen
+static void display_manager_rectUnion(display_manager_rect_t* rect, bool* any,
+                                      int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    int32_t x0 = MAX(x, 0);
+    int32_t y0 = MAX(y, 0);
+    int32_t x1 = MIN(x + w, (int32_t)dm_ctx.cols) - 1;
+    int32_t y1 = MIN(y + h, (int32_t)dm_ctx.rows) - 1;
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+    if (!*any) {
+        *rect = (display_manager_rect_t){ x0, y0, x1, y1 };
+        *any = true;
+        return;
+    }
+    rect->x0 = MIN(rect->x0, x0);
+    rect->y0 = MIN(rect->y0, y0);
+    rect->x1 = MAX(rect->x1, x1);
+    rect->y1 = MAX(rect->y1, y1);
+}
+
+// Coordinate wrapped into [0, size)
+static inline int32_t display_manager_wrapCoord(int32_t v, uint32_t size)
+{
+    int32_t m = v % (int32_t)size;
+    return (m < 0) ? m + (int32_t)size : m;
+}
+
+// Where canvas span [c0, c1] lands in a view along one axis, relative to the view.
+// When a wrapped span straddles the canvas edge this covers both pieces at once
+static bool display_manager_viewSpan(uint32_t c0, uint32_t c1, int32_t scroll, uint32_t size,
+                                     uint32_t view, bool wrap, uint32_t* v0, uint32_t* v1)
+{
+    int32_t s0 = (int32_t)c0 - scroll;
+    int32_t s1 = (int32_t)c1 - scroll;
+    if (wrap) {
+        if (view > size) {
+            // The canvas repeats within the view, so the span can appear more than once
+            *v0 = 0;
+            *v1 = view - 1;
+            return true;
+        }
+        s0 = display_manager_wrapCoord(s0, size);
+        s1 = s0 + (int32_t)(c1 - c0);
+        if (s1 >= (int32_t)size) {
+            s1 = (s0 < (int32_t)view) ? (int32_t)view - 1 : s1 - (int32_t)size;
+            s0 = 0;
+        }
+    }
+    if (s1 < 0 || s0 >= (int32_t)view) {
+        return false;
+    }
+    *v0 = MAX(s0, 0);
+    *v1 = MIN(s1, (int32_t)view - 1);
+    return true;
+}
+
+static uint32_t display_manager_blockSize(uint32_t order)
+{
+    return DISPLAY_MANAGER_POOL_MIN_BLOCK << order;
+}
+
+// Chunk holding bytes, or -1 if it is not from the pool
+static int32_t display_manager_poolChunk(const uint8_t* bytes)
+{
+    for (uint32_t i = 0; i < dm_ctx.num_chunks; i++) {
+        if (bytes >= dm_ctx.chunks[i] && bytes < dm_ctx.chunks[i] + dm_ctx.chunk_size) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint8_t* display_manager_blockState(const uint8_t* block)
+{
+    int32_t chunk = display_manager_poolChunk(block);
+    uint32_t blocksPerChunk = dm_ctx.chunk_size / DISPLAY_MANAGER_POOL_MIN_BLOCK;
+    uint32_t index = (block - dm_ctx.chunks[chunk]) / DISPLAY_MANAGER_POOL_MIN_BLOCK;
+    return &dm_ctx.block_state[chunk * blocksPerChunk + index];
+}
+
+// Caller holds dm_lock
+static void display_manager_pushBlock(uint8_t* block, uint32_t order)
+{
+    display_manager_freeBlock_t* node = (display_manager_freeBlock_t*)block;
+    node->prev = NULL;
+    node->next = dm_ctx.free_blocks[order];
+    if (node->next) {
+        node->next->prev = node;
+    }
+    dm_ctx.free_blocks[order] = node;
+    *display_manager_blockState(block) = DISPLAY_POOL_FREE | order;
+}
+
+// Caller holds dm_lock
+static void display_manager_unlinkBlock(uint8_t* block, uint32_t order)
+{
+    display_manager_freeBlock_t* node = (display_manager_freeBlock_t*)block;
+    if (node->prev) {
+        node->prev->next = node->next;
+    } else {
+        dm_ctx.free_blocks[order] = node->next;
+    }
+    if (node->next) {
+        node->next->prev = node->prev;
+    }
+    *display_manager_blockState(block) = 0;
+}
+
+// Take a block of the given order, splitting a larger one if needed. Caller holds dm_lock
+static uint8_t* display_manager_takeBlock(uint32_t order)
+{
+    uint32_t from = order;
+    while (from <= dm_ctx.max_order && dm_ctx.free_blocks[from] == NULL) {
+        from++;
+    }
+    if (from > dm_ctx.max_order) {
+        return NULL;
+    }
+    uint8_t* block = (uint8_t*)dm_ctx.free_blocks[from];
+    display_manager_unlinkBlock(block, from);
+    // Hand back the upper halves until the block is the size asked for
+    while (from > order) {
+        from--;
+        display_manager_pushBlock(block + display_manager_blockSize(from), from);
+    }
+    *display_manager_blockState(block) = DISPLAY_POOL_USED | order;
+    return block;
+}
+
+// Add a chunk to the pool. Returns false once the pool has all its chunks
+static bool display_manager_growPool(void)
+{
+    taskENTER_CRITICAL(&dm_lock);
+    bool full = dm_ctx.num_chunks >= DISPLAY_MANAGER_POOL_CHUNKS;
+    taskEXIT_CRITICAL(&dm_lock);
+    if (full) {
+        return false;
+    }
+    uint8_t* chunk = heap_caps_malloc(dm_ctx.chunk_size, MALLOC_CAP_8BIT);
+    if (!chunk) {
+        return false;
+    }
+    taskENTER_CRITICAL(&dm_lock);
+    full = dm_ctx.num_chunks >= DISPLAY_MANAGER_POOL_CHUNKS;
+    if (!full) {
+        dm_ctx.chunks[dm_ctx.num_chunks++] = chunk;
+        dm_ctx.pool_stats.chunks = dm_ctx.num_chunks;
+        display_manager_pushBlock(chunk, dm_ctx.max_order);
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+    if (full) {
+        free(chunk); // Another task added the last chunk meanwhile, try its blocks
+    }
+    return true;
+}
+
+// Pixel storage from the pool when it fits, the heap otherwise
+static void* display_manager_allocPixels(size_t size)
+{
+    displayManager_poolStats_t* stats = &dm_ctx.pool_stats;
+    uint32_t order = 0;
+    while (order <= dm_ctx.max_order && display_manager_blockSize(order) < size) {
+        order++;
+    }
+    if (dm_ctx.block_state && order <= dm_ctx.max_order) {
+        do {
+            taskENTER_CRITICAL(&dm_lock);
+            uint8_t* block = display_manager_takeBlock(order);
+            if (block) {
+                stats->pool_bytes_in_use += display_manager_blockSize(order);
+                stats->pool_bytes_high_water = MAX(stats->pool_bytes_high_water, stats->pool_bytes_in_use);
+            }
+            taskEXIT_CRITICAL(&dm_lock);
+            if (block) {
+                return block;
+            }
+        } while (display_manager_growPool());
+    }
+
+    void* pixels = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    if (pixels) {
+        taskENTER_CRITICAL(&dm_lock);
+        stats->heap_bytes += size;
+        stats->heap_bytes_high_water = MAX(stats->heap_bytes_high_water, stats->heap_bytes);
+        taskEXIT_CRITICAL(&dm_lock);
+    }
+    return pixels;
+}
+
+static void display_manager_freePixels(void* pixels, size_t size)
+{
+    uint8_t* block = pixels;
+    if (!block) {
+        return;
+    }
+    taskENTER_CRITICAL(&dm_lock);
+    int32_t chunk = display_manager_poolChunk(block);
+    if (chunk >= 0) {
+        uint32_t order = *display_manager_blockState(block) & DISPLAY_POOL_ORDER_MASK;
+        dm_ctx.pool_stats.pool_bytes_in_use -= display_manager_blockSize(order);
+        // Merge with the buddy for as long as it is free and whole
+        uint8_t* base = dm_ctx.chunks[chunk];
+        while (order < dm_ctx.max_order) {
+            uint8_t* buddy = base + ((block - base) ^ display_manager_blockSize(order));
+            if (*display_manager_blockState(buddy) != (DISPLAY_POOL_FREE | order)) {
+                break;
+            }
+            display_manager_unlinkBlock(buddy, order);
+            *display_manager_blockState(block) = 0;
+            block = MIN(block, buddy);
+            order++;
+        }
+        display_manager_pushBlock(block, order);
+    } else {
+        dm_ctx.pool_stats.heap_bytes -= size;
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+    if (chunk < 0) {
+        free(pixels);
+    }
+}
+
+static displayManager_buffer_t* display_manager_allocDescriptor(void)
+{
+    displayManager_buffer_t* buffer = NULL;
+    displayManager_poolStats_t* stats = &dm_ctx.pool_stats;
+    taskENTER_CRITICAL(&dm_lock);
+    if (dm_ctx.num_free_descriptors > 0) {
+        buffer = &buffer_pool[dm_ctx.free_descriptors[--dm_ctx.num_free_descriptors]];
+        stats->buffers_in_use++;
+        stats->buffers_high_water = MAX(stats->buffers_high_water, stats->buffers_in_use);
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+    if (buffer) {
+        memset(buffer, 0, sizeof(*buffer));
+    }
+    return buffer;
+}
+
+static void display_manager_freeDescriptor(displayManager_buffer_t* buffer)
+{
+    taskENTER_CRITICAL(&dm_lock);
+    dm_ctx.free_descriptors[dm_ctx.num_free_descriptors++] = buffer - buffer_pool;
+    dm_ctx.pool_stats.buffers_in_use--;
+    taskEXIT_CRITICAL(&dm_lock);
+}
+
+// Return a buffer's pixels and descriptor to the pools
+static void display_manager_releaseBuffer(displayManager_buffer_t* buffer)
+{
+    if (buffer->double_buffered) {
+        for (uint32_t i = 1; i < DISPLAY_CANVAS_COUNT; i++) {
+            display_manager_freePixels(buffer->canvas[i], buffer->height * buffer->stride);
+        }
+    }
+    if (buffer->display_list) {
+        display_list_destroy(buffer->display_list);
+    }
+    display_manager_freePixels(buffer->storage, buffer->storage_size);
+    display_manager_freeDescriptor(buffer);
+}
+
+void display_manager_getPoolStats(displayManager_poolStats_t* stats)
+{
+    taskENTER_CRITICAL(&dm_lock);
+    *stats = dm_ctx.pool_stats;
+    taskEXIT_CRITICAL(&dm_lock);
+    stats->chunk_limit = DISPLAY_MANAGER_POOL_CHUNKS;
+    stats->chunk_size = dm_ctx.chunk_size;
+}
+
+// Default panel mounting, for units without geometry in genealogy. Input cable is
+// bottom right: LED 0 is logical (rows - 1, cols - 1) and the strip runs up/down
+// the columns towards (0, 0)
+static const displayManager_rotation_E defaultRotation = DISPLAY_ROTATION_180;
+static const displayManager_wiring_E defaultWiring = DISPLAY_WIRING_COLUMN_SERPENTINE;
+static const bool mirror = false;
 static const bool enablePotMonitoring = true;
 static float current_brightness = 1.0f; // Default brightness
 
@@ -54,6 +425,209 @@ void display_manager_setBrightness(float brightness)
     }
 }
 
+// RGB565 with the green LSB as the opaque bit, so green keeps 5 bits and an
+// all-zero buffer is transparent
+static inline uint16_t display_manager_toRgb565(uint32_t color)
+{
+    if (color == TRANSPARENT) {
+        return 0;
+    }
+    return ((color >> 8) & 0xF800) | ((color >> 5) & 0x07C0) | 0x0020 | ((color >> 3) & 0x001F);
+}
+
+static inline uint32_t display_manager_fromRgb565(uint16_t value)
+{
+    if (!(value & 0x0020)) {
+        return TRANSPARENT;
+    }
+    uint32_t r = value >> 11;
+    uint32_t g = (value >> 6) & 0x1F;
+    uint32_t b = value & 0x1F;
+    // Replicate the top bits so full scale maps to 0xFF
+    r = (r << 3) | (r >> 2);
+    g = (g << 3) | (g >> 2);
+    b = (b << 3) | (b >> 2);
+    return (r << 16) | (g << 8) | b;
+}
+
+// Palette index for a colour, adding it to the palette while there is room
+static uint32_t display_manager_paletteIndex(displayManager_buffer_t* buffer, uint32_t color)
+{
+    if (color == TRANSPARENT) {
+        return DISPLAY_PALETTE_TRANSPARENT_INDEX;
+    }
+    for (uint32_t i = 1; i < buffer->palette_used; i++) {
+        if (buffer->palette[i] == color) {
+            return i;
+        }
+    }
+    if (buffer->palette_used < buffer->palette_size) {
+        buffer->palette[buffer->palette_used] = color;
+        return buffer->palette_used++;
+    }
+
+    // Palette full, fall back to the closest entry
+    uint32_t best = 1;
+    uint32_t bestDistance = UINT32_MAX;
+    for (uint32_t i = 1; i < buffer->palette_used; i++) {
+        int32_t dr = (int32_t)((color >> 16) & 0xFF) - (int32_t)((buffer->palette[i] >> 16) & 0xFF);
+        int32_t dg = (int32_t)((color >> 8) & 0xFF) - (int32_t)((buffer->palette[i] >> 8) & 0xFF);
+        int32_t db = (int32_t)(color & 0xFF) - (int32_t)(buffer->palette[i] & 0xFF);
+        uint32_t distance = dr * dr + dg * dg + db * db;
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Expand count pixels of a buffer row, starting at (x, y), to RGB888.
+// RGB888 rows are returned in place, other formats are written to line
+static const uint32_t* display_manager_expandRow(const displayManager_buffer_t* buf,
+                                                 const uint8_t* pixels,
+                                                 uint32_t x, uint32_t y,
+                                                 uint32_t count, uint32_t* line)
+{
+    const uint8_t* row = pixels + y * buf->stride;
+    switch (buf->format)
+    {
+        case DISPLAY_FORMAT_RGB565:
+        {
+            const uint16_t* src = (const uint16_t*)row + x;
+            for (uint32_t i = 0; i < count; i++) {
+                line[i] = display_manager_fromRgb565(src[i]);
+            }
+            return line;
+        }
+
+        case DISPLAY_FORMAT_INDEXED8:
+        {
+            const uint8_t* src = row + x;
+            for (uint32_t i = 0; i < count; i++) {
+                line[i] = buf->palette[src[i]];
+            }
+            return line;
+        }
+
+        case DISPLAY_FORMAT_INDEXED4:
+        {
+            for (uint32_t i = 0; i < count; i++) {
+                uint32_t px = x + i;
+                uint8_t pair = row[px >> 1];
+                line[i] = buf->palette[(px & 1) ? (pair & 0x0F) : (pair >> 4)];
+            }
+            return line;
+        }
+
+        default:
+            return (const uint32_t*)row + x;
+    }
+}
+
+// Like display_manager_expandRow, but the row may run past the right edge of the
+// canvas and continue from its left edge, for wrapping views
+static const uint32_t* display_manager_sampleRow(const displayManager_buffer_t* buf,
+                                                 const uint8_t* pixels,
+                                                 uint32_t x, uint32_t y,
+                                                 uint32_t count, uint32_t* line)
+{
+    if (x + count <= buf->width) {
+        return display_manager_expandRow(buf, pixels, x, y, count, line);
+    }
+    for (uint32_t done = 0; done < count; x = 0) {
+        uint32_t span = MIN(count - done, buf->width - x);
+        const uint32_t* src = display_manager_expandRow(buf, pixels, x, y, span, &line[done]);
+        if (src != &line[done]) {
+            memcpy(&line[done], src, span * sizeof(uint32_t));
+        }
+        done += span;
+    }
+    return line;
+}
+
+esp_err_t display_manager_enableDoubleBuffer(displayManager_buffer_t* buffer)
+{
+    if (!buffer) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (buffer->double_buffered) {
+        return ESP_OK;
+    }
+    if (buffer->display_list) {
+        return ESP_ERR_INVALID_STATE; // The display task draws it
+    }
+
+    size_t size = buffer->height * buffer->stride;
+    buffer->canvas[0] = buffer->buffer8;
+    for (uint32_t i = 1; i < DISPLAY_CANVAS_COUNT; i++) {
+        buffer->canvas[i] = display_manager_allocPixels(size);
+        if (!buffer->canvas[i]) {
+            for (uint32_t j = 1; j < i; j++) {
+                display_manager_freePixels(buffer->canvas[j], size);
+                buffer->canvas[j] = NULL;
+            }
+            return ESP_ERR_NO_MEM;
+        }
+        memcpy(buffer->canvas[i], buffer->canvas[0], size);
+    }
+    buffer->draw = 0;
+    buffer->ready = 1;
+    buffer->front = 2;
+    __atomic_store_n(&buffer->double_buffered, true, __ATOMIC_RELEASE);
+    return ESP_OK;
+}
+
+// Hand the finished canvas over and take back whichever one was waiting. If the
+// compositor never picked that one up it is simply reused. Returns the canvas presented
+static uint32_t display_manager_flip(displayManager_buffer_t* buffer)
+{
+    uint32_t presented = buffer->draw;
+    uint32_t previous = __atomic_exchange_n(&buffer->ready, presented | DISPLAY_CANVAS_FRESH,
+                                            __ATOMIC_ACQ_REL);
+    buffer->draw = previous & ~DISPLAY_CANVAS_FRESH;
+    buffer->buffer8 = buffer->canvas[buffer->draw];
+    display_manager_wake();
+    return presented;
+}
+
+void display_manager_present(displayManager_buffer_t* buffer)
+{
+    if (!buffer || !buffer->double_buffered) {
+        return;
+    }
+    uint32_t presented = display_manager_flip(buffer);
+    // Keep drawing incremental: start the new back canvas from what was presented
+    memcpy(buffer->buffer8, buffer->canvas[presented], buffer->height * buffer->stride);
+}
+
+void display_manager_presentDiscard(displayManager_buffer_t* buffer)
+{
+    if (!buffer || !buffer->double_buffered) {
+        return;
+    }
+    display_manager_flip(buffer);
+}
+
+// Pixels the compositor should show for a buffer
+static const uint8_t* display_manager_frontPixels(const displayManager_buffer_t* buffer)
+{
+    return buffer->double_buffered ? buffer->canvas[buffer->front] : buffer->buffer8;
+}
+
+esp_err_t display_manager_setBufferPalette(displayManager_buffer_t* buffer,
+                                           const uint32_t* colors,
+                                           uint32_t count)
+{
+    if (!buffer || !buffer->palette || !colors || count + 1 > buffer->palette_size) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(&buffer->palette[1], colors, count * sizeof(uint32_t));
+    buffer->palette_used = count + 1;
+    display_manager_markAllDirty(buffer);
+    return ESP_OK;
+}
+
 void display_manager_setBufferPixel(displayManager_buffer_t* buffer, 
                                           uint32_t x, 
                                           uint32_t y, 
@@ -71,30 +645,595 @@ void display_manager_setBufferPixel(displayManager_buffer_t* buffer,
     }
 
     // Set pixel in the buffer
-    buffer->buffer[y * buffer->width + x] = color;
+    switch (buffer->format)
+    {
+        case DISPLAY_FORMAT_RGB565:
+            buffer->buffer16[y * buffer->width + x] = display_manager_toRgb565(color);
+            break;
+
+        case DISPLAY_FORMAT_INDEXED8:
+            buffer->buffer8[y * buffer->stride + x] = display_manager_paletteIndex(buffer, color);
+            break;
+
+        case DISPLAY_FORMAT_INDEXED4:
+        {
+            uint8_t* pair = &buffer->buffer8[y * buffer->stride + (x >> 1)];
+            uint32_t index = display_manager_paletteIndex(buffer, color);
+            *pair = (x & 1) ? ((*pair & 0xF0) | index) : ((*pair & 0x0F) | (index << 4));
+            break;
+        }
+
+        default:
+            buffer->buffer[y * buffer->width + x] = color;
+            break;
+    }
+    display_manager_markDirty(buffer, x, y, 1, 1);
 }
 
-void display_manager_setRawPixel(uint32_t row, uint32_t col, uint32_t color)
+// A colour as stored in the buffer's format
+static uint32_t display_manager_storedColor(displayManager_buffer_t* buffer, uint32_t color)
 {
-    uint32_t pixelIndex = 0;
-    switch (rotation)
+    switch (buffer->format)
     {
-        case DISPLAY_ROTATION_270:
-            // Input cable is bottom right. Moving right increases column, moving down increses row
-            // (0, 0) is 248
-            // 0 is (7, 31)
-            if (col % 2 == 0) {
-                pixelIndex = (NEOPIXEL_NUM_COLS - 1 - col) * NEOPIXEL_NUM_ROWS + row;
-            } else {
-                pixelIndex = (NEOPIXEL_NUM_COLS - 1 - col) * NEOPIXEL_NUM_ROWS + (NEOPIXEL_NUM_ROWS - 1 - row);
+        case DISPLAY_FORMAT_RGB565:
+            return display_manager_toRgb565(color);
+
+        case DISPLAY_FORMAT_INDEXED8:
+        case DISPLAY_FORMAT_INDEXED4:
+            return display_manager_paletteIndex(buffer, color);
+
+        default:
+            return color;
+    }
+}
+
+// Set count pixels of a row, starting at (x, y), to a value from display_manager_storedColor
+static void display_manager_fillRow(displayManager_buffer_t* buffer,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t count, uint32_t value)
+{
+    uint8_t* row = buffer->buffer8 + y * buffer->stride;
+    switch (buffer->format)
+    {
+        case DISPLAY_FORMAT_RGB565:
+        {
+            uint16_t* dst = (uint16_t*)row + x;
+            while (count--) {
+                *dst++ = value;
+            }
+            break;
+        }
+
+        case DISPLAY_FORMAT_INDEXED8:
+            memset(row + x, value, count);
+            break;
+
+        case DISPLAY_FORMAT_INDEXED4:
+            // Odd ends share a byte with their neighbour, whole pairs in between are a memset
+            if ((x & 1) && count > 0) {
+                row[x >> 1] = (row[x >> 1] & 0xF0) | value;
+                x++;
+                count--;
+            }
+            memset(row + (x >> 1), value * 0x11, count >> 1);
+            if (count & 1) {
+                uint8_t* pair = &row[(x + count - 1) >> 1];
+                *pair = (*pair & 0x0F) | (value << 4);
             }
+            break;
+
+        default:
+        {
+            uint32_t* dst = (uint32_t*)row + x;
+            while (count--) {
+                *dst++ = value;
+            }
+            break;
+        }
+    }
+}
+
+void display_manager_fillBufferRect(displayManager_buffer_t* buffer,
+                                    uint32_t x, uint32_t y,
+                                    uint32_t width, uint32_t height,
+                                    uint32_t color)
+{
+    if (!buffer || x >= buffer->width || y >= buffer->height) {
+        return;
+    }
+    width = MIN(width, buffer->width - x);
+    height = MIN(height, buffer->height - y);
+
+    uint32_t value = display_manager_storedColor(buffer, color);
+    for (uint32_t row = y; row < y + height; row++) {
+        display_manager_fillRow(buffer, x, row, width, value);
+    }
+    display_manager_markDirty(buffer, x, y, width, height);
+}
+
+// Write count RGB888 colours into a row of any format, starting at (x, y)
+static void display_manager_storeRow(displayManager_buffer_t* buffer,
+                                     uint32_t x, uint32_t y,
+                                     uint32_t count, const uint32_t* colors)
+{
+    uint8_t* row = buffer->buffer8 + y * buffer->stride;
+    switch (buffer->format)
+    {
+        case DISPLAY_FORMAT_RGB565:
+        {
+            uint16_t* dst = (uint16_t*)row + x;
+            for (uint32_t i = 0; i < count; i++) {
+                dst[i] = display_manager_toRgb565(colors[i]);
+            }
+            break;
+        }
+
+        case DISPLAY_FORMAT_INDEXED8:
+            for (uint32_t i = 0; i < count; i++) {
+                row[x + i] = display_manager_paletteIndex(buffer, colors[i]);
+            }
+            break;
+
+        case DISPLAY_FORMAT_INDEXED4:
+            for (uint32_t i = 0; i < count; i++) {
+                uint32_t px = x + i;
+                uint32_t index = display_manager_paletteIndex(buffer, colors[i]);
+                uint8_t* pair = &row[px >> 1];
+                *pair = (px & 1) ? ((*pair & 0xF0) | index) : ((*pair & 0x0F) | (index << 4));
+            }
+            break;
+
+        default:
+            memcpy((uint32_t*)row + x, colors, count * sizeof(uint32_t));
+            break;
+    }
+}
+
+#define DISPLAY_COPY_CHUNK 32 // Pixels converted at a time when the formats differ
+
+void display_manager_copyBufferRect(displayManager_buffer_t* dst,
+                                    uint32_t x, uint32_t y,
+                                    const displayManager_buffer_t* src,
+                                    uint32_t src_x, uint32_t src_y,
+                                    uint32_t width, uint32_t height)
+{
+    if (!dst || !src || x >= dst->width || y >= dst->height ||
+        src_x >= src->width || src_y >= src->height) {
+        return;
+    }
+    width = MIN(width, MIN(dst->width - x, src->width - src_x));
+    height = MIN(height, MIN(dst->height - y, src->height - src_y));
+    if (width == 0 || height == 0) {
+        return;
+    }
+
+    // A block moved within one buffer is copied in the order that reads each pixel before it is overwritten
+    bool upward = (src == dst && y > src_y);
+    bool leftward = (src == dst && x > src_x);
+
+    // Same pixel encoding: straight row copies. Palette indexes only mean the same within one buffer
+    bool raw = (dst->format == src->format) &&
+               (dst->format == DISPLAY_FORMAT_RGB888 || dst->format == DISPLAY_FORMAT_RGB565 ||
+                (dst->format == DISPLAY_FORMAT_INDEXED8 && src == dst));
+    uint32_t bytesPerPixel = (dst->format == DISPLAY_FORMAT_RGB888) ? sizeof(uint32_t) :
+                             (dst->format == DISPLAY_FORMAT_RGB565) ? sizeof(uint16_t) : 1;
+
+    const uint8_t* srcPixels = src->buffer8;
+    for (uint32_t i = 0; i < height; i++) {
+        uint32_t row = upward ? height - 1 - i : i;
+        if (raw) {
+            memmove(dst->buffer8 + (y + row) * dst->stride + x * bytesPerPixel,
+                    srcPixels + (src_y + row) * src->stride + src_x * bytesPerPixel,
+                    width * bytesPerPixel);
+            continue;
+        }
+        uint32_t line[DISPLAY_COPY_CHUNK];
+        for (uint32_t done = 0; done < width; done += DISPLAY_COPY_CHUNK) {
+            uint32_t count = MIN(width - done, DISPLAY_COPY_CHUNK);
+            uint32_t offset = leftward ? width - done - count : done;
+            const uint32_t* colors = display_manager_expandRow(src, srcPixels, src_x + offset,
+                                                               src_y + row, count, line);
+            display_manager_storeRow(dst, x + offset, y + row, count, colors);
+        }
+    }
+    display_manager_markDirty(dst, x, y, width, height);
+}
+
+void display_manager_markDirty(displayManager_buffer_t* buffer,
+                               uint32_t x,
+                               uint32_t y,
+                               uint32_t width,
+                               uint32_t height)
+{
+    if (!buffer || width == 0 || height == 0 || x >= buffer->width || y >= buffer->height) {
+        return;
+    }
+    if (buffer->double_buffered) {
+        return; // Back canvas changes only show up through display_manager_present
+    }
+    uint32_t x1 = MIN(x + width, buffer->width) - 1;
+    uint32_t y1 = MIN(y + height, buffer->height) - 1;
+
+    taskENTER_CRITICAL(&dm_lock);
+    bool wake = !buffer->dirty; // Only the first change since the last frame needs to wake it
+    if (!buffer->dirty) {
+        buffer->dirty_x0 = x;
+        buffer->dirty_y0 = y;
+        buffer->dirty_x1 = x1;
+        buffer->dirty_y1 = y1;
+        buffer->dirty = true;
+    } else {
+        buffer->dirty_x0 = MIN(buffer->dirty_x0, x);
+        buffer->dirty_y0 = MIN(buffer->dirty_y0, y);
+        buffer->dirty_x1 = MAX(buffer->dirty_x1, x1);
+        buffer->dirty_y1 = MAX(buffer->dirty_y1, y1);
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+    if (wake) {
+        display_manager_wake();
+    }
+}
+
+esp_err_t display_manager_setBufferView(displayManager_buffer_t* buffer,
+                                        uint32_t view_width,
+                                        uint32_t view_height,
+                                        bool wrap)
+{
+    if (!buffer || view_width == 0 || view_height == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // The compositor picks the new view up as a whole, like a move
+    taskENTER_CRITICAL(&dm_lock);
+    buffer->view_width = view_width;
+    buffer->view_height = view_height;
+    buffer->wrap = wrap;
+    if (wrap) {
+        buffer->scroll_x = display_manager_wrapCoord(buffer->scroll_x, buffer->width);
+        buffer->scroll_y = display_manager_wrapCoord(buffer->scroll_y, buffer->height);
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+    display_manager_wake();
+    return ESP_OK;
+}
+
+void display_manager_setBufferScroll(displayManager_buffer_t* buffer, int32_t scroll_x, int32_t scroll_y)
+{
+    if (!buffer) {
+        return;
+    }
+    taskENTER_CRITICAL(&dm_lock);
+    if (buffer->wrap) {
+        // Keep the offsets small so apps can scroll forever by incrementing
+        scroll_x = display_manager_wrapCoord(scroll_x, buffer->width);
+        scroll_y = display_manager_wrapCoord(scroll_y, buffer->height);
+    }
+    buffer->scroll_x = scroll_x;
+    buffer->scroll_y = scroll_y;
+    taskEXIT_CRITICAL(&dm_lock);
+    display_manager_wake();
+}
+
+void display_manager_setBufferActive(displayManager_buffer_t* buffer, bool active)
+{
+    if (!buffer) {
+        return;
+    }
+    // The compositor notices the change and redraws the area the buffer covers
+    if (buffer->active != active) {
+        buffer->active = active;
+        display_manager_wake();
+    }
+}
+
+void display_manager_setBufferOpacity(displayManager_buffer_t* buffer, uint8_t opacity)
+{
+    if (!buffer || buffer->opacity == opacity) {
+        return;
+    }
+    buffer->opacity = opacity;
+    display_manager_markAllDirty(buffer);
+}
+
+void display_manager_setBufferPixelAlpha(displayManager_buffer_t* buffer, bool enable)
+{
+    if (!buffer || buffer->pixel_alpha == enable) {
+        return;
+    }
+    if (buffer->format != DISPLAY_FORMAT_RGB888 || buffer->double_buffered) {
+        LOGE("Per-pixel alpha needs a single-buffered RGB888 buffer");
+        return;
+    }
+    // Both encodings read as "nothing drawn" after the switch
+    uint32_t clear = enable ? 0x00000000 : TRANSPARENT;
+    for (uint32_t i = 0; i < buffer->width * buffer->height; i++) {
+        buffer->buffer[i] = clear;
+    }
+    buffer->pixel_alpha = enable;
+    display_manager_markAllDirty(buffer);
+}
+
+uint32_t display_manager_getFrameCount(void)
+{
+    return dm_ctx.frame_count;
+}
+
+uint32_t display_manager_msToFrames(uint32_t ms)
+{
+    return MAX(1, ms / DISPLAY_MANAGER_FRAME_PERIOD_MS);
+}
+
+// Claim a waiter slot for task, due frames ticks from now. Returns the slot, or -1
+// if the table is full
+static int32_t display_manager_addWaiter(TaskHandle_t task, uint32_t frames)
+{
+    int32_t slot = -1;
+    taskENTER_CRITICAL(&dm_lock);
+    // An idling display task counts the periods it slept through only when it wakes
+    uint32_t frame = dm_ctx.frame_count;
+    if (dm_ctx.task != NULL) {
+        frame += (xTaskGetTickCount() - dm_ctx.last_tick) / DISPLAY_MANAGER_PERIOD_TICKS;
+    }
+    for (uint32_t i = 0; i < DISPLAY_MANAGER_MAX_WAITERS; i++) {
+        if (dm_ctx.waiters[i].task == NULL) {
+            dm_ctx.waiters[i].task = task;
+            dm_ctx.waiters[i].target = frame + MAX(frames, 1);
+            slot = i;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+    return slot;
+}
+
+bool display_manager_waitFrames(uint32_t frames)
+{
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    int32_t slot = display_manager_addWaiter(self, frames);
+    if (slot < 0) {
+        LOGE("Too many tasks waiting for frames");
+        vTaskDelay(pdMS_TO_TICKS(frames * DISPLAY_MANAGER_FRAME_PERIOD_MS));
+        return false;
+    }
+    display_manager_wake(); // An idle display task shortens its sleep to this wait
+
+    // Allow for a slow frame or two before assuming the compositor has stopped
+    TickType_t timeout = pdMS_TO_TICKS((frames + 2) * DISPLAY_MANAGER_FRAME_PERIOD_MS * 2);
+    if (ulTaskNotifyTake(pdTRUE, timeout) > 0) {
+        return true;
+    }
+
+    taskENTER_CRITICAL(&dm_lock);
+    bool pending = (dm_ctx.waiters[slot].task == self);
+    dm_ctx.waiters[slot].task = NULL;
+    taskEXIT_CRITICAL(&dm_lock);
+    if (!pending) {
+        // Claimed just after timing out. frameTick notifies outside the lock, so the give
+        // may not have landed yet: wait for it rather than leave it to end the next wait early
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        return true;
+    }
+    return false;
+}
+
+// Count frame periods and wake tasks whose wait is over
+static void display_manager_frameTick(uint32_t frames, TickType_t period)
+{
+    TaskHandle_t wake[DISPLAY_MANAGER_MAX_WAITERS];
+    uint32_t numWake = 0;
+
+    taskENTER_CRITICAL(&dm_lock);
+    dm_ctx.last_tick += frames * period; // Together with the count, for display_manager_addWaiter
+    uint32_t frame = dm_ctx.frame_count += frames;
+    for (uint32_t i = 0; i < DISPLAY_MANAGER_MAX_WAITERS; i++) {
+        TaskHandle_t task = dm_ctx.waiters[i].task;
+        if (task != NULL && (int32_t)(frame - dm_ctx.waiters[i].target) >= 0) {
+            dm_ctx.waiters[i].task = NULL;
+            wake[numWake++] = task;
+        }
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+
+    // Notify outside the critical section, the scheduler may switch to them
+    for (uint32_t i = 0; i < numWake; i++) {
+        xTaskNotifyGive(wake[i]);
+    }
+}
+
+// How long the display task may sleep with nothing changing: until the next
+// potentiometer poll or until the first waiting task is due, whichever is sooner.
+// elapsed is the time since the last tick
+static TickType_t display_manager_idleTimeout(TickType_t period, TickType_t elapsed)
+{
+    TickType_t timeout = pdMS_TO_TICKS(DISPLAY_MANAGER_IDLE_POLL_MS);
+    taskENTER_CRITICAL(&dm_lock);
+    for (uint32_t i = 0; i < DISPLAY_MANAGER_MAX_WAITERS; i++) {
+        if (dm_ctx.waiters[i].task != NULL) {
+            int32_t frames = (int32_t)(dm_ctx.waiters[i].target - dm_ctx.frame_count);
+            timeout = MIN(timeout, (TickType_t)MAX(frames, 1) * period - elapsed);
+        }
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+    return timeout;
+}
+
+// Ticks follow the clock, one per frame period, so frame counts stay a measure of
+// time. An idle stretch is counted in one go when the task wakes. composed says
+// whether this pass sent a frame. Returns the time since the last tick
+static TickType_t display_manager_countFrames(TickType_t now, TickType_t period, bool composed)
+{
+    uint32_t frames = (now - dm_ctx.last_tick) / period;
+    dm_ctx.period_composed = dm_ctx.period_composed || composed;
+    if (frames > 0) {
+        if (dm_ctx.initialized) {
+            // Periods that sent nothing; the LEDs already showed those frames
+            dm_ctx.frames_skipped += frames - (dm_ctx.period_composed ? 1 : 0);
+        }
+        dm_ctx.period_composed = false;
+        display_manager_frameTick(frames, period); // Apps woken here draw in time for the next frame
+    }
+    return now - dm_ctx.last_tick;
+}
+
+void display_manager_getFrameCounts(uint32_t* composed, uint32_t* skipped)
+{
+    if (composed) {
+        *composed = dm_ctx.frames_composed;
+    }
+    if (skipped) {
+        *skipped = dm_ctx.frames_skipped;
+    }
+}
+
+// Map a logical pixel to its LED index for a rows x cols display. Only used to
+// build index_map, so the per-frame cost is a single table load
+static uint32_t display_manager_physicalIndex(uint32_t row, uint32_t col,
+                                              uint32_t rows, uint32_t cols,
+                                              displayManager_rotation_E rot,
+                                              displayManager_wiring_E wire,
+                                              bool mirrored)
+{
+    if (mirrored) {
+        col = cols - 1 - col;
+    }
+
+    // Position on the panel in its native orientation (LED 0 at native (0, 0))
+    uint32_t nativeRow = row;
+    uint32_t nativeCol = col;
+    uint32_t nativeRows = rows;
+    uint32_t nativeCols = cols;
+    switch (rot)
+    {
+        case DISPLAY_ROTATION_0:
+            break;
+
+        case DISPLAY_ROTATION_90:
+            nativeRow = col;
+            nativeCol = rows - 1 - row;
+            nativeRows = cols;
+            nativeCols = rows;
+            break;
 
+        case DISPLAY_ROTATION_180:
+            nativeRow = rows - 1 - row;
+            nativeCol = cols - 1 - col;
             break;
-        
+
+        case DISPLAY_ROTATION_270:
+            nativeRow = cols - 1 - col;
+            nativeCol = row;
+            nativeRows = cols;
+            nativeCols = rows;
+            break;
+
         default:
-            LOGE("Invalid rotation value: %d", rotation);
+            LOGE("Invalid rotation value: %d", rot);
             break;
     }
+
+    if (wire == DISPLAY_WIRING_COLUMN_SERPENTINE) {
+        uint32_t offset = (nativeCol % 2 == 0) ? nativeRow : (nativeRows - 1 - nativeRow);
+        return nativeCol * nativeRows + offset;
+    }
+    uint32_t offset = (nativeRow % 2 == 0) ? nativeCol : (nativeCols - 1 - nativeCol);
+    return nativeRow * nativeCols + offset;
+}
+
+static uint16_t* display_manager_buildIndexMap(uint32_t rows, uint32_t cols,
+                                               displayManager_rotation_E rot,
+                                               displayManager_wiring_E wire,
+                                               bool mirrored)
+{
+    uint16_t* map = heap_caps_malloc(rows * cols * sizeof(uint16_t), MALLOC_CAP_8BIT);
+    if (!map) {
+        return NULL;
+    }
+    for (uint32_t row = 0; row < rows; row++) {
+        for (uint32_t col = 0; col < cols; col++) {
+            map[row * cols + col] = (uint16_t)display_manager_physicalIndex(row, col, rows, cols,
+                                                                             rot, wire, mirrored);
+        }
+    }
+    return map;
+}
+
+// Geometry from genealogy, with the build's defaults for anything not stored. A stored
+// size is only taken with stored_size, and when it is within DISPLAY_MANAGER_MAX_PIXELS
+static void display_manager_loadGeometry(bool stored_size)
+{
+    genealogy_geometry_t stored;
+    genealogy_get_geometry(&stored);
+
+    dm_ctx.rows = NEOPIXEL_NUM_ROWS;
+    dm_ctx.cols = NEOPIXEL_NUM_COLS;
+    dm_ctx.rotation = defaultRotation;
+    dm_ctx.wiring = defaultWiring;
+    if (stored_size && stored.rows != GENEALOGY_UNSET && stored.rows > 0 &&
+        stored.cols != GENEALOGY_UNSET && stored.cols > 0 &&
+        stored.rows * stored.cols <= DISPLAY_MANAGER_MAX_PIXELS) {
+        dm_ctx.rows = stored.rows;
+        dm_ctx.cols = stored.cols;
+    }
+    if (stored.rotation <= DISPLAY_ROTATION_270) {
+        dm_ctx.rotation = stored.rotation;
+    }
+    if (stored.wiring <= DISPLAY_WIRING_COLUMN_SERPENTINE) {
+        dm_ctx.wiring = stored.wiring;
+    }
+    dm_ctx.num_pixels = dm_ctx.rows * dm_ctx.cols;
+    dm_ctx.max_order = 0;
+    while (display_manager_blockSize(dm_ctx.max_order) < dm_ctx.num_pixels * sizeof(uint32_t)) {
+        dm_ctx.max_order++;
+    }
+    dm_ctx.chunk_size = display_manager_blockSize(dm_ctx.max_order);
+    LOGI("Display geometry %lux%lu, rotation %d, wiring %d",
+         dm_ctx.rows, dm_ctx.cols, dm_ctx.rotation, dm_ctx.wiring);
+}
+
+void display_manager_getGeometry(uint32_t* rows, uint32_t* cols,
+                                 displayManager_wiring_E* wiring,
+                                 displayManager_rotation_E* rotation)
+{
+    *rows = dm_ctx.rows;
+    *cols = dm_ctx.cols;
+    *wiring = dm_ctx.wiring;
+    *rotation = dm_ctx.rotation;
+}
+
+esp_err_t display_manager_saveGeometry(uint32_t rows, uint32_t cols,
+                                       displayManager_wiring_E wiring,
+                                       displayManager_rotation_E rotation)
+{
+    // GENEALOGY_UNSET is not a valid size, and the driver sends at most DISPLAY_MANAGER_MAX_PIXELS
+    if (rows == 0 || rows >= GENEALOGY_UNSET || cols == 0 || cols >= GENEALOGY_UNSET ||
+        rows * cols > DISPLAY_MANAGER_MAX_PIXELS ||
+        wiring > DISPLAY_WIRING_COLUMN_SERPENTINE || rotation > DISPLAY_ROTATION_270) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    genealogy_geometry_t geometry = {
+        .rows = rows,
+        .cols = cols,
+        .wiring = wiring,
+        .rotation = rotation,
+    };
+    return genealogy_set_geometry(&geometry);
+}
+
+uint32_t display_manager_getWidth(void)
+{
+    return dm_ctx.cols;
+}
+
+uint32_t display_manager_getHeight(void)
+{
+    return dm_ctx.rows;
+}
+
+void display_manager_setRawPixel(uint32_t row, uint32_t col, uint32_t color)
+{
+    if (!dm_ctx.index_map || row >= dm_ctx.rows || col >= dm_ctx.cols) {
+        return;
+    }
+    uint32_t pixelIndex = dm_ctx.index_map[row * dm_ctx.cols + col];
     neopixel_driver_setPixel(pixelIndex, color);
     // LOGD("Setting pixel at (%ld, %ld) to color %06lX (%lu)", row, col, color, pixelIndex);
 }
@@ -105,23 +1244,132 @@ void display_manager_clearScreen(void)
 }
 
 
-esp_err_t display_manager_init(void)
+// Keep dm_ctx.buffers sorted back to front. Caller holds dm_lock
+static void display_manager_insertSorted(displayManager_buffer_t* buffer)
 {
-    if (dm_ctx.initialized) {
-        return ESP_OK;
+    uint32_t i = dm_ctx.num_buffers;
+    while (i > 0 && (dm_ctx.buffers[i - 1]->layer > buffer->layer ||
+                     (dm_ctx.buffers[i - 1]->layer == buffer->layer &&
+                      dm_ctx.buffers[i - 1]->order > buffer->order))) {
+        dm_ctx.buffers[i] = dm_ctx.buffers[i - 1];
+        i--;
+    }
+    dm_ctx.buffers[i] = buffer;
+    dm_ctx.num_buffers++;
+}
+
+// Caller holds dm_lock
+static bool display_manager_removeSorted(displayManager_buffer_t* buffer)
+{
+    for (uint32_t i = 0; i < dm_ctx.num_buffers; i++) {
+        if (dm_ctx.buffers[i] == buffer) {
+            memmove(&dm_ctx.buffers[i], &dm_ctx.buffers[i + 1],
+                    (dm_ctx.num_buffers - i - 1) * sizeof(dm_ctx.buffers[0]));
+            dm_ctx.num_buffers--;
+            return true;
+        }
     }
+    return false;
+}
+
+void display_manager_setBufferOrder(displayManager_buffer_t* buffer,
+                                    displayManager_layer_E layer,
+                                    uint8_t order)
+{
+    if (!buffer || (buffer->layer == layer && buffer->order == order)) {
+        return;
+    }
+    taskENTER_CRITICAL(&dm_lock);
+    display_manager_removeSorted(buffer);
+    buffer->layer = layer;
+    buffer->order = order;
+    display_manager_insertSorted(buffer);
+    taskEXIT_CRITICAL(&dm_lock);
+    display_manager_markAllDirty(buffer);
+}
+
+static void display_manager_freeFrameBuffers(void)
+{
+    free(dm_ctx.output_buffer);
+    dm_ctx.output_buffer = NULL;
+    free(dm_ctx.physical_buffer);
+    dm_ctx.physical_buffer = NULL;
+    free(dm_ctx.index_map);
+    dm_ctx.index_map = NULL;
+    free(dm_ctx.line_buffer);
+    dm_ctx.line_buffer = NULL;
+    free(dm_ctx.coverage);
+    dm_ctx.coverage = NULL;
+    free(dm_ctx.row_remaining);
+    dm_ctx.row_remaining = NULL;
+    for (uint32_t i = 0; i < dm_ctx.num_chunks; i++) {
+        free(dm_ctx.chunks[i]);
+    }
+    dm_ctx.num_chunks = 0;
+    memset(dm_ctx.free_blocks, 0, sizeof(dm_ctx.free_blocks));
+    free(dm_ctx.block_state);
+    dm_ctx.block_state = NULL;
+}
 
+// Frame buffers and the driver's LEDs for the loaded geometry
+static esp_err_t display_manager_allocFrameBuffers(void)
+{
     // Allocate output buffer
-    LOGD("Allocating output buffer of size %u bytes", 
-         NEOPIXEL_NUM_ROWS * NEOPIXEL_NUM_COLS * sizeof(uint32_t));
-    dm_ctx.output_buffer = heap_caps_calloc(NEOPIXEL_NUM_ROWS * NEOPIXEL_NUM_COLS, 
+    LOGD("Allocating output buffer of size %u bytes",
+         dm_ctx.num_pixels * sizeof(uint32_t));
+    dm_ctx.output_buffer = heap_caps_calloc(dm_ctx.num_pixels,
                                           sizeof(uint32_t), 
                                           MALLOC_CAP_8BIT);
-    if (!dm_ctx.output_buffer) {
-        LOGE("Failed to allocate output buffer");
+    dm_ctx.physical_buffer = heap_caps_calloc(dm_ctx.num_pixels,
+                                            sizeof(uint32_t),
+                                            MALLOC_CAP_8BIT);
+    dm_ctx.index_map = display_manager_buildIndexMap(dm_ctx.rows, dm_ctx.cols,
+                                                     dm_ctx.rotation, dm_ctx.wiring, mirror);
+    dm_ctx.line_buffer = heap_caps_calloc(dm_ctx.cols, sizeof(uint32_t), MALLOC_CAP_8BIT);
+    dm_ctx.coverage = heap_caps_calloc(dm_ctx.num_pixels, sizeof(uint16_t), MALLOC_CAP_8BIT);
+    dm_ctx.row_remaining = heap_caps_calloc(dm_ctx.rows, sizeof(uint16_t), MALLOC_CAP_8BIT);
+    // Pool chunks themselves are only taken once buffers need them
+    dm_ctx.block_state = heap_caps_calloc(DISPLAY_MANAGER_POOL_CHUNKS * (dm_ctx.chunk_size / DISPLAY_MANAGER_POOL_MIN_BLOCK),
+                                          sizeof(uint8_t), MALLOC_CAP_8BIT);
+    if (!dm_ctx.output_buffer || !dm_ctx.physical_buffer || !dm_ctx.index_map ||
+        !dm_ctx.line_buffer || !dm_ctx.coverage || !dm_ctx.row_remaining || !dm_ctx.block_state) {
+        LOGE("Failed to allocate frame buffers for %lu pixels", dm_ctx.num_pixels);
+        display_manager_freeFrameBuffers();
         return ESP_ERR_NO_MEM;
     }
 
+    esp_err_t err = neopixel_driver_configure(dm_ctx.num_pixels);
+    if (err != ESP_OK) {
+        LOGE("Failed to configure NeoPixel driver for %lu LEDs", dm_ctx.num_pixels);
+        display_manager_freeFrameBuffers();
+    }
+    return err;
+}
+
+esp_err_t display_manager_init(void)
+{
+    if (dm_ctx.initialized) {
+        return ESP_OK;
+    }
+
+    display_manager_loadGeometry(true);
+    esp_err_t err = display_manager_allocFrameBuffers();
+    if (err != ESP_OK && dm_ctx.num_pixels != NEOPIXEL_NUM_ROWS * NEOPIXEL_NUM_COLS) {
+        // A stored geometry too large for this unit's heap must not leave it without a display
+        LOGW("Falling back to the default %dx%d geometry", NEOPIXEL_NUM_ROWS, NEOPIXEL_NUM_COLS);
+        display_manager_loadGeometry(false);
+        err = display_manager_allocFrameBuffers();
+    }
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    for (uint32_t i = 0; i < MAX_DISPLAY_BUFFERS; i++) {
+        dm_ctx.free_descriptors[i] = MAX_DISPLAY_BUFFERS - 1 - i;
+    }
+    dm_ctx.num_free_descriptors = MAX_DISPLAY_BUFFERS;
+
+    dm_ctx.full_redraw = true;
     dm_ctx.initialized = true;
     LOGI("Display manager initialized");
     return ESP_OK;
@@ -134,77 +1382,379 @@ displayManager_buffer_t* display_manager_create_buffer(const char* owner_name,
                                                      uint32_t y,
                                                      displayManager_layer_E layer)
 {
-    if (!dm_ctx.initialized || dm_ctx.num_buffers >= MAX_DISPLAY_BUFFERS) {
-        ESP_LOGE(TAG, "Display manager not initialized or maximum buffers reached");
+    return display_manager_create_buffer_ex(owner_name, width, height, x, y, layer,
+                                            DISPLAY_FORMAT_RGB888);
+}
+
+displayManager_buffer_t* display_manager_create_buffer_ex(const char* owner_name,
+                                                        uint32_t width,
+                                                        uint32_t height,
+                                                        uint32_t x,
+                                                        uint32_t y,
+                                                        displayManager_layer_E layer,
+                                                        displayManager_format_E format)
+{
+    if (!dm_ctx.initialized) {
+        ESP_LOGE(TAG, "Display manager not initialized");
+        return NULL;
+    }
+    if (width == 0 || height == 0) {
+        // Views and scrolling wrap modulo the canvas size
+        LOGE("Invalid buffer size %lux%lu", width, height);
         return NULL;
     }
 
-    displayManager_buffer_t* buffer = heap_caps_calloc(1, 
-                                                     sizeof(displayManager_buffer_t), 
-                                                     MALLOC_CAP_8BIT);
+    displayManager_buffer_t* buffer = display_manager_allocDescriptor();
     if (!buffer) {
+        ESP_LOGE(TAG, "Maximum buffers reached");
         return NULL;
     }
 
-    buffer->buffer = heap_caps_calloc(width * height, 
-                                    sizeof(uint32_t), 
-                                    MALLOC_CAP_8BIT);
+    uint32_t paletteSize = 0;
+    switch (format)
+    {
+        case DISPLAY_FORMAT_RGB888:
+            buffer->stride = width * sizeof(uint32_t);
+            break;
+        case DISPLAY_FORMAT_RGB565:
+            buffer->stride = width * sizeof(uint16_t);
+            break;
+        case DISPLAY_FORMAT_INDEXED8:
+            buffer->stride = width;
+            paletteSize = 256;
+            break;
+        case DISPLAY_FORMAT_INDEXED4:
+            buffer->stride = (width + 1) / 2;
+            paletteSize = 16;
+            break;
+        default:
+            LOGE("Invalid pixel format: %d", format);
+            display_manager_freeDescriptor(buffer);
+            return NULL;
+    }
 
-    memset(buffer->buffer, TRANSPARENT, width * height * sizeof(uint32_t)); // Initialize buffer to transparent
-    if (!buffer->buffer) {
-        free(buffer);
+    // Pixels and palette share one block, palette word aligned after the pixels
+    size_t pixelBytes = height * buffer->stride;
+    size_t paletteOffset = (pixelBytes + 3) & ~3;
+    buffer->storage_size = paletteOffset + paletteSize * sizeof(uint32_t);
+    buffer->storage = display_manager_allocPixels(buffer->storage_size);
+    if (!buffer->storage) {
+        display_manager_freeDescriptor(buffer);
         return NULL;
     }
+    buffer->buffer8 = buffer->storage;
+
+    // TRANSPARENT is all 0xFF bytes; every other format is transparent when zeroed
+    memset(buffer->buffer8, (format == DISPLAY_FORMAT_RGB888) ? 0xFF : 0x00, pixelBytes);
+
+    if (paletteSize) {
+        buffer->palette = (uint32_t*)&buffer->storage[paletteOffset];
+        memset(buffer->palette, 0, paletteSize * sizeof(uint32_t));
+        buffer->palette[DISPLAY_PALETTE_TRANSPARENT_INDEX] = TRANSPARENT;
+        buffer->palette_size = paletteSize;
+        buffer->palette_used = 1;
+    }
+
+    buffer->format = format;
 
     buffer->width = width;
     buffer->height = height;
     buffer->x = x;
     buffer->y = y;
+    buffer->view_width = width;
+    buffer->view_height = height;
     buffer->layer = layer;
     buffer->active = true;
     buffer->opacity = 255;
     buffer->owner = owner_name;
 
-    dm_ctx.buffers[dm_ctx.num_buffers++] = buffer;
+    // Holding a descriptor guarantees room in the list
+    taskENTER_CRITICAL(&dm_lock);
+    display_manager_insertSorted(buffer);
+    taskEXIT_CRITICAL(&dm_lock);
+    display_manager_wake();
     return buffer;
 }
 
-static void merge_buffers(void)
+void display_manager_free_buffer(displayManager_buffer_t* buffer)
 {
-    // Clear output buffer
-    memset(dm_ctx.output_buffer, 0, NEOPIXEL_NUM_ROWS * NEOPIXEL_NUM_COLS * sizeof(uint32_t));
+    if (!buffer) {
+        return;
+    }
 
-    // Sort buffers by layer
-    for (displayManager_layer_E layer = DISPLAY_MANAGER_LAYER_BACKGROUND; 
-         layer <= DISPLAY_MANAGER_LAYER_SYSTEM; 
-         layer++) {
-        
-        // Process each buffer in the current layer
-        for (uint32_t i = 0; i < dm_ctx.num_buffers; i++) {
-            displayManager_buffer_t* buf = dm_ctx.buffers[i];
-            if (!buf->active || buf->layer != layer) {
-                continue;
+    taskENTER_CRITICAL(&dm_lock);
+    bool found = display_manager_removeSorted(buffer);
+    if (found) {
+        // Recompose what it covered without it. The compositor may still be reading
+        // it this frame, so the memory is reclaimed at the start of the next one
+        if (buffer->composed_active) {
+            display_manager_rectUnion(&dm_ctx.freed_rect, &dm_ctx.freed_dirty,
+                                      buffer->composed_x, buffer->composed_y,
+                                      buffer->composed_view_width, buffer->composed_view_height);
+        }
+        dm_ctx.pending_free[dm_ctx.num_pending_free++] = buffer;
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+
+    if (found) {
+        display_manager_wake();
+    } else {
+        LOGE("Buffer %p is not allocated", buffer);
+    }
+}
+
+// Replay display lists submitted since the last frame into their buffers, so
+// collect_dirty picks the changes up. Lists are replayed outside the lock
+static void display_manager_rasterizeLists(void)
+{
+    displayList_t* lists[MAX_DISPLAY_BUFFERS];
+    uint32_t numLists = 0;
+    taskENTER_CRITICAL(&dm_lock);
+    for (uint32_t i = 0; i < dm_ctx.num_buffers; i++) {
+        displayManager_buffer_t* buf = dm_ctx.buffers[i];
+        displayList_t* list = __atomic_load_n(&buf->display_list, __ATOMIC_ACQUIRE);
+        if (buf->active && list) {
+            lists[numLists++] = list;
+        }
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+    for (uint32_t i = 0; i < numLists; i++) {
+        display_list_rasterize(lists[i]);
+    }
+}
+
+// Take and clear every buffer's dirty state, returning the screen area to recompose
+static bool collect_dirty(display_manager_rect_t* rect)
+{
+    bool any = false;
+
+    // Reclaim buffers freed since the last frame; the compositor let go of them when it finished
+    displayManager_buffer_t* reclaim[MAX_DISPLAY_BUFFERS];
+    taskENTER_CRITICAL(&dm_lock);
+    uint32_t numReclaim = dm_ctx.num_pending_free;
+    memcpy(reclaim, dm_ctx.pending_free, numReclaim * sizeof(reclaim[0]));
+    dm_ctx.num_pending_free = 0;
+    if (dm_ctx.freed_dirty) {
+        *rect = dm_ctx.freed_rect;
+        any = true;
+        dm_ctx.freed_dirty = false;
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+    for (uint32_t i = 0; i < numReclaim; i++) {
+        display_manager_releaseBuffer(reclaim[i]);
+    }
+
+    if (dm_ctx.full_redraw) {
+        display_manager_rectUnion(rect, &any, 0, 0, dm_ctx.cols, dm_ctx.rows);
+        dm_ctx.full_redraw = false;
+    }
+
+    taskENTER_CRITICAL(&dm_lock);
+    for (uint32_t i = 0; i < dm_ctx.num_buffers; i++) {
+        displayManager_buffer_t* buf = dm_ctx.buffers[i];
+        bool active = buf->active;
+        if (buf->double_buffered &&
+            (__atomic_load_n(&buf->ready, __ATOMIC_ACQUIRE) & DISPLAY_CANVAS_FRESH)) {
+            // Newly presented canvas: show it and give the app the old front back
+            uint32_t presented = __atomic_exchange_n(&buf->ready, buf->front, __ATOMIC_ACQ_REL);
+            buf->front = presented & ~DISPLAY_CANVAS_FRESH;
+            if (active && buf->composed_active) {
+                display_manager_rectUnion(rect, &any, buf->composed_x, buf->composed_y,
+                                          buf->composed_view_width, buf->composed_view_height);
+            }
+        }
+        if (active != buf->composed_active || buf->x != buf->composed_x || buf->y != buf->composed_y ||
+            buf->view_width != buf->composed_view_width || buf->view_height != buf->composed_view_height ||
+            buf->scroll_x != buf->composed_scroll_x || buf->scroll_y != buf->composed_scroll_y ||
+            buf->wrap != buf->composed_wrap) {
+            // Shown, hidden, moved or scrolled: redraw both where it was and where it is now
+            if (buf->composed_active) {
+                display_manager_rectUnion(rect, &any, buf->composed_x, buf->composed_y,
+                                          buf->composed_view_width, buf->composed_view_height);
             }
+            if (active) {
+                display_manager_rectUnion(rect, &any, buf->x, buf->y, buf->view_width, buf->view_height);
+            }
+            buf->composed_active = active;
+            buf->composed_x = buf->x;
+            buf->composed_y = buf->y;
+            buf->composed_view_width = buf->view_width;
+            buf->composed_view_height = buf->view_height;
+            buf->composed_scroll_x = buf->scroll_x;
+            buf->composed_scroll_y = buf->scroll_y;
+            buf->composed_wrap = buf->wrap;
+        } else if (active && buf->dirty) {
+            // Dirty canvas area, as far as it is inside the view
+            uint32_t vx0, vy0, vx1, vy1;
+            if (display_manager_viewSpan(buf->dirty_x0, buf->dirty_x1, buf->scroll_x, buf->width,
+                                         buf->view_width, buf->wrap, &vx0, &vx1) &&
+                display_manager_viewSpan(buf->dirty_y0, buf->dirty_y1, buf->scroll_y, buf->height,
+                                         buf->view_height, buf->wrap, &vy0, &vy1)) {
+                display_manager_rectUnion(rect, &any, buf->x + vx0, buf->y + vy0,
+                                          vx1 - vx0 + 1, vy1 - vy0 + 1);
+            }
+        }
+        buf->dirty = false;
+    }
+    taskEXIT_CRITICAL(&dm_lock);
+    return any;
+}
+
+// Add src weighted by w (0-256) to an accumulated colour. Red and blue share one
+// multiply and green gets another. The weights landing on a pixel sum to at most
+// 256, so no channel can carry into its neighbour
+static inline uint32_t display_manager_accumulate(uint32_t acc, uint32_t src, uint32_t w)
+{
+    return acc + ((((src & 0xFF00FF) * w) >> 8) & 0xFF00FF) + ((((src & 0x00FF00) * w) >> 8) & 0x00FF00);
+}
 
-            // Copy buffer contents to output buffer with position offset
-            for (uint32_t y = 0; y < buf->height; y++) {
-                for (uint32_t x = 0; x < buf->width; x++) {
-                    uint32_t display_x = buf->x + x;
-                    uint32_t display_y = buf->y + y;
-                    
-                    if (display_x >= NEOPIXEL_NUM_COLS || display_y >= NEOPIXEL_NUM_ROWS) {
+static void merge_buffers(const display_manager_rect_t* rect)
+{
+    const uint32_t cols = dm_ctx.cols;
+    int32_t width = rect->x1 - rect->x0 + 1;
+    uint32_t remaining = 0; // Pixels in rect something below could still show through
+
+    // Clear the area being recomposed; every pixel starts fully uncovered
+    for (int32_t y = rect->y0; y <= rect->y1; y++) {
+        uint32_t start = y * cols + rect->x0;
+        memset(&dm_ctx.output_buffer[start], 0, width * sizeof(uint32_t));
+        for (int32_t x = 0; x < width; x++) {
+            dm_ctx.coverage[start + x] = 256;
+        }
+        dm_ctx.row_remaining[y] = width;
+        remaining += width;
+    }
+
+    displayManager_buffer_t* list[MAX_DISPLAY_BUFFERS];
+    taskENTER_CRITICAL(&dm_lock);
+    uint32_t num = dm_ctx.num_buffers;
+    memcpy(list, dm_ctx.buffers, num * sizeof(list[0]));
+    taskEXIT_CRITICAL(&dm_lock);
+
+    // Front to back, so pixels under opaque ones are never read and we can stop
+    // as soon as the whole area is covered
+    for (uint32_t i = num; i-- > 0 && remaining > 0; ) {
+        displayManager_buffer_t* buf = list[i];
+        if (!buf->active || buf->opacity == 0) {
+            continue;
+        }
+        // 0-255 opacity scaled to 0-256 so fully opaque blends exactly
+        uint32_t opacity = buf->opacity + (buf->opacity >> 7);
+
+        // Only the part of the view that overlaps the recomposed area
+        int32_t bx = buf->composed_x;
+        int32_t by = buf->composed_y;
+        int32_t sx0 = MAX(rect->x0, bx);
+        int32_t sy0 = MAX(rect->y0, by);
+        int32_t sx1 = MIN(rect->x1, bx + (int32_t)buf->composed_view_width - 1);
+        int32_t sy1 = MIN(rect->y1, by + (int32_t)buf->composed_view_height - 1);
+
+        // Canvas column shown at sx0
+        int32_t cx = sx0 - bx + buf->composed_scroll_x;
+        if (buf->composed_wrap) {
+            cx = display_manager_wrapCoord(cx, buf->width);
+        } else {
+            // Past the canvas edges the view shows nothing
+            if (cx < 0) {
+                sx0 -= cx;
+                cx = 0;
+            }
+            sx1 = MIN(sx1, sx0 + (int32_t)buf->width - cx - 1);
+        }
+
+        int32_t count = sx1 - sx0 + 1;
+        if (count <= 0) {
+            continue;
+        }
+
+        const uint8_t* pixels = display_manager_frontPixels(buf);
+        for (int32_t display_y = sy0; display_y <= sy1; display_y++) {
+            if (dm_ctx.row_remaining[display_y] == 0) {
+                continue; // Row already hidden by buffers in front
+            }
+            int32_t cy = display_y - by + buf->composed_scroll_y;
+            if (buf->composed_wrap) {
+                cy = display_manager_wrapCoord(cy, buf->height);
+            } else if (cy < 0 || cy >= (int32_t)buf->height) {
+                continue;
+            }
+            const uint32_t* src = display_manager_sampleRow(buf, pixels, cx, cy, count, dm_ctx.line_buffer);
+            uint32_t* dst = &dm_ctx.output_buffer[display_y * cols + sx0];
+            uint16_t* cover = &dm_ctx.coverage[display_y * cols + sx0];
+            uint32_t covered = 0;
+            if (buf->pixel_alpha) {
+                for (int32_t x = 0; x < count; x++) {
+                    uint32_t t = cover[x];
+                    uint32_t a = src[x] >> 24;
+                    a = ((a + (a >> 7)) * opacity) >> 8;
+                    if (t == 0 || a == 0) {
                         continue;
                     }
-
-                    uint32_t color = buf->buffer[y * buf->width + x];
-                    if (color != TRANSPARENT)
-                    {
-                        dm_ctx.output_buffer[display_y * NEOPIXEL_NUM_COLS + display_x] = color;
+                    // This layer gets a share of what is still uncovered and hides that much
+                    uint32_t w = (t * a) >> 8;
+                    dst[x] = (w == 256) ? (src[x] & 0xFFFFFF) : display_manager_accumulate(dst[x], src[x], w);
+                    cover[x] = t - w;
+                    covered += (w == t);
+                }
+            } else if (opacity == 256) {
+                for (int32_t x = 0; x < count; x++) {
+                    uint32_t t = cover[x];
+                    if (t == 0 || src[x] == TRANSPARENT) {
+                        continue;
                     }
+                    dst[x] = (t == 256) ? src[x] : display_manager_accumulate(dst[x], src[x], t);
+                    cover[x] = 0;
+                    covered++;
+                }
+            } else {
+                for (int32_t x = 0; x < count; x++) {
+                    uint32_t t = cover[x];
+                    if (t == 0 || src[x] == TRANSPARENT) {
+                        continue;
+                    }
+                    uint32_t w = (t * opacity) >> 8;
+                    dst[x] = display_manager_accumulate(dst[x], src[x], w);
+                    cover[x] = t - w;
                 }
             }
+            dm_ctx.row_remaining[display_y] -= covered;
+            remaining -= covered;
         }
     }
+    // Whatever is still uncovered shows the black background, which adds nothing
+}
+
+// Recompose whatever changed since the last frame and send it. Returns false,
+// sending nothing, if nothing changed
+static bool display_manager_renderFrame(void)
+{
+    display_manager_rect_t rect;
+    if (!dm_ctx.initialized) {
+        return false;
+    }
+    display_manager_rasterizeLists();
+    if (!collect_dirty(&rect)) {
+        return false;
+    }
+    uint32_t start = frame_stats_begin();
+    merge_buffers(&rect);
+    frame_stats_end(FRAME_STATS_COMPOSE, start);
+
+    // Reorder the recomposed area into LED wiring order and hand the frame to the driver in one go
+    start = frame_stats_begin();
+    const uint16_t* map = dm_ctx.index_map;
+    const uint32_t cols = dm_ctx.cols;
+    for (int32_t y = rect.y0; y <= rect.y1; y++) {
+        for (int32_t x = rect.x0; x <= rect.x1; x++) {
+            uint32_t i = y * cols + x;
+            uint32_t color = dm_ctx.output_buffer[i];
+            dm_ctx.physical_buffer[map[i]] = (color == TRANSPARENT) ? BLACK : color;
+        }
+    }
+    frame_stats_end(FRAME_STATS_MAP, start);
+    neopixel_driver_submitFrame(dm_ctx.physical_buffer, dm_ctx.num_pixels);
+    dm_ctx.frames_composed++;
+    return true;
 }
 
 void display_manager_task(void* pvParameter)
@@ -218,9 +1768,13 @@ void display_manager_task(void* pvParameter)
     // }
 
     LOGI("Display Manager Task started with brightness: %.2f", current_brightness);
+    const TickType_t period = DISPLAY_MANAGER_PERIOD_TICKS;
+    dm_ctx.last_tick = xTaskGetTickCount();
+    dm_ctx.task = xTaskGetCurrentTaskHandle();
     while (1) {
         if (enablePotMonitoring) {
             // Read the potentiometer value and set the brightness accordingly
+                uint32_t start = frame_stats_begin();
                 static float lastPotValue = 0.0f;
                 float potValue = hardware_getPotentiometerValuef(); // Get the potentiometer value (0-100%)
                 display_manager_setBrightness(potValue); // Set brightness (0.0-1.0)
@@ -228,23 +1782,20 @@ void display_manager_task(void* pvParameter)
                     LOGI("Brightness Set: %.2f", potValue);
                     lastPotValue = potValue;
                 }
+                frame_stats_end(FRAME_STATS_POT_SAMPLE, start);
         }
 
-        if (dm_ctx.initialized) {
-            merge_buffers();
-            
-            // Update the physical display using the merged buffer
-            for (uint32_t i = 0; i < NEOPIXEL_NUM_ROWS * NEOPIXEL_NUM_COLS; i++) {
-                // Use existing setPixel function to update the physical display
-                uint32_t row = i / NEOPIXEL_NUM_COLS;
-                uint32_t col = i % NEOPIXEL_NUM_COLS;
-                if (dm_ctx.output_buffer[i] == TRANSPARENT)
-                {
-                    display_manager_setRawPixel(row, col, BLACK);
-                }
-                display_manager_setRawPixel(row, col, dm_ctx.output_buffer[i]);
-            }
+        bool composed = display_manager_renderFrame();
+        TickType_t elapsed = display_manager_countFrames(xTaskGetTickCount(), period, composed);
+        if (composed) {
+            // Content is changing: keep going at up to DISPLAY_MANAGER_MAX_FPS. A change
+            // that ends an idle stretch is composed at once, then the period grid resumes
+            TickType_t wakeTime = dm_ctx.last_tick;
+            vTaskDelayUntil(&wakeTime, period);
+        } else {
+            // Static screen: compose and send nothing until a buffer changes, a
+            // waiting task is due or the potentiometer needs another look
+            ulTaskNotifyTake(pdTRUE, display_manager_idleTimeout(period, elapsed));
         }
-        vTaskDelay(pdMS_TO_TICKS(33)); // ~30fps refresh rate
     }
 }
\ No newline at end of file
@@ -10,7 +10,8 @@ static genealogy_t genealogy = {
     .brightness = 0.5f, // Default brightness
     .wifi_ssid = "",
     .wifi_password = "",
-    .serial = ""
+    .serial = "",
+    .geometry = { GENEALOGY_UNSET, GENEALOGY_UNSET, GENEALOGY_UNSET, GENEALOGY_UNSET }
 };
 
 esp_err_t genealogy_init(void)
@@ -32,8 +33,23 @@ esp_err_t genealogy_init(void)
 
     err = nvs_utils_getString(KEY_SERIAL, genealogy.serial, MAX_SERIAL_LENGTH);
     if (err != ESP_OK) genealogy.serial[0] = '\0';
+
+    err = nvs_utils_getu8(KEY_ROWS, &genealogy.geometry.rows);
+    if (err != ESP_OK) genealogy.geometry.rows = GENEALOGY_UNSET;
+
+    err = nvs_utils_getu8(KEY_COLS, &genealogy.geometry.cols);
+    if (err != ESP_OK) genealogy.geometry.cols = GENEALOGY_UNSET;
+
+    err = nvs_utils_getu8(KEY_WIRING, &genealogy.geometry.wiring);
+    if (err != ESP_OK) genealogy.geometry.wiring = GENEALOGY_UNSET;
+
+    err = nvs_utils_getu8(KEY_ROTATION, &genealogy.geometry.rotation);
+    if (err != ESP_OK) genealogy.geometry.rotation = GENEALOGY_UNSET;
     LOGD("Genealogy initialized: brightness=%.2f, wifi_ssid='%s', wifi_password='%s', serial='%s'",
          genealogy.brightness, genealogy.wifi_ssid, genealogy.wifi_password, genealogy.serial);
+    LOGD("Geometry: rows=%u, cols=%u, wiring=%u, rotation=%u",
+         genealogy.geometry.rows, genealogy.geometry.cols,
+         genealogy.geometry.wiring, genealogy.geometry.rotation);
 
     return ESP_OK;
 }
@@ -86,4 +102,26 @@ esp_err_t genealogy_get_serial(char *serial, size_t serial_len) {
     strncpy(serial, genealogy.serial, serial_len - 1);
     serial[serial_len - 1] = '\0';
     return ESP_OK;
+}
+
+esp_err_t genealogy_set_geometry(const genealogy_geometry_t *geometry) {
+    esp_err_t err = nvs_utils_setu8(KEY_ROWS, geometry->rows);
+    if (err != ESP_OK) return err;
+
+    err = nvs_utils_setu8(KEY_COLS, geometry->cols);
+    if (err != ESP_OK) return err;
+
+    err = nvs_utils_setu8(KEY_WIRING, geometry->wiring);
+    if (err != ESP_OK) return err;
+
+    err = nvs_utils_setu8(KEY_ROTATION, geometry->rotation);
+    if (err == ESP_OK) {
+        genealogy.geometry = *geometry;
+    }
+    return err;
+}
+
+esp_err_t genealogy_get_geometry(genealogy_geometry_t *geometry) {
+    *geometry = genealogy.geometry;
+    return ESP_OK;
 }
\ No newline at end of file
@@ -8,11 +8,23 @@
 #define MAX_PASS_LENGTH 64
 #define MAX_SERIAL_LENGTH 32
 
+#define GENEALOGY_UNSET 0xFF // Geometry value not stored, use the firmware default
+
+// Display geometry as apps see it (after rotation). Stored per unit so one image
+// serves every panel size
+typedef struct {
+    uint8_t rows;
+    uint8_t cols;
+    uint8_t wiring;   // displayManager_wiring_E
+    uint8_t rotation; // displayManager_rotation_E
+} genealogy_geometry_t;
+
 typedef struct {
     float brightness;
     char wifi_ssid[MAX_SSID_LENGTH];
     char wifi_password[MAX_PASS_LENGTH];
     char serial[MAX_SERIAL_LENGTH];
+    genealogy_geometry_t geometry;
 } genealogy_t;
 
 #define GENEALOGY_NAMESPACE "genealogy"
@@ -22,6 +34,10 @@ typedef struct {
 #define KEY_WIFI_SSID "wifi_ssid"
 #define KEY_WIFI_PASS "wifi_pass"
 #define KEY_SERIAL "serial"
+#define KEY_ROWS "rows"
+#define KEY_COLS "cols"
+#define KEY_WIRING "wiring"
+#define KEY_ROTATION "rotation"
 
 esp_err_t genealogy_init(void);
 
@@ -36,3 +52,7 @@ esp_err_t genealogy_get_wifi_credentials(char *ssid, size_t ssid_len, char *pass
 // Serial number functions
 esp_err_t genealogy_set_serial(const char *serial);
 esp_err_t genealogy_get_serial(char *serial, size_t serial_len);
+
+// Display geometry functions. Changes take effect at the next boot
+esp_err_t genealogy_set_geometry(const genealogy_geometry_t *geometry);
+esp_err_t genealogy_get_geometry(genealogy_geometry_t *geometry);
@@ -11,10 +11,13 @@
 #include "clock.h"
 #include "http_manager.h"
 #include "ota_manger.h"
+#include "udp_stream.h"
+#include "anim_player.h"
 #include "telnet_log.h"
 #include "genealogy.h"
 
 #define LED_PIN GPIO_NUM_2  // Built-in LED on most ESP32 dev boards
+#define TAG "MAIN"
 
 void blinky_task(void *pvParameter) {
     // Configure the LED pin as output
@@ -36,14 +39,12 @@ void blinky_task(void *pvParameter) {
 
 void app_main(void)
 {
-    // if (genealogy_init() != ESP_OK) {
-    //     LOGE("Failed to initialize genealogy");
-    //     while (1) {
-    //         vTaskDelay(pdMS_TO_TICKS(1000)); // Wait indefinitely
-    //     }
-    // } else {
-    //     LOGI("Genealogy initialized successfully");
-    // }
+    // The display geometry comes from genealogy. Without it the build's default panel is used
+    if (genealogy_init() != ESP_OK) {
+        LOGE("Failed to initialize genealogy, using default display geometry");
+    } else {
+        LOGI("Genealogy initialized successfully");
+    }
 
     // vTaskDelay(pdMS_TO_TICKS(1000)); // Wait for 1 second before starting tasks
     esp_err_t err = display_manager_init();
@@ -53,6 +54,8 @@ void app_main(void)
 
     ESP_ERROR_CHECK(clock_app_register());
     ESP_ERROR_CHECK(updater_register());
+    ESP_ERROR_CHECK(udp_stream_app_register());
+    ESP_ERROR_CHECK(anim_player_app_register());
 
     xTaskCreate(&blinky_task, "blinky_task", 1024, NULL, 5, NULL);
     xTaskCreate(&neopixel_task, "neopixel_task", 8192, NULL, 5, NULL); 
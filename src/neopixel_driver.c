@@ -1,7 +1,6 @@
 #include "neopixel_driver.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/queue.h" 
 #include "freertos/semphr.h"
 #include "driver/gpio.h"
 #include <neopixel.h>
@@ -9,146 +8,194 @@
 #include "esp_timer.h"
 #include "telnet_log.h"
 #include "utils.h"
+#include "frame_stats.h"
+#include "esp_heap_caps.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
 
 #ifndef NEOPIXEL_GPIO
 #define NEOPIXEL_GPIO (GPIO_NUM_27)
 #endif
 
 #ifndef NEOPIXEL_NUM_LEDS
-#define NEOPIXEL_NUM_LEDS (256)
+#define NEOPIXEL_NUM_LEDS (256) // Used when neopixel_driver_configure is not called
 #endif
 
-#define QUEUE_BUFFER_SIZE (NEOPIXEL_NUM_LEDS * 3)
-
 #define TAG "NEOPIXEL_DRIVER"
 
 
+#define FRAME_DONE_TIMEOUT_MS 100
+
 #define BRIGHTNESS_SCALE 256
 #define MAX_BRIGHTNESS 200 // May need some tuneing
 
-
-
-static tNeopixel pixelBuffer[NEOPIXEL_NUM_LEDS] = {0};
-static QueueHandle_t pixelQueue = NULL;
+static uint32_t numLeds = NEOPIXEL_NUM_LEDS;
+static uint32_t* pixelBuffer = NULL; // numLeds packed RGB values, indexed by LED position
 static SemaphoreHandle_t pixelMutex = NULL; // Mutex for pixel buffer access
 static tNeopixelContext neopixel = NULL;
+static TaskHandle_t driverTask = NULL; // Notified whenever there is something new to send
 
 
-static float brightness = 0.0f;
+static volatile uint32_t targetBrightness = 0;     // Requested scale, 0..MAX_BRIGHTNESS
+static uint32_t appliedBrightness = UINT32_MAX;     // Scale currently folded into the level map
 
+// The pixel buffer and its mutex exist before any task runs, so frames submitted
+// ahead of the driver task are kept rather than dropped
+static esp_err_t neopixel_driver_allocate(uint32_t leds)
+{
+    uint32_t* buffer = heap_caps_calloc(leds, sizeof(uint32_t), MALLOC_CAP_8BIT);
+    if (buffer == NULL)
+    {
+        LOGE("Failed to allocate %lu LEDs", leds);
+        return ESP_ERR_NO_MEM;
+    }
+    SemaphoreHandle_t mutex = xSemaphoreCreateBinary();
+    if (mutex == NULL)
+    {
+        free(buffer);
+        LOGE("Failed to create pixel mutex");
+        return ESP_ERR_NO_MEM;
+    }
+    xSemaphoreGive(mutex); // Initialize the mutex to be available
+    numLeds = leds;
+    pixelBuffer = buffer;
+    pixelMutex = mutex;
+    return ESP_OK;
+}
 
-static uint32_t refreshRate = 500; // Ticks
+esp_err_t neopixel_driver_configure(uint32_t leds)
+{
+    if (pixelBuffer != NULL) {
+        LOGE("LED count must be set before the driver starts");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (leds == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return neopixel_driver_allocate(leds);
+}
 
 static int neopixel_driver_init(void)
 {
-    // neopixel = neopixel_Init(NEOPIXEL_NUM_LEDS, NEOPIXEL_GPIO);
-    neopixel = neopixel_Init(NEOPIXEL_NUM_LEDS, GPIO_NUM_27);
+    if (pixelBuffer == NULL && neopixel_driver_allocate(numLeds) != ESP_OK)
+    {
+        return -1;
+    }
+
+    // neopixel = neopixel_Init(numLeds, NEOPIXEL_GPIO);
+    neopixel = neopixel_Init(numLeds, GPIO_NUM_27);
     if (neopixel == NULL) 
     {
         LOGE("Failed to initialize NeoPixel driver");
         return -1;
     }
     
-    refreshRate = neopixel_GetRefreshRate(neopixel);
-    refreshRate = MAX(1, pdMS_TO_TICKS( 1000UL/ refreshRate)); // Convert to milliseconds
-    LOGI("NeoPixel refresh rate: %lu", pdTICKS_TO_MS(refreshRate));
-    pixelQueue = xQueueCreate(QUEUE_BUFFER_SIZE, sizeof(tNeopixel));
-    pixelMutex = xSemaphoreCreateBinary();
-    xSemaphoreGive(pixelMutex); // Initialize the mutex to be available
+    LOGI("NeoPixel max refresh rate: %lu Hz", neopixel_GetRefreshRate(neopixel));
+    driverTask = xTaskGetCurrentTaskHandle();
+    // Anything submitted before the task started is waiting in pixelBuffer
+    xTaskNotifyGive(driverTask);
 
     return 0;
 }
 
-// Apply brightness to the input buffer and store the result in the output buffer
-static void neopixel_driver_applyBrightness(tNeopixel* input, tNeopixel* output)
+// Wake the driver task: a new frame or brightness is waiting to be sent
+static void neopixel_driver_frameReady(void)
 {
-    uint8_t bright = (uint8_t)(brightness * BRIGHTNESS_SCALE);
-    bright = MIN(bright, MAX_BRIGHTNESS); // Ensure brightness does not exceed max
-    xSemaphoreTake(pixelMutex, portMAX_DELAY); // Take the mutex to protect the pixel buffer
-    for (uint32_t i = 0; i < NEOPIXEL_NUM_LEDS; i++)
-    {
-
-        uint8_t r = (input[i].rgb >> 16) & 0xFF;
-        uint8_t g = (input[i].rgb >> 8) & 0xFF;
-        uint8_t b = input[i].rgb & 0xFF;
+    if (driverTask != NULL) {
+        xTaskNotifyGive(driverTask);
+    }
+}
 
-        // Apply brightness scaling
-        r = (r * bright) / BRIGHTNESS_SCALE;
-        g = (g * bright) / BRIGHTNESS_SCALE;
-        b = (b * bright) / BRIGHTNESS_SCALE;
+// Rebuild the per-value output levels (gamma, then brightness) and fold them into the
+// library's encode table. Only runs when the brightness actually changed.
+static bool neopixel_driver_applyBrightness(void)
+{
+    uint32_t bright = targetBrightness;
+    if (bright == appliedBrightness) {
+        return false;
+    }
 
-        output[i].rgb = (r << 16) | (g << 8) | b;
-        output[i].index = input[i].index; // Keep the index the same
+    uint8_t levels[256];
+    for (uint32_t v = 0; v < 256; v++)
+    {
+        // Define NEOPIXEL_GAMMA (e.g. -D NEOPIXEL_GAMMA=2.2) to apply a gamma curve before brightness scaling
+#ifdef NEOPIXEL_GAMMA
+        uint32_t corrected = (uint32_t)(powf(v / 255.0f, NEOPIXEL_GAMMA) * 255.0f + 0.5f);
+#else
+        uint32_t corrected = v;
+#endif
+        levels[v] = (uint8_t)((corrected * bright) / BRIGHTNESS_SCALE);
     }
-    xSemaphoreGive(pixelMutex); // Release the mutex
+    neopixel_SetLevelMap(neopixel, levels);
+    appliedBrightness = bright;
+    return true;
 }
 
-
 void neopixel_driver_setBrightness(float b)
 {
     if (b < 0.0f || b > 1.0f) {
         LOGE("Brightness must be between 0.0 and 1.0");
         return;
     }
-    brightness = b;
-    // LOGD("Setting brightness to: %.2f", brightness);
+    // Scale before narrowing so full brightness is capped instead of wrapping to zero
+    uint32_t bright = MIN((uint32_t)(b * BRIGHTNESS_SCALE), MAX_BRIGHTNESS);
+    // LOGD("Setting brightness to: %.2f", b);
+    if (bright != targetBrightness) {
+        targetBrightness = bright;
+        neopixel_driver_frameReady();
+    }
 }
 
-void neopixel_driver_addToQueue(tNeopixel* pixel, uint32_t pixelCount)
+void neopixel_driver_submitFrame(const uint32_t* rgb, size_t n)
 {
-    if (pixelQueue == NULL) 
+    if (pixelMutex == NULL)
     {
-        LOGE("Pixel queue is not initialized");
+        LOGE("NeoPixel driver is not initialized");
         return;
     }
-    
-    for (uint32_t i = 0; i < pixelCount; i++) {
-        if (xQueueSend(pixelQueue, &pixel[i], portMAX_DELAY) != pdTRUE) {
-            LOGE("Failed to send pixel to queue");
-        } else {
-            LOGD("Pixel added to queue: index=%lu, color=%06lX", pixel[i].index, pixel[i].rgb);
-        }
+    if (n > numLeds) {
+        LOGE("Frame of %u pixels exceeds %u LEDs", (unsigned)n, (unsigned)numLeds);
+        n = numLeds;
     }
-}
 
-void neopixel_driver_setRawPixel(tNeopixel* pixel)
-{
-    LOGI("Setting raw pixel: index=%lu, color=%06lX", pixel->index, pixel->rgb);
-    xSemaphoreTake(pixelMutex, portMAX_DELAY); // Take the mutex to protect the pixel buffer
-    pixelBuffer[pixel->index] = *pixel;
+    xSemaphoreTake(pixelMutex, portMAX_DELAY); // One lock for the whole frame
+    memcpy(pixelBuffer, rgb, n * sizeof(uint32_t));
     xSemaphoreGive(pixelMutex); // Release the mutex
+    neopixel_driver_frameReady();
 }
 
 void neopixel_driver_setPixel(int index, uint32_t color)
 {
-    if (index < 0 || index >= NEOPIXEL_NUM_LEDS) {
+    if (index < 0 || index >= (int)numLeds) {
         LOGE("Index out of bounds: %d", index);
         return;
     }
     xSemaphoreTake(pixelMutex, portMAX_DELAY); // Take the mutex to protect the pixel buffer
-    pixelBuffer[index].rgb = color;
-    pixelBuffer[index].index = index;
+    pixelBuffer[index] = color;
     xSemaphoreGive(pixelMutex); // Release the mutex
+    neopixel_driver_frameReady();
 }
 
 void neopixel_driver_fill_matrix(uint32_t rgb)
 {
     xSemaphoreTake(pixelMutex, portMAX_DELAY); // Take the mutex to protect the pixel buffer
-    for (uint32_t i = 0; i < NEOPIXEL_NUM_LEDS; i++) {
-        pixelBuffer[i].index = i;
-        pixelBuffer[i].rgb = rgb;
+    for (uint32_t i = 0; i < numLeds; i++) {
+        pixelBuffer[i] = rgb;
     }
     xSemaphoreGive(pixelMutex); // Release the mutex
+    neopixel_driver_frameReady();
 }
 
 void neopixel_driver_clearMatrix(void)
 {
     xSemaphoreTake(pixelMutex, portMAX_DELAY); // Take the mutex to protect the pixel buffer
-    for (uint32_t i = 0; i < NEOPIXEL_NUM_LEDS; i++) {
-        pixelBuffer[i].index = i;
-        pixelBuffer[i].rgb = 0x000000; // Clear to black
+    for (uint32_t i = 0; i < numLeds; i++) {
+        pixelBuffer[i] = 0x000000; // Clear to black
     }
     xSemaphoreGive(pixelMutex); // Release the mutex
+    neopixel_driver_frameReady();
 }
 
 void neopixel_task(void* pvParameter)
@@ -159,17 +206,35 @@ void neopixel_task(void* pvParameter)
         return;
     }
 
-    int64_t prevTime = esp_timer_get_time() / 1000;
-    int64_t currTime = esp_timer_get_time() / 1000;
     while(1)
     {
-        currTime = esp_timer_get_time() / 1000;
-        prevTime = currTime;
-        tNeopixel correctedPixelBuffer[NEOPIXEL_NUM_LEDS] = {0};
-        neopixel_driver_applyBrightness(pixelBuffer, correctedPixelBuffer);
-        if (!neopixel_SetPixel(neopixel, correctedPixelBuffer, NEOPIXEL_NUM_LEDS)) {
+        // Sleep until a frame or brightness change arrives; several submissions
+        // while a transfer is in flight collapse into one update with the latest frame
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        uint32_t start = frame_stats_begin();
+        bool sent = neopixel_driver_applyBrightness();
+        if (sent) {
+            frame_stats_end(FRAME_STATS_BRIGHTNESS, start);
+        }
+        xSemaphoreTake(pixelMutex, portMAX_DELAY); // Take the mutex to protect the pixel buffer
+        start = frame_stats_begin();
+        bool success = neopixel_SetPixel(neopixel, pixelBuffer, 0, numLeds);
+        frame_stats_end(FRAME_STATS_ENCODE, start);
+        xSemaphoreGive(pixelMutex); // Release the mutex
+        if (!success) {
             LOGE("Failed to set pixel color");
         }
-        vTaskDelay(refreshRate); // Delay to control refresh rate
+        sent = sent || (neopixel_GetDirtyCount(neopixel) > 0);
+
+        // Unchanged frames are never transmitted. Otherwise wait for the I2S
+        // transfer to finish so the next frame starts on a completed one
+        if (sent) {
+            if (neopixel_WaitFrameDone(neopixel, pdMS_TO_TICKS(FRAME_DONE_TIMEOUT_MS))) {
+                frame_stats_record(FRAME_STATS_TRANSFER, neopixel_GetLastTransferUs(neopixel));
+            } else {
+                LOGE("Timed out waiting for frame transfer");
+            }
+        }
     }
 }
\ No newline at end of file
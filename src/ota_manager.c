@@ -37,7 +37,7 @@ static app_manager_app_t ota_app =
     .deinit_function = NULL, // No specific deinit function
     .active = true,
     .priority = 1,
-    .refresh_rate_ms = 1000, // Refresh every second
+    .refresh_rate_ms = 100, // Progress bar refresh while an update is running
     .task_handle = NULL,
     .stack_size = 8192,
     .state = APP_STATE_STOPPED,
@@ -51,19 +51,19 @@ bool ota_manager_isUpdateInProgress(void) {
 
 void ota_manger_colorProgressBar(uint32_t color)
 {
-
+    // Same line the progress is drawn on
     if (PROGRESS_BAR_ORIENTATION == 1)
     {
-        uint8_t start_x = (updater_display_buffer->x / 2) - 1;
-        uint8_t start_y = updater_display_buffer->y;
-        uint8_t end_y = updater_display_buffer->y + updater_display_buffer->height - 1;
+        int32_t start_x = updater_display_buffer->x + (updater_display_buffer->width / 2) - 1;
+        int32_t start_y = updater_display_buffer->y;
+        int32_t end_y = updater_display_buffer->y + updater_display_buffer->height - 1;
         graphics_drawLine(updater_display_buffer, start_x, start_y, start_x, end_y, color); // Draw the vertical line
     }
     else
     {
-        uint8_t start_x = updater_display_buffer->x;
-        uint8_t start_y = (updater_display_buffer->y / 2) - 1;
-        uint8_t end_x = updater_display_buffer->x + updater_display_buffer->width - 1;
+        int32_t start_x = updater_display_buffer->x;
+        int32_t start_y = updater_display_buffer->y + (updater_display_buffer->height / 2) - 1;
+        int32_t end_x = updater_display_buffer->x + updater_display_buffer->width - 1;
         graphics_drawLine(updater_display_buffer, start_x, start_y, end_x, start_y, color); // Draw the horizontal line
     }
 }
@@ -72,16 +72,16 @@ void ota_mangager_drawProgress(void)
 {
     if (PROGRESS_BAR_ORIENTATION == 1) // Vertical progress bar
     {
-        uint8_t start_x = (updater_display_buffer->x / 2) - 1;
-        uint8_t start_y = updater_display_buffer->y + (updater_display_buffer->height / 2) - 1;
-        uint8_t end_y = updater_display_buffer->y + (updater_display_buffer->height * currentProgress / 100);
+        int32_t start_x = updater_display_buffer->x + (updater_display_buffer->width / 2) - 1;
+        int32_t start_y = updater_display_buffer->y + (updater_display_buffer->height / 2) - 1;
+        int32_t end_y = updater_display_buffer->y + (updater_display_buffer->height * currentProgress / 100);
         graphics_drawLine(updater_display_buffer, start_x, start_y, start_x, end_y, YELLOW); // Draw the vertical line
     }
     else // Horizontal progress bar
     {
-        uint8_t start_x = 0;
-        uint8_t start_y = updater_display_buffer->y + (updater_display_buffer->height / 2) - 1;
-        uint8_t end_x = updater_display_buffer->x + (updater_display_buffer->width * currentProgress / 100);
+        int32_t start_x = 0;
+        int32_t start_y = updater_display_buffer->y + (updater_display_buffer->height / 2) - 1;
+        int32_t end_x = updater_display_buffer->x + (updater_display_buffer->width * currentProgress / 100);
         graphics_drawLine(updater_display_buffer, start_x, start_y, end_x, start_y, YELLOW); // Draw the horizontal line
     }
 }
@@ -96,12 +96,12 @@ void ota_manager_drawProgressBar(void) {
     {
         case OTA_STATUS_IDLE:
         {
-            updater_display_buffer->active = false;
+            display_manager_setBufferActive(updater_display_buffer, false);
             break;
         }
         case OTA_STATUS_STARTING:
         {
-            updater_display_buffer->active = true;
+            display_manager_setBufferActive(updater_display_buffer, true);
             graphics_drawRectangle(updater_display_buffer, 
                                     updater_display_buffer->x, 
                                     updater_display_buffer->y, 
@@ -113,19 +113,19 @@ void ota_manager_drawProgressBar(void) {
         }
         case OTA_STATUS_IN_PROGRESS:
         {
-            updater_display_buffer->active = true;
+            display_manager_setBufferActive(updater_display_buffer, true);
             ota_mangager_drawProgress();
             break;
         }
         case OTA_STATUS_SUCCESS:
         {
-            updater_display_buffer->active = true;
+            display_manager_setBufferActive(updater_display_buffer, true);
             ota_manger_colorProgressBar(GREEN);
             break;
         }
         case OTA_STATUS_FAILED:
         {
-            updater_display_buffer->active = true;
+            display_manager_setBufferActive(updater_display_buffer, true);
             ota_manger_colorProgressBar(RED);
             break;
         }
@@ -273,10 +273,12 @@ bool start_ota_server() {
 
 bool updater_init(void)
 {
-    updater_display_buffer = display_manager_create_buffer("Updater",
+    // Only a handful of colours, so 4-bit indexed pixels are plenty
+    updater_display_buffer = display_manager_create_buffer_ex("Updater",
                                                               DISPLAY_WIDTH, DISPLAY_HEIGHT, 
                                                               0, 0,
-                                                              DISPLAY_MANAGER_LAYER_SYSTEM);
+                                                              DISPLAY_MANAGER_LAYER_SYSTEM,
+                                                              DISPLAY_FORMAT_INDEXED4);
     if (updater_display_buffer == NULL) {
         LOGE("Failed to create updater display buffer");
         return false; // Buffer creation failed
@@ -300,11 +302,11 @@ void ota_task(void* pvParameter) {
         if (ota_manager_isUpdateInProgress())
         {
             updater_drawUpdater();
-            vTaskDelay(pdMS_TO_TICKS(100)); // Update the progress bar every 100 ms
+            display_manager_waitFrames(display_manager_msToFrames(ota_app.refresh_rate_ms));
         }
         else
         {
-            vTaskDelay(pdMS_TO_TICKS(2500)); // Update the progress bar every 100 ms
+            vTaskDelay(pdMS_TO_TICKS(2500)); // Nothing to draw, just check for an update starting
         }
     }
 }
@@ -0,0 +1,142 @@
+#include "anim_codec.h"
+
+#include <string.h>
+
+static uint16_t anim_codec_read16(const uint8_t* p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t anim_codec_read32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+anim_codec_result_E anim_codec_readHeader(const uint8_t* data, size_t size, anim_codec_header_t* header)
+{
+    if (size < ANIM_HEADER_SIZE) {
+        return ANIM_ERR_TRUNCATED;
+    }
+    if (memcmp(data, ANIM_MAGIC, 4) != 0) {
+        return ANIM_ERR_MAGIC;
+    }
+    header->width = anim_codec_read16(&data[4]);
+    header->height = anim_codec_read16(&data[6]);
+    header->frame_count = anim_codec_read16(&data[8]);
+    header->size = anim_codec_read32(&data[12]);
+    if (header->width == 0 || header->height == 0 || header->frame_count == 0 ||
+        header->size < ANIM_HEADER_SIZE) {
+        return ANIM_ERR_CORRUPT;
+    }
+    return ANIM_OK;
+}
+
+anim_codec_result_E anim_codec_open(anim_codec_t* anim, const uint8_t* data, size_t size)
+{
+    memset(anim, 0, sizeof(*anim));
+    anim_codec_result_E result = anim_codec_readHeader(data, size, &anim->header);
+    if (result != ANIM_OK) {
+        return result;
+    }
+    if (anim->header.size > size ||
+        anim->header.size < ANIM_HEADER_SIZE + ANIM_FRAME_HEADER_SIZE) {
+        return ANIM_ERR_TRUNCATED;
+    }
+    // Playback always starts and loops from the first frame, so it has to stand alone
+    if (data[ANIM_HEADER_SIZE] != ANIM_FRAME_KEY) {
+        return ANIM_ERR_CORRUPT;
+    }
+    anim->data = data;
+    anim_codec_rewind(anim);
+    return ANIM_OK;
+}
+
+void anim_codec_rewind(anim_codec_t* anim)
+{
+    anim->next = ANIM_HEADER_SIZE;
+    anim->frame = 0;
+}
+
+anim_codec_result_E anim_codec_decodeFrame(anim_codec_t* anim, uint32_t* pixels, const uint32_t* previous,
+                                           uint32_t* duration_ms)
+{
+    if (anim->frame >= anim->header.frame_count) {
+        return ANIM_END;
+    }
+    const uint8_t* data = anim->data;
+    uint32_t size = anim->header.size;
+    if (size - anim->next < ANIM_FRAME_HEADER_SIZE) {
+        return ANIM_ERR_TRUNCATED;
+    }
+    const uint8_t* frame = &data[anim->next];
+    uint8_t type = frame[0];
+    uint32_t length = anim_codec_read32(&frame[4]);
+    if (type != ANIM_FRAME_KEY && type != ANIM_FRAME_DELTA) {
+        return ANIM_ERR_CORRUPT;
+    }
+    if (size - anim->next - ANIM_FRAME_HEADER_SIZE < length) {
+        return ANIM_ERR_TRUNCATED;
+    }
+
+    // Every op is bounds checked against both the op bytes and the frame, flash can hold anything
+    const uint8_t* op = &frame[ANIM_FRAME_HEADER_SIZE];
+    const uint8_t* end = op + length;
+    uint32_t* dst = pixels;
+    uint32_t left = (uint32_t)anim->header.width * anim->header.height;
+    while (op < end) {
+        uint32_t code = *op >> ANIM_OP_SHIFT;
+        uint32_t count = (*op & ANIM_OP_COUNT_MASK) + 1;
+        op++;
+        if (count > left) {
+            return ANIM_ERR_CORRUPT;
+        }
+        left -= count;
+
+        switch (code) {
+            case ANIM_OP_SKIP:
+                if (type == ANIM_FRAME_KEY) {
+                    return ANIM_ERR_CORRUPT;
+                }
+                if (previous) {
+                    memcpy(dst, &previous[dst - pixels], count * sizeof(uint32_t));
+                }
+                dst += count;
+                break;
+            case ANIM_OP_FILL: {
+                if (end - op < ANIM_BYTES_PER_PIXEL) {
+                    return ANIM_ERR_TRUNCATED;
+                }
+                uint32_t color = ((uint32_t)op[0] << 16) | ((uint32_t)op[1] << 8) | op[2];
+                op += ANIM_BYTES_PER_PIXEL;
+                while (count--) {
+                    *dst++ = color;
+                }
+                break;
+            }
+            case ANIM_OP_COPY:
+                if ((uint32_t)(end - op) < count * ANIM_BYTES_PER_PIXEL) {
+                    return ANIM_ERR_TRUNCATED;
+                }
+                while (count--) {
+                    *dst++ = ((uint32_t)op[0] << 16) | ((uint32_t)op[1] << 8) | op[2];
+                    op += ANIM_BYTES_PER_PIXEL;
+                }
+                break;
+            default:
+                return ANIM_ERR_CORRUPT;
+        }
+    }
+    if (type == ANIM_FRAME_KEY && left != 0) {
+        return ANIM_ERR_CORRUPT;
+    }
+    if (previous && left > 0) {
+        memcpy(dst, &previous[dst - pixels], left * sizeof(uint32_t));
+    }
+
+    if (duration_ms) {
+        *duration_ms = anim_codec_read16(&frame[2]);
+    }
+    anim->next += ANIM_FRAME_HEADER_SIZE + length;
+    anim->frame++;
+    return ANIM_OK;
+}
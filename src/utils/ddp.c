@@ -0,0 +1,152 @@
+#include "ddp.h"
+
+#include "utils.h"
+
+#include <string.h>
+
+ddp_result_E ddp_parse(const uint8_t* packet, size_t len, ddp_packet_t* out)
+{
+    if (len < DDP_HEADER_SIZE) {
+        return DDP_ERR_SHORT;
+    }
+
+    out->flags = packet[0];
+    out->sequence = packet[1] & DDP_SEQUENCE_MASK;
+    out->type = packet[2];
+    out->id = packet[3];
+    out->offset = ((uint32_t)packet[4] << 24) | ((uint32_t)packet[5] << 16) |
+                  ((uint32_t)packet[6] << 8) | packet[7];
+    out->length = ((uint16_t)packet[8] << 8) | packet[9];
+
+    if ((out->flags & DDP_FLAG_VERSION_MASK) != DDP_FLAG_VERSION_1) {
+        return DDP_ERR_VERSION;
+    }
+
+    size_t header = DDP_HEADER_SIZE + ((out->flags & DDP_FLAG_TIMECODE) ? DDP_TIMECODE_SIZE : 0);
+    if (len < header + out->length) {
+        return DDP_ERR_SHORT;
+    }
+    out->data = packet + header;
+
+    // Only pixel data for the display; there is no status or config to answer queries with
+    if ((out->flags & (DDP_FLAG_QUERY | DDP_FLAG_REPLY)) || out->id != DDP_ID_DISPLAY ||
+        (out->type != DDP_TYPE_RGB24 && out->type != DDP_TYPE_UNDEFINED)) {
+        return DDP_ERR_UNSUPPORTED;
+    }
+    return DDP_OK;
+}
+
+void ddp_frame_init(ddp_frame_t* frame, uint32_t* pixels, uint32_t num_pixels)
+{
+    memset(frame, 0, sizeof(*frame));
+    frame->pixels = pixels;
+    frame->num_pixels = num_pixels;
+}
+
+void ddp_frame_reset(ddp_frame_t* frame)
+{
+    frame->sequence = 0;
+    frame->shown = false;
+    frame->written = 0;
+}
+
+// Sequence numbers run 1-15 and wrap. Up to 7 behind the current frame is late,
+// further than that is a newer frame
+static bool ddp_frame_isOlder(uint8_t sequence, uint8_t current)
+{
+    uint8_t behind = (current + 15 - sequence) % 15;
+    return behind >= 1 && behind <= 7;
+}
+
+// Write length bytes of frame data at a byte offset within the frame. Already clipped
+static void ddp_frame_writeBytes(ddp_frame_t* frame, uint32_t offset, const uint8_t* src, uint32_t length)
+{
+    // A pixel split across packets is patched a byte at a time, whole ones go in directly
+    while (length > 0 && offset % DDP_BYTES_PER_PIXEL != 0) {
+        uint32_t* px = &frame->pixels[offset / DDP_BYTES_PER_PIXEL];
+        uint32_t shift = 16 - 8 * (offset % DDP_BYTES_PER_PIXEL);
+        *px = ((*px & ~(0xFFu << shift)) | ((uint32_t)*src << shift)) & 0xFFFFFF;
+        src++;
+        offset++;
+        length--;
+    }
+    uint32_t* dst = &frame->pixels[offset / DDP_BYTES_PER_PIXEL];
+    for (; length >= DDP_BYTES_PER_PIXEL; length -= DDP_BYTES_PER_PIXEL) {
+        *dst++ = ((uint32_t)src[0] << 16) | ((uint32_t)src[1] << 8) | src[2];
+        src += DDP_BYTES_PER_PIXEL;
+    }
+    for (uint32_t shift = 16; length > 0; length--, shift -= 8) {
+        *dst = ((*dst & ~(0xFFu << shift)) | ((uint32_t)*src++ << shift)) & 0xFFFFFF;
+    }
+}
+
+// Take bytes [from, to) of the frame from the previous one
+static void ddp_frame_keepBytes(ddp_frame_t* frame, uint32_t from, uint32_t to)
+{
+    if (frame->previous == NULL || from >= to) {
+        return;
+    }
+    frame->kept += to - from;
+    // Partial pixels at either end keep the bytes this frame already wrote
+    while (from < to && from % DDP_BYTES_PER_PIXEL != 0) {
+        uint32_t i = from / DDP_BYTES_PER_PIXEL;
+        uint32_t mask = 0xFFu << (16 - 8 * (from % DDP_BYTES_PER_PIXEL));
+        frame->pixels[i] = (frame->pixels[i] & ~mask) | (frame->previous[i] & mask);
+        from++;
+    }
+    uint32_t first = from / DDP_BYTES_PER_PIXEL;
+    uint32_t end = to / DDP_BYTES_PER_PIXEL;
+    if (end > first) {
+        memcpy(&frame->pixels[first], &frame->previous[first], (end - first) * sizeof(uint32_t));
+    }
+    for (uint32_t b = MAX(from, end * DDP_BYTES_PER_PIXEL); b < to; b++) {
+        uint32_t mask = 0xFFu << (16 - 8 * (b % DDP_BYTES_PER_PIXEL));
+        frame->pixels[end] = (frame->pixels[end] & ~mask) | (frame->previous[end] & mask);
+    }
+}
+
+ddp_frame_E ddp_frame_apply(ddp_frame_t* frame, const ddp_packet_t* packet)
+{
+    bool newFrame = frame->shown; // Anything still accepted after a push starts the next frame
+    if (packet->sequence != 0 && frame->sequence != 0) {
+        bool sameFrame = (packet->sequence == frame->sequence);
+        if ((sameFrame && frame->shown) || ddp_frame_isOlder(packet->sequence, frame->sequence)) {
+            frame->late++;
+            return DDP_FRAME_LATE;
+        }
+        newFrame = newFrame || !sameFrame; // Or the last frame never got its push
+    }
+    if (newFrame) {
+        frame->shown = false;
+        frame->written = 0;
+    }
+    if (packet->sequence != 0) {
+        frame->sequence = packet->sequence;
+    }
+
+    // Clip the payload to the frame
+    uint32_t frameBytes = frame->num_pixels * DDP_BYTES_PER_PIXEL;
+    uint32_t offset = packet->offset;
+    uint32_t length = (offset < frameBytes) ? packet->length : 0;
+    length = (length > frameBytes - offset) ? frameBytes - offset : length;
+
+    // Frames normally arrive in order from the start. Anything skipped over is
+    // filled in from the previous frame first, so what is in place stays contiguous
+    if (length > 0) {
+        if (offset > frame->written) {
+            ddp_frame_keepBytes(frame, frame->written, offset);
+        }
+        ddp_frame_writeBytes(frame, offset, packet->data, length);
+        if (offset <= frame->written || frame->previous) {
+            frame->written = MAX(frame->written, offset + length);
+        }
+    }
+
+    if (packet->flags & DDP_FLAG_PUSH) {
+        ddp_frame_keepBytes(frame, frame->written, frameBytes);
+        frame->shown = true;
+        frame->frames++;
+        return DDP_FRAME_COMPLETE;
+    }
+    return DDP_FRAME_PARTIAL;
+}
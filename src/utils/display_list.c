@@ -0,0 +1,322 @@
+#include "display_list.h"
+
+#include "graphics.h"
+#include "utils.h"
+#include "telnet_log.h"
+
+#include "esp_heap_caps.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#define TAG "DISPLAY_LIST"
+
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+static uint32_t display_list_hashBytes(uint32_t hash, const void* data, size_t len)
+{
+    const uint8_t* bytes = data;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+// FNV-1a over the commands' fields, so padding never takes part
+static uint32_t display_list_hash(const displayList_command_t* commands, uint32_t count)
+{
+    uint32_t hash = display_list_hashBytes(FNV_OFFSET_BASIS, &count, sizeof(count));
+    for (uint32_t i = 0; i < count; i++) {
+        const displayList_command_t* cmd = &commands[i];
+        uintptr_t src = (uintptr_t)cmd->src;
+        hash = display_list_hashBytes(hash, &cmd->op, sizeof(cmd->op));
+        hash = display_list_hashBytes(hash, &cmd->font, sizeof(cmd->font));
+        hash = display_list_hashBytes(hash, &cmd->c, sizeof(cmd->c));
+        hash = display_list_hashBytes(hash, &cmd->x, sizeof(cmd->x));
+        hash = display_list_hashBytes(hash, &cmd->y, sizeof(cmd->y));
+        hash = display_list_hashBytes(hash, &cmd->a, sizeof(cmd->a));
+        hash = display_list_hashBytes(hash, &cmd->b, sizeof(cmd->b));
+        hash = display_list_hashBytes(hash, &cmd->src_x, sizeof(cmd->src_x));
+        hash = display_list_hashBytes(hash, &cmd->src_y, sizeof(cmd->src_y));
+        hash = display_list_hashBytes(hash, &cmd->color, sizeof(cmd->color));
+        hash = display_list_hashBytes(hash, &src, sizeof(src));
+    }
+    return hash;
+}
+
+displayList_t* display_list_create(displayManager_buffer_t* buffer)
+{
+    if (!buffer || buffer->double_buffered || buffer->display_list) {
+        LOGE("Buffer cannot take a display list");
+        return NULL;
+    }
+    displayList_t* list = heap_caps_calloc(1, sizeof(displayList_t), MALLOC_CAP_8BIT);
+    if (list == NULL) {
+        LOGE("Failed to allocate display list");
+        return NULL;
+    }
+    list->buffer = buffer;
+    list->record = 0;
+    list->ready = 1;
+    list->drawn = 2;
+    // Whatever the buffer held before is cleared by the first replay
+    list->drawn_bounds = (displayList_bounds_t){ 0, 0, buffer->width - 1, buffer->height - 1 };
+    // The display task looks for lists on its own, publish only once set up
+    __atomic_store_n(&buffer->display_list, list, __ATOMIC_RELEASE);
+    return list;
+}
+
+void display_list_begin(displayList_t* list)
+{
+    list->count[list->record] = 0;
+    list->overflowed = false;
+}
+
+// Next free command of the list being recorded, cleared, or NULL once it is full
+static displayList_command_t* display_list_add(displayList_t* list, displayList_op_E op)
+{
+    uint32_t* count = &list->count[list->record];
+    if (*count >= DISPLAY_LIST_MAX_COMMANDS) {
+        if (!list->overflowed) {
+            LOGW("Display list of '%s' is full", list->buffer->owner);
+            list->overflowed = true;
+        }
+        return NULL;
+    }
+    displayList_command_t* cmd = &list->commands[list->record][(*count)++];
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->op = op;
+    return cmd;
+}
+
+// Commands store coordinates and sizes as int16_t. Values that do not fit are
+// rejected rather than wrapped around to somewhere else on the buffer
+static bool display_list_fits(const displayList_t* list, int32_t a, int32_t b, int32_t c, int32_t d)
+{
+    if (a < INT16_MIN || a > INT16_MAX || b < INT16_MIN || b > INT16_MAX ||
+        c < INT16_MIN || c > INT16_MAX || d < INT16_MIN || d > INT16_MAX) {
+        LOGW("Display list command of '%s' is out of range", list->buffer->owner);
+        return false;
+    }
+    return true;
+}
+
+bool display_list_char(displayList_t* list, int32_t x, int32_t y, char c, font_size_E font, uint32_t color)
+{
+    if (!display_list_fits(list, x, y, 0, 0)) {
+        return false;
+    }
+    displayList_command_t* cmd = display_list_add(list, DISPLAY_LIST_CHAR);
+    if (!cmd) {
+        return false;
+    }
+    cmd->x = x;
+    cmd->y = y;
+    cmd->c = c;
+    cmd->font = font;
+    cmd->color = color;
+    return true;
+}
+
+bool display_list_rect(displayList_t* list, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
+{
+    if (!display_list_fits(list, x, y, width, height)) {
+        return false;
+    }
+    displayList_command_t* cmd = display_list_add(list, DISPLAY_LIST_RECT);
+    if (!cmd) {
+        return false;
+    }
+    cmd->x = x;
+    cmd->y = y;
+    cmd->a = width;
+    cmd->b = height;
+    cmd->color = color;
+    return true;
+}
+
+bool display_list_line(displayList_t* list, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+    if (!display_list_fits(list, x1, y1, x2, y2)) {
+        return false;
+    }
+    displayList_command_t* cmd = display_list_add(list, DISPLAY_LIST_LINE);
+    if (!cmd) {
+        return false;
+    }
+    cmd->x = x1;
+    cmd->y = y1;
+    cmd->a = x2;
+    cmd->b = y2;
+    cmd->color = color;
+    return true;
+}
+
+bool display_list_blit(displayList_t* list, int32_t x, int32_t y,
+                       const displayManager_buffer_t* src, int32_t src_x, int32_t src_y,
+                       int32_t width, int32_t height)
+{
+    if (!display_list_fits(list, x, y, width, height) || !display_list_fits(list, src_x, src_y, 0, 0)) {
+        return false;
+    }
+    displayList_command_t* cmd = display_list_add(list, DISPLAY_LIST_BLIT);
+    if (!cmd) {
+        return false;
+    }
+    cmd->x = x;
+    cmd->y = y;
+    cmd->src = src;
+    cmd->src_x = src_x;
+    cmd->src_y = src_y;
+    cmd->a = width;
+    cmd->b = height;
+    return true;
+}
+
+bool display_list_submit(displayList_t* list)
+{
+    uint32_t slot = list->record;
+    uint32_t hash = display_list_hash(list->commands[slot], list->count[slot]);
+    if (list->submitted && !list->invalidated && hash == list->submitted_hash) {
+        list->unchanged++;
+        return false;
+    }
+    list->hash[slot] = hash;
+    list->force[slot] = list->invalidated;
+    list->invalidated = false;
+
+    // Hand the list over and record the next one into whichever slot was waiting.
+    // If the display task never took that one it is simply replaced
+    uint32_t previous = __atomic_exchange_n(&list->ready, slot | DISPLAY_LIST_FRESH, __ATOMIC_ACQ_REL);
+    list->record = previous & ~DISPLAY_LIST_FRESH;
+    list->count[list->record] = 0;
+    list->submitted_hash = hash;
+    list->submitted = true;
+    list->submits++;
+    display_manager_wake();
+    return true;
+}
+
+void display_list_invalidate(displayList_t* list)
+{
+    list->invalidated = true;
+}
+
+// Grow bounds by a w x h area at (x, y), clipped to the buffer
+static void display_list_boundsAdd(displayList_bounds_t* bounds, const displayManager_buffer_t* buffer,
+                                   int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    int32_t x0 = MAX(x, 0);
+    int32_t y0 = MAX(y, 0);
+    int32_t x1 = MIN(x + w, (int32_t)buffer->width) - 1;
+    int32_t y1 = MIN(y + h, (int32_t)buffer->height) - 1;
+    if (x0 > x1 || y0 > y1) {
+        return;
+    }
+    bounds->x0 = MIN(bounds->x0, x0);
+    bounds->y0 = MIN(bounds->y0, y0);
+    bounds->x1 = MAX(bounds->x1, x1);
+    bounds->y1 = MAX(bounds->y1, y1);
+}
+
+// Area a list can draw on
+static displayList_bounds_t display_list_bounds(const displayList_t* list, uint32_t slot)
+{
+    displayList_bounds_t bounds = { INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN };
+    for (uint32_t i = 0; i < list->count[slot]; i++) {
+        const displayList_command_t* cmd = &list->commands[slot][i];
+        switch (cmd->op)
+        {
+            case DISPLAY_LIST_CHAR: {
+                uint8_t bitmap[8];
+                uint8_t width, height;
+                font_getChar(cmd->c, cmd->font, bitmap, &width, &height);
+                display_list_boundsAdd(&bounds, list->buffer, cmd->x, cmd->y, width, height);
+                break;
+            }
+
+            case DISPLAY_LIST_RECT:
+            case DISPLAY_LIST_BLIT:
+                display_list_boundsAdd(&bounds, list->buffer, cmd->x, cmd->y, cmd->a, cmd->b);
+                break;
+
+            case DISPLAY_LIST_LINE:
+                display_list_boundsAdd(&bounds, list->buffer, MIN(cmd->x, cmd->a), MIN(cmd->y, cmd->b),
+                                       abs(cmd->a - cmd->x) + 1, abs(cmd->b - cmd->y) + 1);
+                break;
+
+            default:
+                break;
+        }
+    }
+    return bounds;
+}
+
+bool display_list_rasterize(displayList_t* list)
+{
+    if (!(__atomic_load_n(&list->ready, __ATOMIC_ACQUIRE) & DISPLAY_LIST_FRESH)) {
+        return false;
+    }
+    uint32_t fresh = __atomic_exchange_n(&list->ready, list->drawn, __ATOMIC_ACQ_REL);
+    list->drawn = fresh & ~DISPLAY_LIST_FRESH;
+
+    uint32_t slot = list->drawn;
+    if (list->has_drawn && !list->force[slot] && list->hash[slot] == list->drawn_hash) {
+        return false; // Changed and changed back before the display task got to it
+    }
+
+    displayManager_buffer_t* buffer = list->buffer;
+    // Everything outside what the last list drew on is clear already.
+    // Both encodings of "nothing drawn", as in display_manager_setBufferPixelAlpha
+    uint32_t clear = buffer->pixel_alpha ? 0x00000000 : TRANSPARENT;
+    const displayList_bounds_t* old = &list->drawn_bounds;
+    if (old->x0 <= old->x1) {
+        display_manager_fillBufferRect(buffer, old->x0, old->y0,
+                                       old->x1 - old->x0 + 1, old->y1 - old->y0 + 1, clear);
+    }
+    list->drawn_bounds = display_list_bounds(list, slot);
+    const displayList_bounds_t* bounds = &list->drawn_bounds;
+    if (bounds->x0 <= bounds->x1) {
+        display_manager_markDirty(buffer, bounds->x0, bounds->y0,
+                                  bounds->x1 - bounds->x0 + 1, bounds->y1 - bounds->y0 + 1);
+    }
+    for (uint32_t i = 0; i < list->count[slot]; i++) {
+        const displayList_command_t* cmd = &list->commands[slot][i];
+        switch (cmd->op)
+        {
+            case DISPLAY_LIST_CHAR:
+                // Characters take byte coordinates
+                if (cmd->x >= 0 && cmd->y >= 0 && cmd->x <= UINT8_MAX && cmd->y <= UINT8_MAX) {
+                    graphics_drawChar(buffer, cmd->x, cmd->y, cmd->c, cmd->font, cmd->color);
+                }
+                break;
+
+            case DISPLAY_LIST_RECT:
+                graphics_fillRect(buffer, cmd->x, cmd->y, cmd->a, cmd->b, cmd->color);
+                break;
+
+            case DISPLAY_LIST_LINE:
+                graphics_drawLine(buffer, cmd->x, cmd->y, cmd->a, cmd->b, cmd->color);
+                break;
+
+            case DISPLAY_LIST_BLIT:
+                graphics_blit(buffer, cmd->x, cmd->y, cmd->src, cmd->src_x, cmd->src_y, cmd->a, cmd->b);
+                break;
+
+            default:
+                break;
+        }
+    }
+    list->drawn_hash = list->hash[slot];
+    list->has_drawn = true;
+    list->replays++;
+    return true;
+}
+
+void display_list_destroy(displayList_t* list)
+{
+    free(list);
+}
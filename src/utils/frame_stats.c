@@ -0,0 +1,104 @@
+#include "frame_stats.h"
+#include "telnet_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include <string.h>
+
+#define TAG "FRAME_STATS"
+
+static frame_stats_histogram_t stats[FRAME_STATS_STAGE_COUNT];
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char* const stage_names[FRAME_STATS_STAGE_COUNT] = {
+    [FRAME_STATS_POT_SAMPLE] = "pot",
+    [FRAME_STATS_COMPOSE] = "compose",
+    [FRAME_STATS_MAP] = "map",
+    [FRAME_STATS_BRIGHTNESS] = "brightness",
+    [FRAME_STATS_ENCODE] = "encode",
+    [FRAME_STATS_TRANSFER] = "transfer",
+};
+
+static uint32_t frame_stats_bucket(uint32_t duration_us)
+{
+    // Bit length of the duration: 0 -> 0, 1 -> 1, 2..3 -> 2, 4..7 -> 3, ...
+    uint32_t bucket = duration_us ? 32 - __builtin_clz(duration_us) : 0;
+    return (bucket < FRAME_STATS_BUCKETS) ? bucket : FRAME_STATS_BUCKETS - 1;
+}
+
+void frame_stats_record(frame_stats_stage_E stage, uint32_t duration_us)
+{
+    if (stage >= FRAME_STATS_STAGE_COUNT) {
+        return;
+    }
+    frame_stats_histogram_t* h = &stats[stage];
+    uint32_t bucket = frame_stats_bucket(duration_us);
+
+    taskENTER_CRITICAL(&stats_lock);
+    if (h->count == 0 || duration_us < h->min_us) {
+        h->min_us = duration_us;
+    }
+    if (duration_us > h->max_us) {
+        h->max_us = duration_us;
+    }
+    h->count++;
+    h->total_us += duration_us;
+    h->buckets[bucket]++;
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+void frame_stats_get(frame_stats_stage_E stage, frame_stats_summary_t* summary)
+{
+    memset(summary, 0, sizeof(*summary));
+    if (stage >= FRAME_STATS_STAGE_COUNT) {
+        return;
+    }
+
+    frame_stats_histogram_t h;
+    taskENTER_CRITICAL(&stats_lock);
+    h = stats[stage];
+    taskEXIT_CRITICAL(&stats_lock);
+    if (h.count == 0) {
+        return;
+    }
+
+    summary->count = h.count;
+    summary->min_us = h.min_us;
+    summary->max_us = h.max_us;
+    summary->avg_us = (uint32_t)(h.total_us / h.count);
+
+    // First bucket where at least 99% of the samples have been seen
+    uint32_t threshold = h.count - h.count / 100;
+    uint32_t seen = 0;
+    for (uint32_t b = 0; b < FRAME_STATS_BUCKETS; b++) {
+        seen += h.buckets[b];
+        if (seen >= threshold) {
+            uint32_t upper = (b == 0) ? 0 : (1UL << b) - 1;
+            summary->p99_us = (b == FRAME_STATS_BUCKETS - 1 || upper > h.max_us) ? h.max_us : upper;
+            break;
+        }
+    }
+}
+
+const char* frame_stats_stageName(frame_stats_stage_E stage)
+{
+    return (stage < FRAME_STATS_STAGE_COUNT) ? stage_names[stage] : "unknown";
+}
+
+void frame_stats_reset(void)
+{
+    taskENTER_CRITICAL(&stats_lock);
+    memset(stats, 0, sizeof(stats));
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+void frame_stats_log(void)
+{
+    for (uint32_t stage = 0; stage < FRAME_STATS_STAGE_COUNT; stage++) {
+        frame_stats_summary_t s;
+        frame_stats_get(stage, &s);
+        LOGI("%-10s n=%lu min=%lu avg=%lu max=%lu p99<=%lu us",
+             frame_stats_stageName(stage), s.count, s.min_us, s.avg_us, s.max_us, s.p99_us);
+    }
+}
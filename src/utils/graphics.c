@@ -2,17 +2,12 @@
 #include "esp_log.h"
 #include <string.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include "telnet_log.h"
+#include "utils.h"
 
 #define TAG "GRAPHICS"
 
-// Helper function to check if coordinates are within buffer bounds
-static bool is_in_bounds(displayManager_buffer_t* buffer, uint8_t x, uint8_t y) {
-    return (buffer != NULL && 
-            x < buffer->width && 
-            y < buffer->height);
-}
-
 void graphics_drawChar(displayManager_buffer_t* buffer,
                       uint8_t x, uint8_t y,
                       char c,
@@ -29,6 +24,113 @@ void graphics_drawChar(displayManager_buffer_t* buffer,
     font_drawChar(buffer, x, y, c, size, color);
 }
 
+// Clip a rectangle to the buffer. Returns false if none of it is left
+static bool graphics_clipRect(const displayManager_buffer_t* buffer,
+                              int32_t* x, int32_t* y,
+                              int32_t* width, int32_t* height)
+{
+    // In 64 bits: the far edges can lie past the int32_t range either way
+    int64_t x0 = MAX(*x, 0);
+    int64_t y0 = MAX(*y, 0);
+    int64_t x1 = MIN((int64_t)*x + *width, (int64_t)buffer->width);
+    int64_t y1 = MIN((int64_t)*y + *height, (int64_t)buffer->height);
+    if (x0 >= x1 || y0 >= y1) {
+        return false;
+    }
+    *x = x0;
+    *y = y0;
+    *width = x1 - x0;
+    *height = y1 - y0;
+    return true;
+}
+
+void graphics_fillRect(displayManager_buffer_t* buffer,
+                       int32_t x, int32_t y,
+                       int32_t width, int32_t height,
+                       uint32_t color)
+{
+    if (!buffer || !graphics_clipRect(buffer, &x, &y, &width, &height)) {
+        return;
+    }
+    display_manager_fillBufferRect(buffer, x, y, width, height, color);
+}
+
+void graphics_drawRect(displayManager_buffer_t* buffer,
+                       int32_t x, int32_t y,
+                       int32_t width, int32_t height,
+                       uint32_t color)
+{
+    if (!buffer || width <= 0 || height <= 0) {
+        return;
+    }
+    if (width <= 2 || height <= 2) {
+        graphics_fillRect(buffer, x, y, width, height, color); // No inside to leave open
+        return;
+    }
+    // Only edges on the buffer are drawn; the far ones may not even fit an int32_t
+    int64_t right = (int64_t)x + width - 1;
+    int64_t bottom = (int64_t)y + height - 1;
+    if (x >= (int32_t)buffer->width || y >= (int32_t)buffer->height || right < 0 || bottom < 0) {
+        return;
+    }
+    graphics_drawHLine(buffer, x, y, width, color);
+    if (bottom < buffer->height) {
+        graphics_drawHLine(buffer, x, bottom, width, color);
+    }
+    graphics_drawVLine(buffer, x, y + 1, height - 2, color);
+    if (right < buffer->width) {
+        graphics_drawVLine(buffer, right, y + 1, height - 2, color);
+    }
+}
+
+void graphics_drawHLine(displayManager_buffer_t* buffer,
+                        int32_t x, int32_t y,
+                        int32_t length,
+                        uint32_t color)
+{
+    graphics_fillRect(buffer, x, y, length, 1, color);
+}
+
+void graphics_drawVLine(displayManager_buffer_t* buffer,
+                        int32_t x, int32_t y,
+                        int32_t length,
+                        uint32_t color)
+{
+    graphics_fillRect(buffer, x, y, 1, length, color);
+}
+
+void graphics_blit(displayManager_buffer_t* dst,
+                   int32_t x, int32_t y,
+                   const displayManager_buffer_t* src,
+                   int32_t src_x, int32_t src_y,
+                   int32_t width, int32_t height)
+{
+    if (!dst || !src) {
+        return;
+    }
+    // Clip the source block to the source, carrying the same trim over to the destination
+    int32_t sx = src_x;
+    int32_t sy = src_y;
+    if (!graphics_clipRect(src, &sx, &sy, &width, &height)) {
+        return;
+    }
+    // Trimmed that far, a block near the edge of the int32_t range misses the buffer
+    int64_t trimmedX = (int64_t)x + (sx - src_x);
+    int64_t trimmedY = (int64_t)y + (sy - src_y);
+    if (trimmedX > INT32_MAX || trimmedY > INT32_MAX) {
+        return;
+    }
+    x = trimmedX;
+    y = trimmedY;
+
+    int32_t dx = x;
+    int32_t dy = y;
+    if (!graphics_clipRect(dst, &dx, &dy, &width, &height)) {
+        return;
+    }
+    display_manager_copyBufferRect(dst, dx, dy, src, sx + (dx - x), sy + (dy - y), width, height);
+}
+
 void graphics_drawRectangle(displayManager_buffer_t* buffer,
                           uint8_t x, uint8_t y,
                           uint8_t width, uint8_t height,
@@ -38,54 +140,499 @@ void graphics_drawRectangle(displayManager_buffer_t* buffer,
         LOGE("Invalid or inactive buffer");
         return;
     }
+    graphics_fillRect(buffer, x, y, width, height, color);
+}
 
-    for (uint8_t row = 0; row < height; row++) {
-        for (uint8_t col = 0; col < width; col++) {
-            if (is_in_bounds(buffer, x + col, y + row)) {
-                display_manager_setBufferPixel(buffer, x + col, y + row, color);
-            }
-        }
+static bool graphics_inRange(int32_t v)
+{
+    return v >= -GRAPHICS_MAX_COORD && v <= GRAPHICS_MAX_COORD;
+}
+
+// Steps i in [0, steps] of a line that stay on the buffer along its major axis,
+// where the position is start + dir * i
+static void graphics_clipMajor(int32_t start, int32_t dir, int32_t size,
+                               int32_t* lo, int32_t* hi)
+{
+    int32_t first = (dir > 0) ? -start : start - (size - 1);
+    int32_t last = (dir > 0) ? size - 1 - start : start;
+    *lo = MAX(*lo, first);
+    *hi = MIN(*hi, last);
+}
+
+// First step i of a line at which q(i) = floor((2 * i * minor + major) / (2 * major)),
+// its offset along the minor axis, reaches k. minor must not be 0
+static int32_t graphics_firstStep(int64_t k, int32_t major, int32_t minor)
+{
+    if (k <= 0) {
+        return 0;
     }
+    int64_t twoMinor = 2 * (int64_t)minor;
+    return ((2 * k - 1) * major + twoMinor - 1) / twoMinor;
+}
 
-    LOGI("Drawing rectangle in buffer '%s' at (%d, %d) with width %d, height %d", 
-         buffer->owner, x, y, width, height);
+// Narrow the steps to those on the buffer along the minor axis, where the position
+// is start + dir * q(i)
+static void graphics_clipMinor(int32_t start, int32_t dir, int32_t size,
+                               int32_t major, int32_t minor,
+                               int32_t* lo, int32_t* hi)
+{
+    int32_t qmin = (dir > 0) ? -start : start - (size - 1);
+    int32_t qmax = (dir > 0) ? size - 1 - start : start;
+    if (qmin > minor || qmax < 0) {
+        *hi = *lo - 1;
+        return;
+    }
+    // q is non-decreasing, so each bound is the first or last step on its side of the edge
+    if (qmin > 0) {
+        *lo = MAX(*lo, graphics_firstStep(qmin, major, minor));
+    }
+    if (qmax < minor) {
+        *hi = MIN(*hi, graphics_firstStep((int64_t)qmax + 1, major, minor) - 1);
+    }
 }
 
 void graphics_drawLine(displayManager_buffer_t* buffer,
-                      uint8_t x1, uint8_t y1,
-                      uint8_t x2, uint8_t y2,
+                      int32_t x1, int32_t y1,
+                      int32_t x2, int32_t y2,
                       uint32_t color)
 {
     if (!buffer || !buffer->active) {
         LOGE("Invalid or inactive buffer");
         return;
     }
+    if (!graphics_inRange(x1) || !graphics_inRange(y1) || !graphics_inRange(x2) || !graphics_inRange(y2)) {
+        return;
+    }
+
+    // Axis-aligned lines are spans
+    if (y1 == y2) {
+        graphics_drawHLine(buffer, MIN(x1, x2), y1, abs(x2 - x1) + 1, color);
+        return;
+    }
+    if (x1 == x2) {
+        graphics_drawVLine(buffer, x1, MIN(y1, y2), abs(y2 - y1) + 1, color);
+        return;
+    }
+
+    int32_t dx = abs(x2 - x1);
+    int32_t dy = abs(y2 - y1);
+    int32_t sx = (x1 < x2) ? 1 : -1;
+    int32_t sy = (y1 < y2) ? 1 : -1;
+    bool xMajor = (dx >= dy);
+    int32_t major = xMajor ? dx : dy;
+    int32_t minor = xMajor ? dy : dx;
+
+    // Clip the segment once: only the steps that land on the buffer are walked
+    int32_t lo = 0;
+    int32_t hi = major;
+    if (xMajor) {
+        graphics_clipMajor(x1, sx, buffer->width, &lo, &hi);
+        graphics_clipMinor(y1, sy, buffer->height, major, minor, &lo, &hi);
+    } else {
+        graphics_clipMajor(y1, sy, buffer->height, &lo, &hi);
+        graphics_clipMinor(x1, sx, buffer->width, major, minor, &lo, &hi);
+    }
+    if (lo > hi) {
+        return;
+    }
+
+    // Bresenham from the first visible step, with the error term that step would have had
+    int64_t twoMajor = 2 * (int64_t)major;
+    int64_t twoMinor = 2 * (int64_t)minor;
+    int64_t start = twoMinor * lo + major;
+    int32_t q = start / twoMajor;
+    int64_t err = start % twoMajor;
+    int32_t x = x1 + sx * (xMajor ? lo : q);
+    int32_t y = y1 + sy * (xMajor ? q : lo);
+    int32_t firstX = x;
+    int32_t firstY = y;
+
+    for (int32_t i = lo; i <= hi; i++) {
+        if (buffer->format == DISPLAY_FORMAT_RGB888) {
+            buffer->buffer[y * buffer->width + x] = color;
+        } else {
+            display_manager_setBufferPixel(buffer, x, y, color); // Compact formats need encoding
+        }
+        if (i == hi) {
+            break;
+        }
+        err += twoMinor;
+        if (err >= twoMajor) {
+            err -= twoMajor;
+            if (xMajor) {
+                y += sy;
+            } else {
+                x += sx;
+            }
+        }
+        if (xMajor) {
+            x += sx;
+        } else {
+            y += sy;
+        }
+    }
+    display_manager_markDirty(buffer, MIN(firstX, x), MIN(firstY, y),
+                              abs(x - firstX) + 1, abs(y - firstY) + 1);
+}
+
+// Spans making up a shape, written as they come and marked dirty together at the end
+typedef struct
+{
+    displayManager_buffer_t* buffer;
+    uint32_t color;
+    int32_t x0;  // Covered area, empty while x0 > x1
+    int32_t y0;
+    int32_t x1;
+    int32_t y1;
+} graphics_spans_t;
+
+static void graphics_spansBegin(graphics_spans_t* spans, displayManager_buffer_t* buffer, uint32_t color)
+{
+    spans->buffer = buffer;
+    spans->color = color;
+    spans->x0 = INT32_MAX;
+    spans->y0 = INT32_MAX;
+    spans->x1 = INT32_MIN;
+    spans->y1 = INT32_MIN;
+}
+
+// Pixels x0..x1 of row y, clipped to the buffer
+static void graphics_span(graphics_spans_t* spans, int32_t y, int32_t x0, int32_t x1)
+{
+    displayManager_buffer_t* buffer = spans->buffer;
+    if (y < 0 || y >= (int32_t)buffer->height) {
+        return;
+    }
+    x0 = MAX(x0, 0);
+    x1 = MIN(x1, (int32_t)buffer->width - 1);
+    if (x0 > x1) {
+        return;
+    }
+    if (buffer->format == DISPLAY_FORMAT_RGB888) {
+        uint32_t* dst = &buffer->buffer[y * buffer->width + x0];
+        for (int32_t x = x0; x <= x1; x++) {
+            *dst++ = spans->color;
+        }
+    } else {
+        display_manager_fillBufferRect(buffer, x0, y, x1 - x0 + 1, 1, spans->color); // Compact formats need encoding
+    }
+    spans->x0 = MIN(spans->x0, x0);
+    spans->y0 = MIN(spans->y0, y);
+    spans->x1 = MAX(spans->x1, x1);
+    spans->y1 = MAX(spans->y1, y);
+}
+
+static void graphics_spansEnd(graphics_spans_t* spans)
+{
+    if (spans->x0 <= spans->x1) {
+        display_manager_markDirty(spans->buffer, spans->x0, spans->y0,
+                                  spans->x1 - spans->x0 + 1, spans->y1 - spans->y0 + 1);
+    }
+}
+
+// An edge from (x, y) towards its other end, stepped the same way graphics_drawLine
+// steps it so filled shapes cover their outlines exactly. Row k of the edge, counted
+// from y, is where floor((2 * dx * k + bias) / (2 * dy)) lands: the offset along x for
+// y-major edges, the first step of the row for x-major ones. That is tracked from row
+// to row as a quotient and remainder, without dividing
+typedef struct
+{
+    int32_t x;
+    int32_t y;
+    int32_t dx;    // Absolute lengths
+    int32_t dy;
+    int32_t sx;    // Directions, +1 or -1
+    int32_t sy;
+    int32_t ymin;  // Rows the edge touches
+    int32_t ymax;
+    int32_t k;     // Row being walked, counted from y
+    int32_t q;     // The floor above at row k
+    int64_t r;     // and its remainder
+    int32_t dq;    // Change in both per row
+    int64_t dr;
+} graphics_edge_t;
+
+static void graphics_edgeInit(graphics_edge_t* edge, graphics_point_t from, graphics_point_t to)
+{
+    edge->x = from.x;
+    edge->y = from.y;
+    edge->dx = abs(to.x - from.x);
+    edge->dy = abs(to.y - from.y);
+    edge->sx = (from.x < to.x) ? 1 : -1;
+    edge->sy = (from.y < to.y) ? 1 : -1;
+    edge->ymin = MIN(from.y, to.y);
+    edge->ymax = MAX(from.y, to.y);
+}
+
+// Start walking the edge at row y, within ymin..ymax
+static void graphics_edgeStart(graphics_edge_t* edge, int32_t y)
+{
+    edge->k = abs(y - edge->y);
+    if (edge->dy == 0) {
+        return;
+    }
+    int64_t twoDx = 2 * (int64_t)edge->dx;
+    int64_t twoDy = 2 * (int64_t)edge->dy;
+    // x-major rows start where graphics_firstStep says, y-major ones are rounded across
+    int64_t bias = (edge->dx >= edge->dy) ? twoDy - 1 - edge->dx : edge->dy;
+    int64_t n = twoDx * edge->k + bias;
+    edge->q = n / twoDy;
+    edge->r = n % twoDy;
+    if (edge->r < 0) {
+        edge->q--;
+        edge->r += twoDy;
+    }
+    // Less than a column per row for y-major edges
+    edge->dq = (edge->dx >= edge->dy) ? twoDx / twoDy : 0;
+    edge->dr = (edge->dx >= edge->dy) ? twoDx % twoDy : twoDx;
+}
+
+// Move on to the next row down
+static void graphics_edgeNext(graphics_edge_t* edge)
+{
+    if (edge->dy == 0) {
+        return;
+    }
+    int64_t twoDy = 2 * (int64_t)edge->dy;
+    edge->k += edge->sy;
+    if (edge->sy > 0) {
+        edge->q += edge->dq;
+        edge->r += edge->dr;
+        if (edge->r >= twoDy) {
+            edge->r -= twoDy;
+            edge->q++;
+        }
+    } else {
+        edge->q -= edge->dq;
+        edge->r -= edge->dr;
+        if (edge->r < 0) {
+            edge->r += twoDy;
+            edge->q--;
+        }
+    }
+}
+
+// Columns the edge covers in the row being walked
+static void graphics_edgeRow(const graphics_edge_t* edge, int32_t* x0, int32_t* x1)
+{
+    int32_t first;
+    int32_t last;
+    if (edge->dy == 0) {
+        first = 0;
+        last = edge->dx;
+    } else if (edge->dx >= edge->dy) {
+        // x-major: a run of steps shares the row, up to where the next row starts
+        int32_t next = edge->q + edge->dq + (edge->r + edge->dr >= 2 * (int64_t)edge->dy);
+        first = (edge->k > 0) ? edge->q : 0;
+        last = MIN(next - 1, edge->dx);
+    } else {
+        // y-major: one step per row
+        first = edge->q;
+        last = first;
+    }
+    int32_t a = edge->x + edge->sx * first;
+    int32_t b = edge->x + edge->sx * last;
+    *x0 = MIN(a, b);
+    *x1 = MAX(a, b);
+}
 
-    // Bresenham's line algorithm
-    int dx = abs(x2 - x1);
-    int dy = abs(y2 - y1);
-    int sx = (x1 < x2) ? 1 : -1;
-    int sy = (y1 < y2) ? 1 : -1;
-    int err = dx - dy;
+// Scanline pass over a polygon's edge table. Outlines get each edge's run in every row,
+// filled shapes everything between the outermost runs, which is exact for convex ones.
+// Edges are sorted by their first row and walked incrementally while they cross the
+// rows being drawn, so each row only costs the edges on it
+static void graphics_rasterizePolygon(displayManager_buffer_t* buffer,
+                                      const graphics_point_t* points, uint32_t count,
+                                      bool fill, uint32_t color)
+{
+    if (!points || count == 0 || count > GRAPHICS_MAX_POLYGON_POINTS) {
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!graphics_inRange(points[i].x) || !graphics_inRange(points[i].y)) {
+            return;
+        }
+    }
+    graphics_edge_t edges[GRAPHICS_MAX_POLYGON_POINTS];
+    int32_t ymax = INT32_MIN;
+    for (uint32_t i = 0; i < count; i++) {
+        graphics_edge_t edge;
+        graphics_edgeInit(&edge, points[i], points[(i + 1) % count]);
+        ymax = MAX(ymax, edge.ymax);
+        uint32_t j = i;
+        for (; j > 0 && edges[j - 1].ymin > edge.ymin; j--) {
+            edges[j] = edges[j - 1];
+        }
+        edges[j] = edge;
+    }
+    // Only the rows on the buffer are walked
+    int32_t ymin = MAX(edges[0].ymin, 0);
+    ymax = MIN(ymax, (int32_t)buffer->height - 1);
 
-    while (true) {
-        if (is_in_bounds(buffer, x1, y1)) {
-            display_manager_setBufferPixel(buffer, x1, y1, color);
+    graphics_edge_t* active[GRAPHICS_MAX_POLYGON_POINTS];
+    uint32_t numActive = 0;
+    uint32_t next = 0; // First edge of the table not yet reached
+    graphics_spans_t spans;
+    graphics_spansBegin(&spans, buffer, color);
+    for (int32_t y = ymin; y <= ymax; y++) {
+        for (; next < count && edges[next].ymin <= y; next++) {
+            if (edges[next].ymax >= y) {
+                graphics_edgeStart(&edges[next], y);
+                active[numActive++] = &edges[next];
+            }
         }
+        int32_t left = INT32_MAX;
+        int32_t right = INT32_MIN;
+        for (uint32_t i = 0; i < numActive;) {
+            if (active[i]->ymax < y) {
+                active[i] = active[--numActive]; // Done with this edge
+                continue;
+            }
+            int32_t x0, x1;
+            graphics_edgeRow(active[i], &x0, &x1);
+            graphics_edgeNext(active[i]);
+            if (fill) {
+                left = MIN(left, x0);
+                right = MAX(right, x1);
+            } else {
+                graphics_span(&spans, y, x0, x1);
+            }
+            i++;
+        }
+        if (fill && left <= right) {
+            graphics_span(&spans, y, left, right);
+        }
+    }
+    graphics_spansEnd(&spans);
+}
+
+void graphics_drawPolygon(displayManager_buffer_t* buffer,
+                          const graphics_point_t* points, uint32_t count,
+                          uint32_t color)
+{
+    if (!buffer || !buffer->active) {
+        LOGE("Invalid or inactive buffer");
+        return;
+    }
+    graphics_rasterizePolygon(buffer, points, count, false, color);
+}
+
+void graphics_fillPolygon(displayManager_buffer_t* buffer,
+                          const graphics_point_t* points, uint32_t count,
+                          uint32_t color)
+{
+    if (!buffer || !buffer->active) {
+        LOGE("Invalid or inactive buffer");
+        return;
+    }
+    graphics_rasterizePolygon(buffer, points, count, true, color);
+}
+
+void graphics_drawTriangle(displayManager_buffer_t* buffer,
+                           int32_t x1, int32_t y1,
+                           int32_t x2, int32_t y2,
+                           int32_t x3, int32_t y3,
+                           uint32_t color)
+{
+    if (!buffer || !buffer->active) {
+        LOGE("Invalid or inactive buffer");
+        return;
+    }
+    graphics_point_t points[3] = { { x1, y1 }, { x2, y2 }, { x3, y3 } };
+    graphics_rasterizePolygon(buffer, points, 3, false, color);
+}
+
+void graphics_fillTriangle(displayManager_buffer_t* buffer,
+                           int32_t x1, int32_t y1,
+                           int32_t x2, int32_t y2,
+                           int32_t x3, int32_t y3,
+                           uint32_t color)
+{
+    if (!buffer || !buffer->active) {
+        LOGE("Invalid or inactive buffer");
+        return;
+    }
+    graphics_point_t points[3] = { { x1, y1 }, { x2, y2 }, { x3, y3 } };
+    graphics_rasterizePolygon(buffer, points, 3, true, color);
+}
+
+// Midpoint circle, one octant at a time. Each step gives a pixel (x, y) with x >= y,
+// mirrored into the other seven octants. Rows y come one per step; rows x repeat over
+// several steps, so those are emitted as one run when x moves on
+static void graphics_rasterizeCircle(displayManager_buffer_t* buffer,
+                                     int32_t cx, int32_t cy, int32_t radius,
+                                     bool fill, uint32_t color)
+{
+    if (radius < 0 || !graphics_inRange(cx) || !graphics_inRange(cy) || !graphics_inRange(radius)) {
+        return;
+    }
+    // Nothing to do for circles entirely off the buffer
+    if (cx + radius < 0 || cy + radius < 0 ||
+        cx - radius >= (int32_t)buffer->width || cy - radius >= (int32_t)buffer->height) {
+        return;
+    }
 
-        if (x1 == x2 && y1 == y2) break;
+    graphics_spans_t spans;
+    graphics_spansBegin(&spans, buffer, color);
+    int32_t x = radius;
+    int32_t y = 0;
+    int32_t runStart = 0; // First y seen with the current x
+    int32_t d = 1 - radius;
+    while (x >= y) {
+        if (fill) {
+            graphics_span(&spans, cy + y, cx - x, cx + x);
+            graphics_span(&spans, cy - y, cx - x, cx + x);
+        } else {
+            graphics_span(&spans, cy + y, cx + x, cx + x);
+            graphics_span(&spans, cy + y, cx - x, cx - x);
+            graphics_span(&spans, cy - y, cx + x, cx + x);
+            graphics_span(&spans, cy - y, cx - x, cx - x);
+        }
 
-        int err2 = err * 2;
-        if (err2 > -dy) {
-            err -= dy;
-            x1 += sx;
+        // Where the next step goes, and whether it leaves row x behind
+        int32_t nextX = x;
+        y++;
+        if (d < 0) {
+            d += 2 * y + 1;
+        } else {
+            nextX--;
+            d += 2 * (y - nextX) + 1;
         }
-        if (err2 < dx) {
-            err += dx;
-            y1 += sy;
+        if (nextX != x || nextX < y) {
+            int32_t runEnd = y - 1;
+            if (fill) {
+                graphics_span(&spans, cy + x, cx - runEnd, cx + runEnd);
+                graphics_span(&spans, cy - x, cx - runEnd, cx + runEnd);
+            } else {
+                graphics_span(&spans, cy + x, cx + runStart, cx + runEnd);
+                graphics_span(&spans, cy + x, cx - runEnd, cx - runStart);
+                graphics_span(&spans, cy - x, cx + runStart, cx + runEnd);
+                graphics_span(&spans, cy - x, cx - runEnd, cx - runStart);
+            }
+            runStart = y;
         }
+        x = nextX;
     }
+    graphics_spansEnd(&spans);
+}
 
-    LOGI("Drawing line in buffer '%s' from (%d, %d) to (%d, %d)", 
-         buffer->owner, x1, y1, x2, y2);
-}
\ No newline at end of file
+void graphics_drawCircle(displayManager_buffer_t* buffer,
+                         int32_t cx, int32_t cy, int32_t radius,
+                         uint32_t color)
+{
+    if (!buffer || !buffer->active) {
+        LOGE("Invalid or inactive buffer");
+        return;
+    }
+    graphics_rasterizeCircle(buffer, cx, cy, radius, false, color);
+}
+
+void graphics_fillCircle(displayManager_buffer_t* buffer,
+                         int32_t cx, int32_t cy, int32_t radius,
+                         uint32_t color)
+{
+    if (!buffer || !buffer->active) {
+        LOGE("Invalid or inactive buffer");
+        return;
+    }
+    graphics_rasterizeCircle(buffer, cx, cy, radius, true, color);
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+// Stand-ins for what display_manager.c calls outside the display stack, plus helpers
+// to bring the display manager up and down between tests. Include after
+// display_manager.c: the helpers reach into its statics
+
+#include "genealogy.h"
+#include "neopixel_driver.h"
+#include "hardware.h"
+#include "telnet_log.h"
+#include "frame_stats.h"
+#include "esp_heap_caps.h"
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Geometry genealogy reports, GENEALOGY_UNSET fields fall back to the build defaults
+static genealogy_geometry_t host_geometry = {
+    GENEALOGY_UNSET, GENEALOGY_UNSET, GENEALOGY_UNSET, GENEALOGY_UNSET
+};
+
+// The last frame submitted to the driver, in LED order
+static uint32_t host_leds[DISPLAY_MANAGER_MAX_PIXELS];
+static uint32_t host_num_leds;
+static uint32_t host_frames_submitted;
+
+esp_err_t genealogy_get_geometry(genealogy_geometry_t* geometry)
+{
+    *geometry = host_geometry;
+    return ESP_OK;
+}
+
+esp_err_t genealogy_set_geometry(const genealogy_geometry_t* geometry)
+{
+    host_geometry = *geometry;
+    return ESP_OK;
+}
+
+esp_err_t neopixel_driver_configure(uint32_t leds)
+{
+    if (leds > sizeof(host_leds) / sizeof(host_leds[0])) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    // The driver takes its frame buffer from the heap too
+    void* buffer = heap_caps_calloc(leds, sizeof(uint32_t), MALLOC_CAP_8BIT);
+    if (buffer == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    free(buffer);
+    host_num_leds = leds;
+    return ESP_OK;
+}
+
+void neopixel_driver_submitFrame(const uint32_t* rgb, size_t n)
+{
+    memcpy(host_leds, rgb, n * sizeof(uint32_t));
+    host_frames_submitted++;
+}
+
+void neopixel_driver_setPixel(int index, uint32_t color)
+{
+    host_leds[index] = color;
+}
+
+void neopixel_driver_clearMatrix(void)
+{
+    memset(host_leds, 0, sizeof(host_leds));
+}
+
+void neopixel_driver_fill_matrix(uint32_t rgb)
+{
+    for (uint32_t i = 0; i < host_num_leds; i++) {
+        host_leds[i] = rgb;
+    }
+}
+
+void neopixel_driver_setBrightness(float b)
+{
+    (void)b;
+}
+
+float hardware_getPotentiometerValuef(void)
+{
+    return 1.0f;
+}
+
+void telnet_log_write(const char* fmt, ...)
+{
+    (void)fmt;
+}
+
+bool telnet_log_is_client_connected(void)
+{
+    return false;
+}
+
+void frame_stats_record(frame_stats_stage_E stage, uint32_t duration_us)
+{
+    (void)stage;
+    (void)duration_us;
+}
+
+// Start the display manager on a rows x cols panel
+static void host_display_start(uint32_t rows, uint32_t cols,
+                               displayManager_wiring_E wiring, displayManager_rotation_E rotation)
+{
+    host_geometry = (genealogy_geometry_t){ rows, cols, wiring, rotation };
+    host_frames_submitted = 0;
+    memset(host_leds, 0, sizeof(host_leds));
+    display_manager_init();
+}
+
+// Release everything the display manager holds, so the next test starts from scratch
+static void host_display_stop(void)
+{
+    while (dm_ctx.num_buffers > 0) {
+        display_manager_free_buffer(dm_ctx.buffers[0]);
+    }
+    for (uint32_t i = 0; i < dm_ctx.num_pending_free; i++) {
+        display_manager_releaseBuffer(dm_ctx.pending_free[i]);
+    }
+    display_manager_freeFrameBuffers();
+    memset(&dm_ctx, 0, sizeof(dm_ctx));
+    memset(buffer_pool, 0, sizeof(buffer_pool));
+    host_heap_fail_at = 0;
+    host_heap_limit = SIZE_MAX;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+// Tests run short of memory by failing allocation number host_heap_fail_at (counted in
+// host_heap_allocations, from 1) and every allocation larger than host_heap_limit
+static uint32_t host_heap_allocations;
+static uint32_t host_heap_fail_at;
+static size_t host_heap_limit = SIZE_MAX;
+
+static inline bool host_heap_fails(size_t size)
+{
+    return ++host_heap_allocations == host_heap_fail_at || size > host_heap_limit;
+}
+
+static inline void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return host_heap_fails(size) ? NULL : malloc(size);
+}
+
+static inline void* heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return host_heap_fails(n * size) ? NULL : calloc(n, size);
+}
+
+static inline void heap_caps_free(void* ptr)
+{
+    free(ptr);
+}
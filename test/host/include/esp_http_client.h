@@ -0,0 +1,9 @@
+#pragma once
+
+#include "esp_err.h"
+
+typedef enum
+{
+    HTTP_METHOD_GET = 0,
+    HTTP_METHOD_POST,
+} esp_http_client_method_t;
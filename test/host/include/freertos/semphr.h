@@ -0,0 +1,56 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#include <stdlib.h>
+
+// Counting stand-in: takes succeed while something was given, and never block
+typedef struct
+{
+    uint32_t count;
+} host_semaphore_t;
+
+typedef host_semaphore_t* SemaphoreHandle_t;
+
+static inline SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return calloc(1, sizeof(host_semaphore_t));
+}
+
+static inline SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    SemaphoreHandle_t semaphore = xSemaphoreCreateBinary();
+    if (semaphore) {
+        semaphore->count = 1;
+    }
+    return semaphore;
+}
+
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    (void)ticks;
+    if (semaphore->count == 0) {
+        return pdFALSE;
+    }
+    semaphore->count--;
+    return pdTRUE;
+}
+
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    semaphore->count = 1;
+    return pdTRUE;
+}
+
+static inline BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t* woken)
+{
+    if (woken) {
+        *woken = pdFALSE;
+    }
+    return xSemaphoreGive(semaphore);
+}
+
+static inline void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    free(semaphore);
+}
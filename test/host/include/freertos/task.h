@@ -0,0 +1,83 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+typedef struct host_task* TaskHandle_t;
+
+// The test is the running task. Time only moves when it delays, and notifications
+// are counted per task so a test can see what would have woken each one
+static TickType_t host_ticks;
+struct host_task
+{
+    uint32_t notifications;
+};
+static struct host_task host_task;
+
+static inline TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return &host_task;
+}
+
+static inline TickType_t xTaskGetTickCount(void)
+{
+    return host_ticks;
+}
+
+static inline void vTaskDelay(TickType_t ticks)
+{
+    host_ticks += ticks;
+}
+
+static inline void vTaskDelayUntil(TickType_t* previous, TickType_t period)
+{
+    *previous += period;
+    if ((int32_t)(*previous - host_ticks) > 0) {
+        host_ticks = *previous;
+    }
+}
+
+static inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    task->notifications++;
+    return pdPASS;
+}
+
+// Never blocks: returns what is pending, as if the wait had run out
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    (void)ticks;
+    uint32_t pending = host_task.notifications;
+    if (pending > 0) {
+        host_task.notifications = clear ? 0 : pending - 1;
+    }
+    return pending;
+}
+
+// Tasks are not run on the host; tests call task bodies' pieces directly
+static inline BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stack,
+                                     void* arg, UBaseType_t priority, TaskHandle_t* handle)
+{
+    (void)function;
+    (void)name;
+    (void)stack;
+    (void)arg;
+    (void)priority;
+    if (handle) {
+        *handle = &host_task;
+    }
+    return pdPASS;
+}
+
+static inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stack,
+                                                 void* arg, UBaseType_t priority, TaskHandle_t* handle,
+                                                 BaseType_t core)
+{
+    (void)core;
+    return xTaskCreate(function, name, stack, arg, priority, handle);
+}
+
+static inline void vTaskDelete(TaskHandle_t task)
+{
+    (void)task;
+}
@@ -0,0 +1,595 @@
+// Generated by make_fixture.py from anim_encoder.py, do not edit
+#pragma once
+
+#include <stdint.h>
+
+#define FIXTURE_WIDTH 16
+#define FIXTURE_HEIGHT 8
+#define FIXTURE_FRAMES 64
+
+static const uint8_t fixture[9338] = {
+    0x4C, 0x4D, 0x41, 0x31, 0x10, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7A, 0x24, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00,
+    0x80, 0xBD, 0xDF, 0x7C, 0x43, 0x00, 0x00, 0x00, 0x80, 0xE2, 0xFB, 0x54, 0x41, 0x00, 0x00, 0x00,
+    0x81, 0x81, 0x6B, 0x4B, 0x00, 0x00, 0x00, 0x01, 0x00, 0xA6, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
+    0x80, 0x01, 0xBF, 0x31, 0x3F, 0x01, 0x00, 0x66, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x80, 0x3C,
+    0x59, 0xEA, 0x3F, 0x1C, 0x80, 0x87, 0x59, 0xAA, 0x0A, 0x80, 0x0F, 0x47, 0x67, 0x01, 0x00, 0x6F,
+    0x00, 0x91, 0x00, 0x00, 0x00, 0x80, 0x67, 0xA2, 0xE3, 0x0B, 0x81, 0xAB, 0x33, 0x8D, 0xDC, 0x29,
+    0x6D, 0x01, 0x80, 0xA8, 0x64, 0xC7, 0x02, 0x81, 0x71, 0x36, 0x8F, 0xFA, 0x88, 0x74, 0x00, 0x81,
+    0x49, 0xB2, 0x01, 0x52, 0xD3, 0x52, 0x02, 0x81, 0x06, 0x9F, 0xEA, 0xAC, 0x32, 0x88, 0x05, 0x81,
+    0xA0, 0x21, 0x31, 0xDA, 0xE4, 0x86, 0x07, 0x80, 0x33, 0x3D, 0x91, 0x00, 0x80, 0x9C, 0x52, 0x46,
+    0x02, 0x81, 0xC2, 0x06, 0x13, 0xEE, 0x43, 0x78, 0x02, 0x80, 0xB1, 0xC3, 0x93, 0x04, 0x80, 0x1D,
+    0xA5, 0x0D, 0x03, 0x80, 0x09, 0xDC, 0x53, 0x06, 0x81, 0xAA, 0x3B, 0x48, 0xFF, 0x56, 0xE1, 0x07,
+    0x82, 0xF6, 0x39, 0x1D, 0x3C, 0x54, 0x55, 0xC7, 0x01, 0x1B, 0x00, 0x81, 0xCA, 0xE0, 0x60, 0x41,
+    0xBB, 0x6D, 0x03, 0x80, 0xF3, 0xBF, 0x09, 0x03, 0x80, 0x68, 0x74, 0xA6, 0x08, 0x81, 0x20, 0xFB,
+    0x8F, 0x8E, 0x0F, 0x70, 0x02, 0x81, 0x98, 0x7C, 0x17, 0x8E, 0x5F, 0xD9, 0x03, 0x80, 0xD2, 0x85,
+    0xA1, 0x01, 0x80, 0x5E, 0x8F, 0x3E, 0x01, 0x00, 0x0F, 0x00, 0x52, 0x01, 0x00, 0x00, 0x85, 0x98,
+    0xF6, 0xFB, 0x89, 0xE4, 0xA4, 0x33, 0x5C, 0x50, 0xBF, 0xB1, 0xCD, 0xE1, 0x9E, 0x18, 0xDF, 0x51,
+    0xBC, 0x00, 0x82, 0x1B, 0xBF, 0xE3, 0xED, 0x79, 0x99, 0xC2, 0x42, 0x00, 0x00, 0x80, 0xEF, 0x14,
+    0xC6, 0x00, 0x80, 0xE5, 0x90, 0x11, 0x02, 0x84, 0x25, 0xE7, 0x96, 0x0D, 0x61, 0x2E, 0x51, 0xD2,
+    0x3A, 0x9F, 0xB0, 0x6D, 0x9B, 0x80, 0x1F, 0x00, 0x86, 0xE0, 0xB9, 0x85, 0xA2, 0xD3, 0x89, 0x8F,
+    0x5C, 0x70, 0x8E, 0x42, 0x14, 0xEA, 0x26, 0x2C, 0x35, 0x6A, 0x74, 0x8A, 0x6E, 0x5F, 0x00, 0x83,
+    0x45, 0xD6, 0x2A, 0xF0, 0x28, 0x4F, 0xE6, 0x18, 0x59, 0xD1, 0xED, 0x77, 0x00, 0x85, 0x30, 0x0F,
+    0xE4, 0xF9, 0x5E, 0xAA, 0xCE, 0x7D, 0xC1, 0x0F, 0x04, 0xCE, 0xDE, 0xF2, 0x38, 0x65, 0x5D, 0x17,
+    0x00, 0x8C, 0x50, 0x38, 0x7E, 0xCF, 0x72, 0x6A, 0x80, 0xD1, 0xE6, 0x1F, 0xA5, 0xFC, 0x0C, 0x83,
+    0x3A, 0x42, 0x1A, 0xD4, 0x80, 0x80, 0x5F, 0xD4, 0xDA, 0x7F, 0x00, 0x3A, 0xFE, 0x80, 0xA6, 0x89,
+    0x5A, 0x2D, 0x15, 0x9C, 0x5D, 0x78, 0x11, 0x0D, 0xC7, 0x01, 0x81, 0xC1, 0x5B, 0x23, 0x5D, 0xBB,
+    0x35, 0x00, 0x84, 0xE9, 0x2F, 0x78, 0x30, 0xB6, 0xAE, 0xEE, 0x25, 0x25, 0x33, 0xE1, 0x0F, 0x4D,
+    0x6A, 0x4B, 0x00, 0x80, 0x30, 0xE7, 0xB0, 0x00, 0x8C, 0x8B, 0x12, 0xB2, 0xDA, 0x96, 0xC8, 0x0A,
+    0xE4, 0x52, 0xD9, 0x56, 0xBB, 0x38, 0x2E, 0xE9, 0x3D, 0xD7, 0x45, 0xC4, 0x1C, 0xF7, 0xB0, 0x22,
+    0x15, 0x86, 0x64, 0x46, 0xBB, 0x13, 0xC5, 0x47, 0x0C, 0xA6, 0x32, 0x72, 0x90, 0xC5, 0x02, 0xF7,
+    0x01, 0x80, 0x6B, 0xAF, 0x70, 0x00, 0x82, 0xBA, 0x6B, 0xAB, 0x8C, 0x90, 0xE4, 0x5A, 0x07, 0x59,
+    0x01, 0x87, 0xA1, 0x1D, 0x89, 0x4F, 0x67, 0xB0, 0xF4, 0x6E, 0x4A, 0xDF, 0xB2, 0xF7, 0x63, 0xA8,
+    0xF6, 0xEB, 0x72, 0x84, 0xDC, 0x62, 0x48, 0xC5, 0xA8, 0x4F, 0x00, 0x82, 0xCC, 0x58, 0xAF, 0xF6,
+    0xE4, 0xC0, 0x42, 0x6C, 0x9D, 0x01, 0x82, 0xD9, 0xF9, 0xB5, 0xAD, 0xC2, 0xD7, 0x19, 0x24, 0xC4,
+    0x01, 0x81, 0xD6, 0x14, 0x85, 0x05, 0x7D, 0x85, 0x00, 0x81, 0x15, 0xC8, 0xA0, 0x5E, 0x41, 0x34,
+    0x02, 0x89, 0x6D, 0x13, 0x81, 0xF9, 0xDC, 0x38, 0x96, 0x69, 0x3F, 0x95, 0x79, 0xBD, 0x3F, 0xC0,
+    0x68, 0x27, 0xA5, 0xE3, 0x5B, 0x1E, 0x70, 0x1C, 0xD1, 0x05, 0x00, 0x06, 0xDF, 0x94, 0x37, 0x36,
+    0x01, 0x00, 0xC7, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2B, 0x80, 0xF5, 0x79, 0x36, 0x3F, 0x01, 0x00,
+    0x5F, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x3F, 0x01, 0x80, 0x91, 0xB1, 0x76, 0x02, 0x80, 0x66, 0x89,
+    0x21, 0x02, 0x80, 0x46, 0xAF, 0x50, 0x06, 0x80, 0x0D, 0x72, 0x8D, 0x0F, 0x80, 0x58, 0xE3, 0x9C,
+    0x01, 0x00, 0x36, 0x00, 0x06, 0x00, 0x00, 0x00, 0x27, 0x80, 0x58, 0x63, 0x27, 0x3F, 0x01, 0x00,
+    0x06, 0x00, 0x5F, 0x01, 0x00, 0x00, 0x81, 0xC5, 0xFD, 0x54, 0x9A, 0x02, 0xB2, 0x00, 0x95, 0x82,
+    0x81, 0x93, 0x24, 0x80, 0x4A, 0xBB, 0x4A, 0xF4, 0xB3, 0x8D, 0x7F, 0x70, 0x76, 0x7C, 0x9C, 0x73,
+    0x38, 0xEA, 0x73, 0x2B, 0xA1, 0x67, 0x71, 0x16, 0x49, 0xC0, 0xE7, 0x25, 0x14, 0x45, 0xB9, 0x46,
+    0x35, 0xCB, 0xA1, 0x98, 0xFB, 0x20, 0x9B, 0x5C, 0xCD, 0xAB, 0xF1, 0xE9, 0x44, 0x86, 0xE6, 0x1C,
+    0x7A, 0x0B, 0xC8, 0x11, 0x01, 0x5A, 0x5D, 0x6C, 0xD0, 0x71, 0x1C, 0x15, 0xE1, 0x89, 0x73, 0xFA,
+    0xBB, 0x00, 0x82, 0x61, 0x8E, 0xBA, 0xB7, 0x3A, 0x02, 0xCE, 0x14, 0xFE, 0x00, 0x82, 0x30, 0x6F,
+    0xB6, 0xCC, 0x24, 0x3C, 0xBB, 0xA8, 0x99, 0x00, 0x80, 0xBE, 0xEC, 0xD8, 0x00, 0x81, 0x66, 0xE1,
+    0xDE, 0x59, 0x17, 0x74, 0x00, 0x88, 0x8B, 0xDE, 0x4B, 0x44, 0xCE, 0x07, 0x07, 0x0F, 0xD6, 0x52,
+    0x90, 0xEB, 0x71, 0x74, 0x54, 0xD7, 0xB9, 0xC7, 0x74, 0x3D, 0xCF, 0x96, 0x97, 0x4F, 0xEC, 0x4B,
+    0x19, 0x00, 0x8A, 0x8B, 0xDD, 0x8B, 0xBD, 0xD2, 0xD4, 0x0F, 0xB3, 0xE4, 0x69, 0x61, 0x6B, 0x15,
+    0x43, 0x3F, 0xD9, 0xD7, 0x52, 0x6F, 0x70, 0x9B, 0xE9, 0x7A, 0xB6, 0x3C, 0xF7, 0xEF, 0x03, 0x24,
+    0x94, 0xBB, 0xCC, 0xA2, 0x00, 0x83, 0xCD, 0x0B, 0x8F, 0x9C, 0x66, 0xB2, 0xD2, 0xB4, 0xC7, 0x51,
+    0x8F, 0x04, 0x01, 0x81, 0xFD, 0x59, 0xF7, 0xE6, 0x6D, 0xFE, 0x00, 0x81, 0x38, 0xC2, 0x8D, 0xC4,
+    0x78, 0xF0, 0x04, 0x80, 0x32, 0x1B, 0xA5, 0x00, 0x87, 0xDC, 0x4C, 0x85, 0xEC, 0xB0, 0xDF, 0x9B,
+    0xED, 0x9B, 0x21, 0x29, 0xEE, 0xAB, 0x7A, 0x34, 0x2C, 0x52, 0xE0, 0xDB, 0x8D, 0x66, 0x26, 0x71,
+    0xFF, 0x00, 0x88, 0x7B, 0x60, 0x1F, 0x56, 0xC8, 0x24, 0xD0, 0x32, 0xB0, 0x3C, 0xE9, 0x71, 0x44,
+    0x03, 0xFB, 0x09, 0x9E, 0x14, 0x88, 0x26, 0x14, 0xD3, 0x37, 0x5C, 0xE8, 0x3D, 0xEB, 0x00, 0x80,
+    0x7F, 0x6C, 0x71, 0x00, 0x80, 0xD3, 0x8A, 0x9B, 0x00, 0x80, 0x66, 0x7B, 0x46, 0x00, 0x83, 0x66,
+    0xED, 0xEE, 0x80, 0x4D, 0xE8, 0xDD, 0x0F, 0x23, 0x91, 0x8A, 0x5A, 0x00, 0x82, 0xBD, 0x78, 0xD3,
+    0xF9, 0x75, 0x2E, 0x7B, 0x4C, 0x80, 0x00, 0x8E, 0xA9, 0xDC, 0x67, 0x1F, 0x29, 0x99, 0xB6, 0x7B,
+    0xF4, 0x93, 0xB3, 0x1A, 0xB8, 0x4E, 0x66, 0xAA, 0xDA, 0x0E, 0x59, 0x53, 0xC1, 0x04, 0x9C, 0x87,
+    0x31, 0x7E, 0xCE, 0x5A, 0x0A, 0x9A, 0xAF, 0xC6, 0x83, 0x19, 0x6D, 0x21, 0xBE, 0x1E, 0x6B, 0xC4,
+    0x1B, 0xDF, 0x9C, 0x1A, 0x76, 0x01, 0x00, 0x52, 0x00, 0x99, 0x00, 0x00, 0x00, 0x01, 0x82, 0x38,
+    0x25, 0x0F, 0x48, 0x84, 0x5D, 0x13, 0xE5, 0x02, 0x00, 0x82, 0xDE, 0x94, 0xF9, 0xA6, 0x38, 0x31,
+    0xDB, 0xE1, 0x26, 0x01, 0x80, 0x27, 0x29, 0x5E, 0x01, 0x80, 0xF0, 0xA7, 0x4B, 0x02, 0x80, 0xA3,
+    0x4C, 0x79, 0x02, 0x80, 0xD6, 0xDD, 0xE8, 0x02, 0x81, 0xD6, 0xCA, 0x2D, 0x64, 0xB4, 0x6C, 0x01,
+    0x81, 0xDE, 0xF6, 0x0E, 0xFE, 0xF2, 0x5C, 0x01, 0x80, 0x1A, 0x19, 0x55, 0x03, 0x80, 0x74, 0x5E,
+    0x70, 0x00, 0x80, 0xCE, 0xC7, 0x01, 0x11, 0x80, 0xD6, 0xDC, 0x55, 0x00, 0x80, 0x67, 0xD0, 0xF1,
+    0x01, 0x81, 0xBA, 0xC6, 0x53, 0x33, 0x3D, 0xEA, 0x02, 0x81, 0x63, 0x50, 0x19, 0xFC, 0x77, 0x80,
+    0x02, 0x80, 0x6E, 0x30, 0xA6, 0x03, 0x80, 0x03, 0x89, 0x40, 0x0B, 0x81, 0xEF, 0x2F, 0x34, 0x8D,
+    0x37, 0x3C, 0x02, 0x80, 0xCF, 0x62, 0x6D, 0x07, 0x80, 0x80, 0xC5, 0xD6, 0x00, 0x80, 0x55, 0x0C,
+    0x51, 0x04, 0x80, 0x39, 0xA2, 0x13, 0x00, 0x80, 0x6C, 0x29, 0x48, 0x00, 0x82, 0xA9, 0xD4, 0xE2,
+    0x35, 0x76, 0xD4, 0x5C, 0x88, 0x5A, 0x01, 0x00, 0x31, 0x00, 0x5F, 0x01, 0x00, 0x00, 0x00, 0x82,
+    0xC2, 0xE0, 0xA0, 0x40, 0xE4, 0xFB, 0xE3, 0x44, 0xD6, 0x00, 0x84, 0xF6, 0x8D, 0x3D, 0x3E, 0xE0,
+    0xA5, 0xF2, 0x91, 0xE7, 0xFB, 0xD7, 0x27, 0x4E, 0x1A, 0xA0, 0x00, 0x83, 0x59, 0x66, 0xAB, 0x33,
+    0x7B, 0x96, 0xF1, 0x4A, 0x54, 0x22, 0xBC, 0x97, 0x00, 0x85, 0xBC, 0x7B, 0xD3, 0x5E, 0x25, 0x10,
+    0xCF, 0x90, 0xA2, 0x55, 0xD9, 0x23, 0xA2, 0x3F, 0x69, 0xF2, 0x7A, 0x5A, 0x01, 0x93, 0xA0, 0x23,
+    0x2D, 0x2B, 0x65, 0xD2, 0x77, 0x2D, 0xB8, 0x17, 0xB5, 0x36, 0x4D, 0x7F, 0xAC, 0xC8, 0x60, 0xCD,
+    0x3B, 0x4F, 0x04, 0x08, 0x29, 0xB8, 0x04, 0x12, 0x47, 0xA4, 0xC8, 0x13, 0x23, 0x11, 0xA8, 0xD0,
+    0x3A, 0x4D, 0x0F, 0xDF, 0x81, 0x4C, 0x0A, 0x2A, 0x65, 0xFD, 0x8E, 0x80, 0x26, 0x22, 0x0D, 0x84,
+    0x9D, 0x42, 0x8E, 0x16, 0x89, 0xB5, 0x67, 0x05, 0x4D, 0x62, 0x00, 0x85, 0x58, 0x6C, 0x23, 0x11,
+    0xFB, 0x91, 0xF9, 0x7F, 0xC6, 0x89, 0x24, 0x34, 0x74, 0x89, 0x25, 0x37, 0x80, 0xB6, 0x02, 0x80,
+    0xE1, 0xC9, 0x79, 0x00, 0x88, 0x1B, 0x47, 0x9B, 0x0B, 0x8A, 0x57, 0xBE, 0x00, 0xFD, 0x75, 0x21,
+    0x36, 0x1B, 0x04, 0xBD, 0xE0, 0x64, 0x77, 0xF5, 0x46, 0x55, 0x4A, 0x7F, 0xB6, 0xBC, 0x4E, 0xAA,
+    0x00, 0x88, 0x29, 0x8D, 0x61, 0xEE, 0x36, 0x23, 0xFE, 0x58, 0xFE, 0xAA, 0xCF, 0xB1, 0x23, 0x15,
+    0x85, 0x68, 0x1C, 0xEB, 0xB6, 0xA2, 0x13, 0xB7, 0x67, 0xF9, 0x76, 0xC8, 0x66, 0x00, 0x83, 0xC1,
+    0x3D, 0xAE, 0xD4, 0x51, 0x02, 0xB6, 0xE4, 0x93, 0x53, 0x72, 0x31, 0x01, 0x80, 0x05, 0x75, 0x93,
+    0x00, 0x88, 0x46, 0x17, 0xD5, 0xAA, 0x77, 0x1E, 0x94, 0x89, 0xEF, 0x24, 0xE7, 0x31, 0x70, 0x27,
+    0xA5, 0x6A, 0xA4, 0x35, 0xA3, 0xB4, 0x61, 0x8F, 0x90, 0x47, 0x9B, 0x14, 0x3E, 0x00, 0x81, 0x29,
+    0x75, 0x11, 0xB1, 0xEC, 0xA0, 0x00, 0x85, 0xD3, 0xD3, 0x00, 0x3B, 0x9B, 0xBD, 0x01, 0x06, 0xF0,
+    0x82, 0xB8, 0x70, 0x35, 0x6B, 0xE9, 0xE5, 0x82, 0xFB, 0x00, 0x80, 0x40, 0x86, 0x32, 0x00, 0x82,
+    0xEE, 0x0A, 0x17, 0x1A, 0x06, 0xDB, 0xE3, 0xB8, 0xC3, 0x00, 0x86, 0x1F, 0x55, 0xD0, 0xBD, 0x44,
+    0x38, 0x4E, 0xCE, 0x93, 0xC7, 0x45, 0x29, 0x9C, 0x4F, 0xD0, 0x49, 0x3B, 0x41, 0x8B, 0xBC, 0xE8,
+    0x00, 0x80, 0xF6, 0xC4, 0x32, 0x00, 0x81, 0x9F, 0xF7, 0x49, 0x37, 0xCC, 0x0B, 0x00, 0x81, 0x6E,
+    0xDF, 0x29, 0x80, 0x7D, 0x64, 0x00, 0x81, 0xA6, 0x35, 0x40, 0x74, 0x25, 0x41, 0x01, 0x00, 0x98,
+    0x00, 0x54, 0x01, 0x00, 0x00, 0x00, 0x82, 0xDF, 0x42, 0x97, 0x7A, 0x7D, 0x15, 0x7C, 0xBD, 0xA2,
+    0x00, 0x80, 0x22, 0xC4, 0x1F, 0x01, 0x81, 0xC2, 0x57, 0x2F, 0x63, 0x4A, 0xCE, 0x01, 0x83, 0x00,
+    0x44, 0x8C, 0xF6, 0xED, 0x25, 0xEA, 0x06, 0x70, 0xA4, 0xE7, 0x22, 0x02, 0x81, 0xA7, 0x7A, 0x2D,
+    0x63, 0x93, 0x4D, 0x00, 0x88, 0xBD, 0xFF, 0x53, 0x58, 0x6A, 0xF4, 0xFC, 0x15, 0xB4, 0xFB, 0x3C,
+    0x3A, 0xBA, 0xDA, 0x19, 0x3E, 0x26, 0x2A, 0xAC, 0x5F, 0x5A, 0x27, 0x49, 0xB6, 0x6D, 0xBE, 0xB2,
+    0x00, 0x82, 0x68, 0xFE, 0x53, 0xC6, 0xE4, 0xE6, 0xD4, 0x94, 0x77, 0x01, 0x81, 0x6A, 0x42, 0x2D,
+    0x0D, 0x34, 0x72, 0x00, 0x85, 0xE5, 0xC1, 0x65, 0x01, 0xEB, 0xD5, 0x6D, 0xB5, 0x32, 0x35, 0x73,
+    0x48, 0xEB, 0xC8, 0xB1, 0x1B, 0x6D, 0x4D, 0x00, 0x89, 0xEA, 0xE2, 0x8C, 0x2A, 0x77, 0xE0, 0x59,
+    0x34, 0xBB, 0xE1, 0xDC, 0xCE, 0x35, 0x57, 0xD1, 0xA5, 0x75, 0xCA, 0xB8, 0x7A, 0x7C, 0x7A, 0x05,
+    0x4D, 0xF9, 0xEE, 0xF5, 0xB2, 0xB7, 0xC3, 0x02, 0x91, 0xDB, 0x4E, 0x66, 0x62, 0xEC, 0xDD, 0xCF,
+    0xAB, 0x66, 0x1C, 0x35, 0x5D, 0x91, 0x23, 0xE0, 0xDB, 0xA3, 0x7A, 0x7A, 0x2F, 0x64, 0x53, 0xDA,
+    0x64, 0x8B, 0x7A, 0xE0, 0x68, 0x11, 0x54, 0x9D, 0xEB, 0x0B, 0xAF, 0xF5, 0x85, 0x8D, 0x64, 0x95,
+    0x73, 0x5B, 0xE9, 0x58, 0x2A, 0xD2, 0x82, 0xF2, 0x3B, 0x59, 0xB7, 0x12, 0xB9, 0xD7, 0x48, 0x00,
+    0x87, 0x2F, 0x70, 0x96, 0x17, 0x4C, 0xB2, 0x04, 0x97, 0x6B, 0x5C, 0xFD, 0x06, 0x3A, 0x66, 0x8D,
+    0xD5, 0x87, 0xF0, 0xEA, 0x7F, 0xD5, 0x7C, 0x2D, 0x26, 0x00, 0x86, 0x24, 0x4D, 0x03, 0xA2, 0x27,
+    0x63, 0x6F, 0x31, 0x3B, 0x68, 0x98, 0xE0, 0x6C, 0x0F, 0x3B, 0xAD, 0x97, 0x24, 0x05, 0xA9, 0x82,
+    0x00, 0x87, 0xCA, 0x4D, 0xF7, 0xB4, 0x3A, 0x78, 0x48, 0x83, 0xF1, 0x45, 0xA4, 0x6B, 0xC9, 0xC0,
+    0xF7, 0xE4, 0xD1, 0x45, 0xAF, 0x12, 0x45, 0x4B, 0x88, 0x60, 0x00, 0x85, 0xC1, 0x91, 0xDB, 0x2F,
+    0x4A, 0x9E, 0x95, 0xB7, 0xD4, 0xBA, 0x16, 0x29, 0x96, 0x8B, 0x3F, 0xEE, 0xF7, 0xC2, 0x00, 0x83,
+    0x42, 0xB6, 0x79, 0x64, 0x10, 0x5A, 0x95, 0xB2, 0x65, 0x12, 0x84, 0x21, 0x00, 0x88, 0xE3, 0x35,
+    0x78, 0xEF, 0xC1, 0x30, 0xE8, 0xB8, 0xE5, 0x1E, 0x76, 0xE9, 0x30, 0x37, 0x00, 0x00, 0xCF, 0xF6,
+    0x1D, 0xAD, 0x53, 0x53, 0x17, 0x1A, 0xA2, 0x5D, 0x40, 0x01, 0x00, 0x70, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x3F, 0x05, 0x80, 0xB0, 0x99, 0x8E, 0x01, 0x00, 0x52, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3C,
+    0x80, 0xDF, 0x42, 0x5A, 0x07, 0x80, 0x60, 0xFE, 0xF1, 0x1E, 0x80, 0x74, 0x46, 0x90, 0x01, 0x00,
+    0xC3, 0x00, 0x5D, 0x01, 0x00, 0x00, 0x00, 0x8D, 0x7C, 0xA6, 0xFA, 0x42, 0xDF, 0xD3, 0x33, 0x9F,
+    0x6D, 0xC0, 0x90, 0x90, 0xFF, 0x1B, 0xA8, 0x10, 0x02, 0x08, 0x80, 0xF6, 0xC9, 0xB4, 0x95, 0xE3,
+    0x67, 0x20, 0x36, 0x73, 0xAF, 0xC3, 0x96, 0x9B, 0x53, 0xDA, 0xEB, 0x7C, 0x00, 0x61, 0xB6, 0x01,
+    0xF3, 0xA3, 0x00, 0x82, 0x9B, 0x84, 0x91, 0xCB, 0x18, 0xB0, 0x91, 0xF2, 0xD2, 0x00, 0x80, 0x40,
+    0x58, 0x90, 0x00, 0x80, 0xE8, 0xB1, 0xF0, 0x00, 0x81, 0x08, 0x2F, 0x04, 0x31, 0xF5, 0xF1, 0x00,
+    0x86, 0xC7, 0x94, 0xC1, 0xE7, 0x64, 0x35, 0xE4, 0x4A, 0xF5, 0xD8, 0x17, 0xC4, 0xD4, 0x6C, 0x74,
+    0x57, 0xD2, 0xFB, 0x4D, 0xD3, 0x82, 0x00, 0x85, 0x1F, 0x06, 0x0A, 0x16, 0x64, 0x6C, 0xCD, 0x10,
+    0x86, 0x9E, 0x35, 0x20, 0x0E, 0xD6, 0xE1, 0xB7, 0x36, 0x6A, 0x00, 0x80, 0x0D, 0x45, 0x2F, 0x00,
+    0x81, 0x7A, 0xBD, 0x69, 0xC5, 0x89, 0xBD, 0x00, 0x80, 0x53, 0xED, 0xA3, 0x00, 0x81, 0x9A, 0xCC,
+    0x29, 0x4E, 0x0D, 0x9F, 0x00, 0x81, 0x3B, 0x6C, 0xE9, 0xE9, 0x48, 0xB9, 0x00, 0x80, 0x49, 0x13,
+    0xBA, 0x00, 0x82, 0x7D, 0x01, 0x63, 0xE2, 0xA9, 0x53, 0xB1, 0xF8, 0x04, 0x01, 0x81, 0x5D, 0x4F,
+    0x56, 0x1A, 0x5C, 0xA2, 0x00, 0x8D, 0x1F, 0x81, 0x9D, 0x25, 0x31, 0xFE, 0xD4, 0x25, 0x13, 0xC3,
+    0xE7, 0xA5, 0xBD, 0xD0, 0x50, 0xD0, 0x2D, 0xAC, 0x53, 0x72, 0xF5, 0x52, 0xF0, 0x2D, 0x89, 0x89,
+    0x1F, 0x29, 0x5B, 0x9D, 0x14, 0xB2, 0x84, 0x13, 0x58, 0x80, 0xA7, 0x7F, 0xDF, 0xA6, 0xAA, 0x72,
+    0x01, 0x80, 0xE2, 0x72, 0xFB, 0x00, 0x81, 0xB1, 0xDF, 0xDA, 0x78, 0xC9, 0x62, 0x00, 0x80, 0xEE,
+    0x37, 0x75, 0x00, 0x87, 0x4F, 0xA1, 0x2F, 0xD5, 0x86, 0xF4, 0xAD, 0x63, 0xAF, 0x4E, 0x72, 0xA0,
+    0xD2, 0xED, 0xDC, 0xF4, 0x95, 0xD0, 0xA0, 0xC8, 0x0C, 0x3A, 0x16, 0xDD, 0x00, 0x86, 0x42, 0xE0,
+    0xFF, 0xC3, 0xC3, 0x7F, 0xA9, 0x02, 0x3C, 0x5F, 0x3E, 0x89, 0xD0, 0x6F, 0x1E, 0x48, 0x27, 0x93,
+    0x50, 0x8B, 0x7E, 0x00, 0x83, 0xFF, 0xA9, 0xD3, 0x71, 0x86, 0x0E, 0xC6, 0xDA, 0x67, 0xAF, 0xED,
+    0x30, 0x00, 0x80, 0xFC, 0xAA, 0x27, 0x00, 0x81, 0xCE, 0x4F, 0xB1, 0xAB, 0xE7, 0x1E, 0x01, 0x88,
+    0xF6, 0x58, 0x13, 0xD6, 0xB9, 0x5F, 0xD7, 0x41, 0xB6, 0xBE, 0x7D, 0x3C, 0xDA, 0x9B, 0x9B, 0xD6,
+    0x2C, 0x42, 0x2B, 0x23, 0xC1, 0x04, 0x8F, 0x56, 0x3D, 0x6B, 0x0E, 0x00, 0x81, 0x4C, 0x98, 0x1B,
+    0xCB, 0xBD, 0xF8, 0x01, 0x00, 0x6D, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x80, 0x26, 0x6E, 0xD2,
+    0x00, 0x80, 0x9E, 0x4E, 0xCE, 0x00, 0x81, 0x5E, 0x35, 0x17, 0x57, 0x15, 0x25, 0x09, 0x80, 0xFB,
+    0x7B, 0x69, 0x00, 0x80, 0x1E, 0x2D, 0xD7, 0x03, 0x81, 0x15, 0x9F, 0xAA, 0xC7, 0x73, 0x84, 0x05,
+    0x80, 0x8B, 0x2D, 0xFB, 0x01, 0x80, 0xF4, 0x16, 0x99, 0x02, 0x80, 0x47, 0x7B, 0xEB, 0x02, 0x80,
+    0x28, 0x92, 0x77, 0x01, 0x80, 0xB5, 0x25, 0x64, 0x03, 0x80, 0x70, 0x07, 0x35, 0x0D, 0x80, 0xD8,
+    0x86, 0x65, 0x00, 0x82, 0x59, 0x36, 0xAC, 0xA8, 0x7A, 0xF5, 0x76, 0xB5, 0xD4, 0x00, 0x80, 0x93,
+    0x4D, 0x3B, 0x00, 0x80, 0xEB, 0x66, 0x20, 0x01, 0x80, 0x8A, 0x4F, 0x43, 0x02, 0x80, 0x4C, 0xC1,
+    0x70, 0x00, 0x80, 0x56, 0xE9, 0x86, 0x01, 0x80, 0x7E, 0x36, 0xA6, 0x06, 0x80, 0x83, 0x09, 0x79,
+    0x09, 0x80, 0xB7, 0xD4, 0x45, 0x02, 0x80, 0x7B, 0x43, 0x43, 0x07, 0x80, 0xEF, 0x19, 0xBD, 0x01,
+    0x84, 0x90, 0x79, 0x12, 0x96, 0x01, 0x71, 0xF5, 0x61, 0xAB, 0xE3, 0x52, 0xE5, 0x23, 0x23, 0x92,
+    0x00, 0x00, 0x87, 0x00, 0x82, 0x01, 0x00, 0x00, 0xBF, 0xC5, 0xFD, 0x54, 0x26, 0x6E, 0xD2, 0x42,
+    0xDF, 0xD3, 0x9E, 0x4E, 0xCE, 0xC0, 0x90, 0x90, 0x5E, 0x35, 0x17, 0x57, 0x15, 0x25, 0x14, 0x2E,
+    0xE7, 0xB4, 0x95, 0xE3, 0x67, 0x20, 0x36, 0x73, 0xAF, 0xC3, 0x96, 0x9B, 0x53, 0xDA, 0xEB, 0x7C,
+    0x00, 0x61, 0xB6, 0x01, 0xF3, 0xA3, 0xA4, 0xE7, 0x22, 0x9B, 0x84, 0x91, 0xFB, 0x7B, 0x69, 0x91,
+    0xF2, 0xD2, 0x1E, 0x2D, 0xD7, 0x40, 0x58, 0x90, 0xF2, 0x7A, 0x5A, 0xE8, 0xB1, 0xF0, 0x58, 0x6A,
+    0xF4, 0x15, 0x9F, 0xAA, 0xC7, 0x73, 0x84, 0xBA, 0xDA, 0x19, 0xC7, 0x94, 0xC1, 0xE7, 0x64, 0x35,
+    0xE4, 0x4A, 0xF5, 0xD8, 0x17, 0xC4, 0xD4, 0x6C, 0x74, 0x8B, 0x2D, 0xFB, 0x4D, 0xD3, 0x82, 0xD4,
+    0x94, 0x77, 0xF4, 0x16, 0x99, 0x16, 0x64, 0x6C, 0xCD, 0x10, 0x86, 0x9E, 0x35, 0x20, 0x47, 0x7B,
+    0xEB, 0xB7, 0x36, 0x6A, 0x01, 0xEB, 0xD5, 0x0D, 0x45, 0x2F, 0x28, 0x92, 0x77, 0x7A, 0xBD, 0x69,
+    0xC5, 0x89, 0xBD, 0xB5, 0x25, 0x64, 0x53, 0xED, 0xA3, 0x2A, 0x77, 0xE0, 0x9A, 0xCC, 0x29, 0x4E,
+    0x0D, 0x9F, 0x70, 0x07, 0x35, 0x3B, 0x6C, 0xE9, 0xE9, 0x48, 0xB9, 0x7A, 0x05, 0x4D, 0x49, 0x13,
+    0xBA, 0xB2, 0xB7, 0xC3, 0x7D, 0x01, 0x63, 0xE2, 0xA9, 0x53, 0xB1, 0xF8, 0x04, 0xDB, 0x4E, 0x66,
+    0xDF, 0x42, 0x5A, 0x5D, 0x4F, 0x56, 0x1A, 0x5C, 0xA2, 0xBF, 0x91, 0x23, 0xE0, 0x1F, 0x81, 0x9D,
+    0xD8, 0x86, 0x65, 0xD4, 0x25, 0x13, 0x59, 0x36, 0xAC, 0xA8, 0x7A, 0xF5, 0x76, 0xB5, 0xD4, 0x53,
+    0x72, 0xF5, 0x93, 0x4D, 0x3B, 0x89, 0x89, 0x1F, 0xEB, 0x66, 0x20, 0x14, 0xB2, 0x84, 0x13, 0x58,
+    0x80, 0x8A, 0x4F, 0x43, 0xA6, 0xAA, 0x72, 0x2F, 0x70, 0x96, 0x17, 0x4C, 0xB2, 0x4C, 0xC1, 0x70,
+    0x5C, 0xFD, 0x06, 0x56, 0xE9, 0x86, 0x78, 0xC9, 0x62, 0xEA, 0x7F, 0xD5, 0x7E, 0x36, 0xA6, 0x24,
+    0xE7, 0x31, 0x4F, 0xA1, 0x2F, 0xD5, 0x86, 0xF4, 0xAD, 0x63, 0xAF, 0x4E, 0x72, 0xA0, 0xD2, 0xED,
+    0xDC, 0xF4, 0x95, 0xD0, 0x83, 0x09, 0x79, 0x3A, 0x16, 0xDD, 0xCA, 0x4D, 0xF7, 0x42, 0xE0, 0xFF,
+    0xC3, 0xC3, 0x7F, 0xA1, 0x7E, 0xAB, 0x5F, 0x3E, 0x89, 0xD0, 0x6F, 0x1E, 0x48, 0x27, 0x93, 0x50,
+    0x8B, 0x7E, 0x40, 0x86, 0x32, 0xB7, 0xD4, 0x45, 0x71, 0x86, 0x0E, 0xC6, 0xDA, 0x67, 0xAF, 0xED,
+    0x30, 0x7B, 0x43, 0x43, 0xFC, 0xAA, 0x27, 0xBD, 0x44, 0x38, 0xCE, 0x4F, 0xB1, 0xAB, 0xE7, 0x1E,
+    0x95, 0xB2, 0x65, 0x12, 0x84, 0x21, 0xF6, 0x58, 0x13, 0xD6, 0xB9, 0x5F, 0xEF, 0x19, 0xBD, 0xBE,
+    0x7D, 0x3C, 0xDA, 0x9B, 0x9B, 0x90, 0x79, 0x12, 0x96, 0x01, 0x71, 0xF5, 0x61, 0xAB, 0x67, 0x0A,
+    0x14, 0x23, 0x23, 0x92, 0x4C, 0x98, 0x1B, 0xCB, 0xBD, 0xF8, 0x01, 0x00, 0x63, 0x00, 0x93, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x30, 0xD5, 0xB7, 0x04, 0x82, 0xF2, 0x75, 0x92, 0x73, 0xC9, 0xDE, 0x67,
+    0xF0, 0xD2, 0x00, 0x80, 0x50, 0x38, 0xAE, 0x00, 0x80, 0x9F, 0xE8, 0x16, 0x03, 0x80, 0xAB, 0x26,
+    0xBB, 0x04, 0x80, 0xA3, 0x71, 0x46, 0x04, 0x80, 0xA2, 0xCB, 0x04, 0x02, 0x80, 0xF8, 0xF0, 0x74,
+    0x03, 0x80, 0x5F, 0x3B, 0x11, 0x03, 0x81, 0x15, 0xC6, 0x29, 0x00, 0x52, 0x01, 0x05, 0x80, 0x6E,
+    0xED, 0x33, 0x02, 0x80, 0x40, 0xBB, 0x5E, 0x05, 0x80, 0x9A, 0xF6, 0x41, 0x00, 0x80, 0xEE, 0x76,
+    0x8D, 0x03, 0x81, 0x8E, 0x57, 0xCC, 0x59, 0xA2, 0x69, 0x03, 0x81, 0xEB, 0xC3, 0x96, 0x49, 0x62,
+    0x5E, 0x07, 0x80, 0x04, 0x28, 0x76, 0x03, 0x81, 0x66, 0x47, 0x95, 0xFD, 0x12, 0x1B, 0x04, 0x80,
+    0x23, 0x33, 0x82, 0x03, 0x80, 0xDA, 0xF8, 0x5A, 0x0C, 0x80, 0x4E, 0x78, 0x7E, 0x01, 0x81, 0xB3,
+    0xBD, 0xEE, 0x85, 0x05, 0x40, 0x00, 0x80, 0x8E, 0x2C, 0x79, 0x00, 0x82, 0xD5, 0x70, 0x96, 0xDD,
+    0x1C, 0x8A, 0xD5, 0xCF, 0xA4, 0x01, 0x00, 0x18, 0x00, 0x97, 0x00, 0x00, 0x00, 0x03, 0x82, 0x3D,
+    0x0A, 0xA2, 0x96, 0xA1, 0x9E, 0xD8, 0x9E, 0x45, 0x02, 0x81, 0x19, 0x7B, 0x45, 0x01, 0xD0, 0xEE,
+    0x04, 0x81, 0x1E, 0x84, 0x26, 0xB3, 0x6C, 0xB9, 0x02, 0x80, 0x3E, 0x0E, 0xA9, 0x00, 0x80, 0xAA,
+    0xD6, 0x2E, 0x01, 0x80, 0x6A, 0x9D, 0xAD, 0x08, 0x81, 0xFE, 0x31, 0x02, 0x58, 0xC8, 0x43, 0x02,
+    0x80, 0x44, 0xE2, 0xD6, 0x00, 0x80, 0x75, 0x27, 0xA6, 0x01, 0x80, 0x15, 0x97, 0x9E, 0x01, 0x80,
+    0xD3, 0x85, 0x66, 0x03, 0x80, 0x1B, 0xC7, 0xE9, 0x01, 0x80, 0x28, 0x76, 0xFB, 0x00, 0x80, 0xC4,
+    0xFE, 0xAF, 0x01, 0x80, 0xCE, 0x7E, 0xB3, 0x00, 0x80, 0x1B, 0xDB, 0x9A, 0x01, 0x81, 0x4C, 0x02,
+    0xFC, 0xB0, 0x64, 0xB8, 0x05, 0x81, 0xF7, 0xB0, 0xD5, 0x93, 0x7C, 0xC5, 0x10, 0x84, 0x16, 0x0D,
+    0xDF, 0xFD, 0x16, 0xCE, 0x67, 0xC3, 0xB5, 0x46, 0x4A, 0x49, 0xAB, 0x24, 0x39, 0x00, 0x80, 0xF2,
+    0x2B, 0xE4, 0x04, 0x81, 0x42, 0x9F, 0xD4, 0xA7, 0x45, 0x50, 0x06, 0x80, 0x45, 0x0B, 0xF2, 0x05,
+    0x80, 0x8E, 0x16, 0x6D, 0x01, 0x00, 0x19, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x93, 0x48,
+    0x90, 0x15, 0x80, 0x61, 0x76, 0xB4, 0x03, 0x80, 0x3B, 0x21, 0x33, 0x28, 0x80, 0x0E, 0xB3, 0x73,
+    0x2B, 0x80, 0x9C, 0x92, 0xC9, 0x01, 0x00, 0x91, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0x80,
+    0x9D, 0x20, 0xCF, 0x01, 0x80, 0x0A, 0x65, 0xD0, 0x04, 0x80, 0x22, 0x61, 0xCB, 0x01, 0x00, 0x36,
+    0x00, 0x4B, 0x01, 0x00, 0x00, 0x8D, 0x14, 0xDF, 0xBB, 0x9B, 0x6E, 0x0D, 0x33, 0x8B, 0x39, 0xC9,
+    0x41, 0x11, 0xEE, 0xE0, 0x70, 0x67, 0x3D, 0x8A, 0x47, 0xAE, 0x54, 0x5D, 0xED, 0xAB, 0x52, 0x89,
+    0xFC, 0xC5, 0xF4, 0x72, 0x92, 0xCD, 0x4A, 0xA7, 0x86, 0xC5, 0xBB, 0xF8, 0x6E, 0xF7, 0xC7, 0x3D,
+    0x00, 0x83, 0xC9, 0xA8, 0xBE, 0xAF, 0xFD, 0xC1, 0xCE, 0xD7, 0xEE, 0x6C, 0x57, 0xC7, 0x01, 0x86,
+    0xDF, 0x9B, 0x15, 0xEA, 0x8D, 0xBE, 0x4E, 0xEA, 0x93, 0x68, 0xFE, 0x78, 0x9D, 0x75, 0x0C, 0x02,
+    0x40, 0x15, 0xA7, 0xFF, 0x45, 0x00, 0x80, 0xAB, 0xE8, 0x04, 0x00, 0x82, 0x7C, 0xCD, 0x54, 0x74,
+    0x25, 0x12, 0x0B, 0xCB, 0xAA, 0x00, 0x84, 0xAD, 0x61, 0x52, 0x3C, 0xCB, 0xC3, 0xCC, 0x58, 0x4C,
+    0x69, 0x0C, 0xDA, 0xC0, 0xCA, 0xBD, 0x00, 0x80, 0xFB, 0x55, 0xCD, 0x01, 0x81, 0xF7, 0x8D, 0xEB,
+    0xC8, 0x1F, 0x3E, 0x00, 0x81, 0xD5, 0x77, 0x63, 0xA5, 0xF2, 0x69, 0x01, 0x80, 0xBE, 0x2B, 0x9B,
+    0x00, 0x85, 0x84, 0x77, 0xC8, 0xDF, 0x82, 0x28, 0x4C, 0xB1, 0xBB, 0xC6, 0xC5, 0x12, 0x78, 0x3C,
+    0x11, 0x32, 0x1B, 0xEE, 0x01, 0x80, 0xB9, 0x6D, 0x4D, 0x00, 0x84, 0xE6, 0xE8, 0xC4, 0x33, 0x89,
+    0xC3, 0x44, 0xC4, 0x5F, 0xA4, 0xF0, 0x46, 0x1F, 0x7E, 0xC8, 0x01, 0x80, 0x92, 0x79, 0x6F, 0x00,
+    0x83, 0x3E, 0x2E, 0x94, 0x4B, 0x89, 0x0B, 0x28, 0xEE, 0x42, 0xC6, 0x25, 0xD5, 0x00, 0x80, 0x7A,
+    0x9A, 0x20, 0x00, 0x83, 0x37, 0xAF, 0x32, 0x34, 0x91, 0xDF, 0x10, 0xE1, 0xA5, 0x38, 0x0D, 0x84,
+    0x01, 0x81, 0xE0, 0x91, 0x7D, 0xF6, 0x49, 0x9E, 0x02, 0x87, 0xC3, 0xF6, 0xDE, 0xC2, 0x1E, 0x03,
+    0x5E, 0x8B, 0x20, 0x2E, 0x99, 0x6D, 0xC1, 0x8D, 0x8F, 0x9F, 0xAD, 0x15, 0x18, 0x3A, 0xB3, 0x7A,
+    0x00, 0x0A, 0x00, 0x81, 0x3E, 0x67, 0xAC, 0xC4, 0x46, 0x86, 0x00, 0x84, 0xAC, 0x48, 0x90, 0x2F,
+    0x93, 0x64, 0x2E, 0x39, 0x9D, 0x2D, 0x93, 0x1C, 0xB1, 0x67, 0xDE, 0x00, 0x84, 0xDD, 0x9F, 0x58,
+    0x3E, 0xD2, 0x06, 0x67, 0x5C, 0x5E, 0xFE, 0x1B, 0x72, 0x3F, 0x0C, 0x09, 0x00, 0x80, 0xBE, 0x8E,
+    0xBC, 0x00, 0x83, 0xC1, 0xA9, 0x98, 0x94, 0x8E, 0xAA, 0xAB, 0xE6, 0x23, 0x31, 0xFD, 0x42, 0x02,
+    0x84, 0x5C, 0x00, 0xE4, 0x2D, 0x00, 0x2E, 0x8A, 0xD1, 0xB1, 0xB5, 0x10, 0xAE, 0x24, 0x76, 0x72,
+    0x01, 0x00, 0x11, 0x00, 0x65, 0x01, 0x00, 0x00, 0x81, 0x7A, 0x67, 0xAB, 0x13, 0xF0, 0x97, 0x00,
+    0x80, 0x43, 0x14, 0x85, 0x00, 0x8D, 0x71, 0x76, 0x1E, 0xF0, 0x51, 0x5A, 0x20, 0xDA, 0x44, 0x88,
+    0xB1, 0x42, 0x3F, 0xD5, 0x51, 0x61, 0xB6, 0x06, 0x04, 0xA9, 0x4B, 0xB5, 0xA3, 0x0B, 0x43, 0x32,
+    0x8E, 0xC9, 0x8A, 0x33, 0xF1, 0xD8, 0xED, 0xF3, 0x54, 0x10, 0xDB, 0xDA, 0xDC, 0x7C, 0x00, 0x74,
+    0x01, 0x81, 0x97, 0x6C, 0x24, 0xBC, 0xDC, 0x97, 0x00, 0x86, 0xCA, 0x3B, 0x21, 0xA8, 0xEA, 0xDB,
+    0xBC, 0x06, 0x34, 0x71, 0x0A, 0xF8, 0x1D, 0xC6, 0x01, 0x42, 0xD2, 0x57, 0xBC, 0xD1, 0xFF, 0x00,
+    0x86, 0xDA, 0xA5, 0xE0, 0x8C, 0xF4, 0x7C, 0x7A, 0xFE, 0xD2, 0xE6, 0x60, 0x81, 0xBA, 0xDF, 0xA2,
+    0x73, 0x32, 0x7B, 0x2E, 0x5B, 0x7A, 0x00, 0x84, 0xD7, 0xB5, 0x79, 0xC0, 0xAF, 0x65, 0x70, 0x70,
+    0x04, 0x81, 0x71, 0xE0, 0x39, 0x58, 0xF8, 0x00, 0x87, 0xBF, 0xEC, 0x32, 0xB4, 0xAF, 0x0A, 0xA1,
+    0x51, 0x13, 0x64, 0xA6, 0x16, 0x81, 0xE6, 0xD3, 0x64, 0xD6, 0xDC, 0x28, 0xD3, 0x96, 0xEE, 0x94,
+    0xDC, 0x00, 0x83, 0xC6, 0x48, 0x99, 0x1D, 0x4F, 0x7D, 0xC9, 0x18, 0xD5, 0x8A, 0xB0, 0x72, 0x00,
+    0x80, 0x2B, 0x01, 0xE8, 0x01, 0x80, 0x58, 0x1D, 0xED, 0x00, 0x89, 0x4F, 0xEE, 0xF0, 0x0F, 0xA2,
+    0xDE, 0x0C, 0x7C, 0xCB, 0x8F, 0x76, 0x98, 0x14, 0xFB, 0xAF, 0x5D, 0xC8, 0xBD, 0xD5, 0x68, 0xAF,
+    0x30, 0x39, 0x4F, 0x01, 0x8F, 0xAB, 0x5F, 0x78, 0x13, 0x00, 0x80, 0x81, 0x7D, 0xBE, 0x00, 0x83,
+    0xE5, 0x75, 0x97, 0xD5, 0x03, 0xF3, 0xDC, 0xC2, 0x3A, 0xDF, 0x50, 0x58, 0x00, 0x83, 0xA2, 0x1A,
+    0xD9, 0xF6, 0xBD, 0xDE, 0xA3, 0xFF, 0x00, 0xC3, 0xF0, 0xB7, 0x00, 0x83, 0x06, 0x08, 0xB8, 0xB4,
+    0x21, 0x5B, 0xF0, 0xE0, 0x4A, 0x5D, 0x85, 0x95, 0x00, 0x88, 0x40, 0x86, 0x5A, 0x8A, 0x15, 0xDA,
+    0xF8, 0xBB, 0x63, 0x36, 0xA4, 0x10, 0xDF, 0x8C, 0x0C, 0x6D, 0x98, 0xC6, 0x95, 0xCD, 0x05, 0xCB,
+    0xBC, 0xCB, 0xEA, 0x04, 0x8E, 0x00, 0x80, 0x2E, 0x1C, 0x6B, 0x00, 0x84, 0xE6, 0xF7, 0x56, 0x96,
+    0x7E, 0x95, 0xA3, 0xDA, 0x67, 0x45, 0x30, 0x67, 0xE9, 0xEE, 0xBB, 0x00, 0x82, 0xA7, 0x9D, 0x79,
+    0x9E, 0xBB, 0x32, 0x51, 0x85, 0xB3, 0x00, 0x81, 0xBF, 0x07, 0x29, 0x1E, 0xBC, 0x3E, 0x00, 0x83,
+    0x0B, 0xFD, 0x5B, 0xDE, 0xE5, 0x43, 0x27, 0xF1, 0xBD, 0x23, 0xA5, 0xDE, 0x00, 0x84, 0x27, 0x43,
+    0xFE, 0x3D, 0x31, 0xED, 0xA8, 0x0B, 0x29, 0xB6, 0xB9, 0x3F, 0x63, 0xE3, 0x83, 0x01, 0x00, 0xB5,
+    0x00, 0x3A, 0x00, 0x00, 0x00, 0x04, 0x81, 0xA2, 0x3A, 0x02, 0x0E, 0xA5, 0xAF, 0x02, 0x80, 0xB3,
+    0x00, 0xC0, 0x03, 0x80, 0xA9, 0xDD, 0x33, 0x0F, 0x80, 0xB7, 0x37, 0x68, 0x0F, 0x80, 0xF0, 0xED,
+    0x48, 0x10, 0x80, 0x1B, 0xE6, 0x6E, 0x0F, 0x80, 0xE9, 0x1D, 0xB2, 0x05, 0x80, 0xF6, 0x3D, 0x09,
+    0x03, 0x80, 0x85, 0xA2, 0x2A, 0x11, 0x80, 0xB0, 0x00, 0x49, 0x08, 0x80, 0xC9, 0x9E, 0xAC, 0x01,
+    0x00, 0x1B, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x9D, 0x67, 0x85, 0x04, 0x80, 0x8A, 0x6F,
+    0xC1, 0x2F, 0x80, 0x60, 0x1C, 0x1C, 0x00, 0x80, 0xA3, 0xC7, 0x02, 0x0A, 0x80, 0xC2, 0xC6, 0x3A,
+    0x01, 0x00, 0x35, 0x00, 0x96, 0x00, 0x00, 0x00, 0x03, 0x80, 0xB7, 0xF5, 0xB6, 0x00, 0x80, 0x08,
+    0xEA, 0xF7, 0x03, 0x80, 0x18, 0x8F, 0xD3, 0x0C, 0x81, 0xD8, 0x0C, 0xF3, 0xE0, 0x65, 0xE7, 0x03,
+    0x80, 0x65, 0x16, 0x70, 0x02, 0x80, 0x65, 0x7F, 0xB7, 0x00, 0x80, 0x86, 0x96, 0xFC, 0x00, 0x80,
+    0x91, 0xE0, 0xD1, 0x05, 0x80, 0x9D, 0x04, 0x58, 0x01, 0x80, 0xEA, 0x4E, 0x49, 0x04, 0x80, 0x12,
+    0x23, 0x17, 0x01, 0x81, 0x1A, 0xB2, 0x18, 0x98, 0xFF, 0x19, 0x02, 0x81, 0xE3, 0xEC, 0xAE, 0x07,
+    0x6A, 0xC9, 0x06, 0x82, 0xF7, 0x00, 0x83, 0x94, 0x21, 0xA6, 0xA9, 0xDA, 0x82, 0x01, 0x81, 0x1E,
+    0x27, 0xB2, 0x01, 0xCB, 0xA0, 0x04, 0x80, 0xE5, 0xB4, 0x9F, 0x07, 0x80, 0xBF, 0x6A, 0xF3, 0x06,
+    0x80, 0xA9, 0x18, 0xE3, 0x00, 0x81, 0x13, 0x63, 0x46, 0x6C, 0x07, 0x53, 0x03, 0x82, 0x0D, 0xF7,
+    0x1E, 0xD2, 0x32, 0xE9, 0x34, 0xD3, 0xEF, 0x03, 0x80, 0x32, 0xA4, 0xBF, 0x01, 0x80, 0x9D, 0x25,
+    0x11, 0x01, 0x81, 0x48, 0xED, 0xEA, 0x98, 0xA4, 0x1A, 0x00, 0x80, 0x47, 0x83, 0x03, 0x01, 0x00,
+    0x17, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x80, 0x6F, 0x2A, 0xE4, 0x00, 0x80, 0x58, 0xF1, 0x73,
+    0x00, 0x80, 0x98, 0xC4, 0x3A, 0x02, 0x80, 0xD5, 0x16, 0xAB, 0x01, 0x80, 0x99, 0xD6, 0x11, 0x04,
+    0x80, 0xD1, 0x08, 0x74, 0x00, 0x80, 0x47, 0xAC, 0xF6, 0x06, 0x80, 0x94, 0xC1, 0xB2, 0x03, 0x82,
+    0x0A, 0x85, 0xD4, 0xF8, 0xF2, 0x4D, 0x54, 0x90, 0xF4, 0x01, 0x80, 0x57, 0xF8, 0x66, 0x05, 0x80,
+    0x64, 0xC5, 0xE2, 0x02, 0x81, 0xF7, 0x5B, 0xCD, 0xAA, 0x60, 0x68, 0x01, 0x80, 0xD4, 0x7A, 0x12,
+    0x00, 0x80, 0x1A, 0x51, 0x31, 0x02, 0x80, 0x9C, 0x4E, 0xD1, 0x00, 0x80, 0xB0, 0xF5, 0x4F, 0x09,
+    0x80, 0xBD, 0x6F, 0x06, 0x05, 0x80, 0xB0, 0x2F, 0x24, 0x00, 0x81, 0xA2, 0xC9, 0x74, 0x58, 0xFC,
+    0x63, 0x01, 0x81, 0x87, 0x6D, 0xC6, 0x6D, 0x3F, 0xC2, 0x02, 0x80, 0xFA, 0x1B, 0x56, 0x00, 0x80,
+    0x1A, 0xF4, 0xC7, 0x03, 0x80, 0x4C, 0xB4, 0xDB, 0x02, 0x80, 0xD8, 0xC2, 0x8B, 0x04, 0x81, 0xCD,
+    0x6B, 0xC4, 0xC8, 0x30, 0x5D, 0x0C, 0x80, 0xE5, 0x24, 0x3D, 0x00, 0x80, 0xB9, 0x6F, 0x85, 0x01,
+    0x00, 0x79, 0x00, 0x91, 0x00, 0x00, 0x00, 0x81, 0xA6, 0x27, 0x98, 0x37, 0xE4, 0x8A, 0x00, 0x80,
+    0x02, 0x93, 0x1F, 0x01, 0x80, 0x0C, 0xF0, 0xA9, 0x00, 0x80, 0x30, 0x31, 0x90, 0x08, 0x80, 0xB2,
+    0x92, 0x67, 0x02, 0x80, 0xC9, 0x88, 0x96, 0x08, 0x81, 0x33, 0xA5, 0xE6, 0x7B, 0x1E, 0x7B, 0x02,
+    0x80, 0xE0, 0xED, 0x33, 0x05, 0x80, 0x99, 0x7D, 0xBC, 0x08, 0x80, 0xC2, 0x7C, 0xC7, 0x01, 0x80,
+    0x7D, 0x61, 0x0F, 0x00, 0x80, 0x16, 0xB0, 0x78, 0x02, 0x80, 0x22, 0x80, 0x26, 0x00, 0x82, 0xC3,
+    0xD8, 0xBE, 0x4E, 0xF7, 0x49, 0xC9, 0xBE, 0x4E, 0x03, 0x81, 0x02, 0x63, 0xD8, 0x06, 0x55, 0xF6,
+    0x01, 0x81, 0xAA, 0xD3, 0x3D, 0xC1, 0x75, 0x93, 0x01, 0x80, 0x32, 0x1E, 0x19, 0x01, 0x80, 0x85,
+    0x11, 0x45, 0x0A, 0x80, 0xCF, 0x0E, 0xF5, 0x00, 0x80, 0xF7, 0x94, 0x98, 0x07, 0x80, 0xAF, 0xF1,
+    0x43, 0x00, 0x81, 0x27, 0x0E, 0x73, 0xB6, 0x47, 0x82, 0x00, 0x80, 0xB2, 0x7D, 0xCB, 0x00, 0x80,
+    0x87, 0x7A, 0x61, 0x01, 0x80, 0xC1, 0x9C, 0x2D, 0x00, 0x00, 0x64, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x7F, 0x44, 0xD9, 0xE5, 0x7F, 0x44, 0xD9, 0xE5, 0x01, 0x00, 0x24, 0x00, 0x3A, 0x00, 0x00, 0x00,
+    0x03, 0x80, 0xF7, 0x61, 0x6B, 0x07, 0x80, 0x14, 0x92, 0x41, 0x1D, 0x80, 0x09, 0xC2, 0xA1, 0x04,
+    0x80, 0x69, 0xAF, 0x1F, 0x0C, 0x80, 0xD6, 0x9C, 0x4E, 0x02, 0x80, 0x91, 0xC5, 0x4A, 0x0D, 0x81,
+    0x97, 0x3C, 0x5E, 0x7A, 0xED, 0xFC, 0x0C, 0x80, 0x1F, 0xF0, 0xFE, 0x00, 0x80, 0x3D, 0x3D, 0x6B,
+    0x0A, 0x80, 0xE9, 0x43, 0x30, 0x00, 0x80, 0x57, 0x66, 0x96, 0x01, 0x00, 0x9B, 0x00, 0x36, 0x00,
+    0x00, 0x00, 0x08, 0x80, 0x05, 0x0B, 0x12, 0x17, 0x80, 0xE4, 0xE4, 0x00, 0x0B, 0x80, 0xA5, 0xBD,
+    0x99, 0x04, 0x82, 0x21, 0x23, 0x35, 0x94, 0xBF, 0xCE, 0xA2, 0x9C, 0x0E, 0x0B, 0x80, 0x6C, 0x29,
+    0x63, 0x0C, 0x80, 0x3D, 0xDE, 0x43, 0x00, 0x80, 0x62, 0x61, 0xAF, 0x1B, 0x80, 0x40, 0xA1, 0x68,
+    0x01, 0x81, 0xE4, 0x76, 0xC1, 0xAE, 0x3E, 0x34, 0x01, 0x00, 0x07, 0x00, 0x3A, 0x00, 0x00, 0x00,
+    0x00, 0x81, 0x77, 0x11, 0x73, 0x39, 0x54, 0x3B, 0x04, 0x80, 0x62, 0xB7, 0x45, 0x09, 0x80, 0x2E,
+    0xFB, 0x16, 0x0C, 0x80, 0x92, 0x65, 0xD1, 0x23, 0x80, 0x51, 0xDD, 0xF4, 0x0F, 0x80, 0x44, 0x33,
+    0x46, 0x03, 0x80, 0x9D, 0xBB, 0x9A, 0x03, 0x80, 0x53, 0x24, 0x98, 0x04, 0x80, 0x1A, 0x4A, 0xF5,
+    0x09, 0x80, 0x42, 0x4F, 0xE8, 0x00, 0x80, 0xFB, 0x43, 0x4F, 0x00, 0x00, 0xA6, 0x00, 0x3A, 0x01,
+    0x00, 0x00, 0x8A, 0x18, 0x9D, 0x64, 0x77, 0x11, 0x73, 0x39, 0x54, 0x3B, 0x44, 0xD9, 0xE5, 0xF7,
+    0x61, 0x6B, 0x44, 0xD9, 0xE5, 0x15, 0x05, 0x86, 0x44, 0xD9, 0xE5, 0x62, 0xB7, 0x45, 0x05, 0x0B,
+    0x12, 0xF6, 0x88, 0xEF, 0x41, 0x44, 0xD9, 0xE5, 0x82, 0xF2, 0x26, 0x44, 0x44, 0xD9, 0xE5, 0x46,
+    0xB1, 0x64, 0x42, 0x44, 0xD9, 0xE5, 0x85, 0xD8, 0x9C, 0xE6, 0x44, 0xD9, 0xE5, 0xB8, 0x34, 0xDC,
+    0x44, 0xD9, 0xE5, 0xD6, 0x5C, 0x98, 0x38, 0x31, 0xD5, 0x42, 0x44, 0xD9, 0xE5, 0x80, 0x43, 0xFB,
+    0xFC, 0x43, 0x44, 0xD9, 0xE5, 0x81, 0x92, 0x65, 0xD1, 0xE4, 0xE4, 0x00, 0x44, 0x44, 0xD9, 0xE5,
+    0x87, 0x08, 0xEF, 0x74, 0xE1, 0xCB, 0x97, 0x75, 0x44, 0x95, 0x44, 0xD9, 0xE5, 0x0A, 0x83, 0x78,
+    0x44, 0xD9, 0xE5, 0x83, 0xCF, 0xD3, 0xA5, 0xBD, 0x99, 0x41, 0x44, 0xD9, 0xE5, 0x88, 0x69, 0xAF,
+    0x1F, 0xD1, 0x52, 0x89, 0x44, 0xD9, 0xE5, 0x21, 0x23, 0x35, 0x94, 0xBF, 0xCE, 0x5A, 0x7D, 0x9F,
+    0x44, 0xD9, 0xE5, 0xAE, 0xF5, 0xCA, 0x73, 0xA7, 0xEB, 0x41, 0x44, 0xD9, 0xE5, 0x80, 0x2B, 0x7E,
+    0x21, 0x41, 0x44, 0xD9, 0xE5, 0x80, 0xD6, 0x9C, 0x4E, 0x42, 0x44, 0xD9, 0xE5, 0x86, 0x6C, 0x29,
+    0x63, 0x44, 0xD9, 0xE5, 0x51, 0xDD, 0xF4, 0xF6, 0xE3, 0xF2, 0x8C, 0xAE, 0x95, 0x44, 0xD9, 0xE5,
+    0x4C, 0x96, 0xBA, 0x46, 0x44, 0xD9, 0xE5, 0x86, 0x3D, 0xDE, 0x43, 0x97, 0x3C, 0x5E, 0x3A, 0xA7,
+    0x71, 0x6F, 0xA1, 0x2F, 0x44, 0xD9, 0xE5, 0xEE, 0x45, 0xBE, 0xA2, 0x3C, 0x94, 0x41, 0x44, 0xD9,
+    0xE5, 0x89, 0xF3, 0xBD, 0xF3, 0xA7, 0x83, 0x07, 0x44, 0xD9, 0xE5, 0xE7, 0x95, 0x9A, 0x92, 0x62,
+    0x5E, 0x44, 0xD9, 0xE5, 0x53, 0x24, 0x98, 0x1F, 0xF0, 0xFE, 0x44, 0xD9, 0xE5, 0x3D, 0x3D, 0x6B,
+    0x41, 0x44, 0xD9, 0xE5, 0x80, 0x8E, 0xBB, 0x59, 0x42, 0x44, 0xD9, 0xE5, 0x80, 0xB5, 0xA1, 0x64,
+    0x41, 0x44, 0xD9, 0xE5, 0x87, 0x96, 0xA7, 0x35, 0x44, 0xD9, 0xE5, 0xE9, 0x43, 0x30, 0x40, 0xA1,
+    0x68, 0x42, 0x4F, 0xE8, 0x44, 0xD9, 0xE5, 0xFB, 0x43, 0x4F, 0xAE, 0x3E, 0x34, 0x45, 0x44, 0xD9,
+    0xE5, 0x81, 0x16, 0xB3, 0x4E, 0x64, 0xFC, 0x42, 0x41, 0x44, 0xD9, 0xE5, 0x01, 0x00, 0x57, 0x00,
+    0x4F, 0x01, 0x00, 0x00, 0x80, 0x30, 0x10, 0x11, 0x00, 0x80, 0x54, 0xB3, 0x3F, 0x00, 0x82, 0x58,
+    0x09, 0x56, 0xA1, 0x60, 0xAD, 0xE3, 0x97, 0x15, 0x01, 0x80, 0xBF, 0x55, 0x6E, 0x00, 0x80, 0x75,
+    0x35, 0x1F, 0x00, 0x81, 0x56, 0xFC, 0x40, 0xCD, 0x2B, 0xEB, 0x00, 0x82, 0x12, 0x80, 0xE0, 0xAF,
+    0x6F, 0x27, 0x1C, 0x2C, 0x19, 0x00, 0x81, 0x98, 0xCB, 0xD9, 0x56, 0xEB, 0xFE, 0x00, 0x84, 0xFD,
+    0xDC, 0x73, 0xE5, 0x48, 0xC3, 0x7B, 0x37, 0xBD, 0xBA, 0xFE, 0x2D, 0x70, 0xB6, 0x7C, 0x00, 0x81,
+    0x8C, 0xD4, 0x19, 0x81, 0x50, 0x26, 0x00, 0x81, 0x1F, 0x4D, 0x37, 0x67, 0xB1, 0xF9, 0x00, 0x85,
+    0x1D, 0x15, 0x6C, 0x07, 0x81, 0xA0, 0x0C, 0x6F, 0x8F, 0x64, 0xCB, 0x8C, 0x1A, 0xBE, 0x94, 0x7E,
+    0x38, 0x36, 0x00, 0x85, 0x6B, 0x57, 0xD7, 0xC0, 0x02, 0x43, 0x3D, 0x36, 0x22, 0x6E, 0xFC, 0xDF,
+    0xBC, 0xAA, 0x8E, 0x30, 0x81, 0xC4, 0x00, 0x82, 0x43, 0x5B, 0xFE, 0xDF, 0xA5, 0x01, 0x52, 0x0D,
+    0x03, 0x00, 0x80, 0x23, 0x5A, 0x61, 0x00, 0x87, 0xB8, 0x82, 0x3C, 0xCC, 0xB8, 0xB0, 0x0F, 0x3E,
+    0xA8, 0x90, 0x77, 0x3A, 0x77, 0xB4, 0xC0, 0x4A, 0x51, 0x69, 0x8B, 0x74, 0x1C, 0x93, 0x12, 0xA4,
+    0x02, 0x87, 0x61, 0xAF, 0xA4, 0x54, 0x6A, 0x39, 0xB0, 0x51, 0x26, 0x71, 0x31, 0x69, 0xD6, 0xF3,
+    0xD5, 0xA3, 0x74, 0xA2, 0x3E, 0xB2, 0xF6, 0xB1, 0x4E, 0x8F, 0x03, 0x87, 0xF7, 0x30, 0x25, 0xE0,
+    0x6C, 0xF0, 0xF8, 0x20, 0xA4, 0x78, 0x8C, 0x90, 0xB7, 0x77, 0xB9, 0x9F, 0xCC, 0x61, 0xAE, 0xC1,
+    0x86, 0xDA, 0x47, 0x31, 0x00, 0x8D, 0x79, 0x5D, 0xC6, 0xB1, 0x0A, 0x90, 0xF9, 0x6A, 0xA1, 0x8A,
+    0x98, 0xC0, 0x5E, 0x3C, 0x31, 0x89, 0x0D, 0xD6, 0xDD, 0x1F, 0x2C, 0xCC, 0x95, 0xA3, 0x15, 0x93,
+    0xD5, 0xD7, 0x3F, 0x89, 0x7E, 0x98, 0x05, 0xDD, 0xF4, 0x33, 0xA6, 0xF8, 0x1A, 0x88, 0x88, 0x37,
+    0x02, 0x90, 0xEB, 0x65, 0xB4, 0x04, 0x6F, 0xFC, 0x47, 0xFD, 0xB4, 0x1A, 0x77, 0x44, 0x3C, 0x19,
+    0x50, 0x18, 0x52, 0x6F, 0x6E, 0x8D, 0x4C, 0x45, 0x30, 0x08, 0x3C, 0xBC, 0xB8, 0xDB, 0xC2, 0xC7,
+    0xDF, 0xC1, 0x35, 0x1A, 0xCB, 0xBD, 0xD4, 0x0B, 0x80, 0xE3, 0x73, 0xA7, 0x47, 0xF6, 0xA8, 0x5F,
+    0xE9, 0x66, 0x60, 0xD3, 0x9C, 0x01, 0x83, 0x8E, 0xA7, 0x7C, 0x5E, 0x57, 0xB8, 0x66, 0x4B, 0xB4,
+    0xF1, 0x3A, 0x1C, 0x01, 0x00, 0x2A, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x3F, 0x13, 0x80, 0xA8, 0x8D,
+    0xA5, 0x25, 0x80, 0x4F, 0x48, 0x74, 0x01, 0x00, 0x5D, 0x00, 0x35, 0x00, 0x00, 0x00, 0x07, 0x80,
+    0x04, 0x13, 0x91, 0x09, 0x80, 0x92, 0x2F, 0xE9, 0x05, 0x80, 0x31, 0x80, 0xD7, 0x01, 0x80, 0xB8,
+    0xEB, 0x51, 0x07, 0x80, 0xA9, 0x45, 0x35, 0x1C, 0x80, 0x1D, 0xB7, 0x66, 0x12, 0x81, 0x16, 0xD4,
+    0x1E, 0x51, 0x49, 0x67, 0x05, 0x80, 0xC1, 0x29, 0x34, 0x0C, 0x80, 0xA0, 0x4E, 0xBF, 0x05, 0x80,
+    0xC1, 0xF5, 0x53, 0x01, 0x00, 0xC7, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x06, 0x82, 0xBD, 0x59, 0xFE,
+    0xD7, 0x55, 0x9D, 0x96, 0x09, 0xA8, 0x01, 0x82, 0x1E, 0x8A, 0x32, 0xD1, 0xD6, 0xDD, 0xCD, 0xB3,
+    0xF9, 0x05, 0x80, 0xD3, 0x96, 0x54, 0x00, 0x80, 0xCC, 0x88, 0xFA, 0x09, 0x80, 0x8B, 0x5B, 0x4C,
+    0x07, 0x80, 0xE2, 0x0F, 0x2F, 0x01, 0x80, 0xD1, 0xF1, 0x64, 0x03, 0x80, 0xB7, 0xB2, 0xE3, 0x01,
+    0x80, 0x03, 0xD4, 0x2D, 0x00, 0x81, 0x50, 0xB8, 0x49, 0x0C, 0x4F, 0xA0, 0x01, 0x80, 0xCB, 0x38,
+    0xFB, 0x04, 0x80, 0x7C, 0x5A, 0x81, 0x00, 0x80, 0x0F, 0x18, 0x95, 0x06, 0x80, 0x28, 0x7D, 0x17,
+    0x03, 0x81, 0xE5, 0xB4, 0x01, 0xDD, 0x34, 0x83, 0x01, 0x80, 0x46, 0x42, 0x0F, 0x00, 0x80, 0x47,
+    0x16, 0xDB, 0x02, 0x80, 0x00, 0x74, 0xC9, 0x00, 0x80, 0x46, 0x0C, 0xDE, 0x02, 0x80, 0x91, 0x8F,
+    0x6C, 0x00, 0x80, 0x6A, 0x3D, 0xE0, 0x03, 0x81, 0xBF, 0x5D, 0xBF, 0xFD, 0xB7, 0xD8, 0x00, 0x81,
+    0x49, 0x6C, 0xC9, 0xC0, 0x7A, 0xCE, 0x01, 0x80, 0xCD, 0x1A, 0x99, 0x00, 0x80, 0x44, 0x45, 0x35,
+    0x01, 0x80, 0x5B, 0xBF, 0xC4, 0x02, 0x80, 0xC9, 0x7E, 0xCD, 0x04, 0x80, 0x13, 0x51, 0xE3, 0x01,
+    0x00, 0x2C, 0x00, 0x97, 0x00, 0x00, 0x00, 0x80, 0x9A, 0xC0, 0xD1, 0x00, 0x80, 0x94, 0x2B, 0x04,
+    0x01, 0x80, 0xAA, 0x98, 0xA5, 0x02, 0x80, 0x36, 0x38, 0x5E, 0x02, 0x80, 0xE5, 0x49, 0xE4, 0x09,
+    0x80, 0x3D, 0x31, 0x1F, 0x02, 0x80, 0x09, 0x25, 0x4D, 0x05, 0x80, 0xFA, 0xE6, 0xBD, 0x03, 0x80,
+    0x44, 0xC3, 0xD0, 0x02, 0x80, 0x3E, 0x66, 0xEC, 0x07, 0x80, 0xA4, 0xC2, 0x41, 0x01, 0x80, 0x65,
+    0x7A, 0x80, 0x04, 0x80, 0x0F, 0x82, 0x3D, 0x00, 0x80, 0x6D, 0x85, 0x5F, 0x01, 0x80, 0x95, 0xC7,
+    0xEA, 0x00, 0x80, 0x72, 0x19, 0xCA, 0x02, 0x80, 0xB4, 0xCE, 0x05, 0x04, 0x80, 0xF5, 0xD7, 0x7A,
+    0x02, 0x81, 0x7A, 0xD0, 0x0C, 0x0C, 0xC5, 0xE9, 0x00, 0x80, 0x7D, 0x73, 0x98, 0x03, 0x80, 0x0D,
+    0x2B, 0x3B, 0x0B, 0x80, 0x6F, 0xD1, 0x09, 0x04, 0x80, 0xDA, 0x62, 0x3E, 0x01, 0x80, 0x3A, 0x89,
+    0x3A, 0x00, 0x80, 0xF9, 0x34, 0x84, 0x02, 0x80, 0x8D, 0x43, 0x41, 0x00, 0x82, 0xAA, 0x49, 0x3E,
+    0x12, 0x1E, 0x67, 0x4C, 0x57, 0x36, 0x00, 0x81, 0x89, 0xE0, 0x55, 0xBF, 0x5F, 0x8D, 0x01, 0x00,
+    0x8D, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0C, 0x80, 0xF7, 0x26, 0x4C, 0x00, 0x80, 0xEB, 0x5C, 0x64,
+    0x1A, 0x80, 0xBF, 0x6F, 0x5A, 0x3F, 0x00, 0x00, 0x33, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7F, 0xF4,
+    0xE3, 0x87, 0x7F, 0xF4, 0xE3, 0x87, 0x01, 0x00, 0x76, 0x00, 0x58, 0x01, 0x00, 0x00, 0x80, 0x90,
+    0x40, 0xCF, 0x00, 0x80, 0x3E, 0x79, 0xD6, 0x00, 0x87, 0x45, 0x97, 0xCC, 0x80, 0x08, 0x84, 0x3F,
+    0x28, 0x4F, 0xA1, 0xA3, 0x67, 0x6D, 0xEA, 0x36, 0x34, 0xDB, 0x45, 0x41, 0x12, 0xC7, 0xAF, 0xF5,
+    0x23, 0x00, 0x82, 0x84, 0xFD, 0xF5, 0x56, 0x8F, 0x85, 0xF6, 0xA1, 0xAD, 0x00, 0x81, 0xC0, 0x07,
+    0x9B, 0x3F, 0xEE, 0xAC, 0x00, 0x82, 0xA3, 0x78, 0x2D, 0xDE, 0xCC, 0xF4, 0xC8, 0xEC, 0xB2, 0x00,
+    0x82, 0x89, 0x4A, 0xCC, 0xE7, 0x92, 0xE3, 0x3C, 0xF5, 0x84, 0x00, 0x81, 0x38, 0x97, 0x48, 0xC8,
+    0xF1, 0xD9, 0x00, 0x84, 0xB0, 0x1B, 0x09, 0x33, 0x80, 0x96, 0x7C, 0xA3, 0x56, 0xC9, 0x8C, 0x20,
+    0x93, 0xFE, 0xE2, 0x00, 0x83, 0x27, 0x33, 0x89, 0x3C, 0xA6, 0xD1, 0x1F, 0xDD, 0xA5, 0xCA, 0x43,
+    0x3A, 0x03, 0x86, 0x30, 0xA7, 0x15, 0x3F, 0xF5, 0xC1, 0x93, 0x3E, 0x63, 0xB0, 0xEC, 0x78, 0x7D,
+    0x0D, 0x58, 0x3B, 0xC4, 0xD7, 0xAC, 0xC4, 0x48, 0x00, 0x87, 0x53, 0x14, 0x0B, 0x23, 0xC0, 0x96,
+    0xDD, 0x8A, 0xA1, 0x2F, 0x3C, 0xCC, 0xB2, 0x28, 0xCC, 0x28, 0x08, 0xE5, 0x55, 0xB3, 0x41, 0xA7,
+    0x79, 0xDC, 0x00, 0x80, 0x0C, 0x56, 0xA1, 0x01, 0x81, 0xCD, 0x43, 0x55, 0x55, 0xAD, 0x95, 0x01,
+    0x80, 0x42, 0x19, 0xF0, 0x00, 0x83, 0x22, 0xC8, 0x2D, 0x49, 0x1B, 0x92, 0x08, 0x9A, 0xCF, 0x11,
+    0xB5, 0x96, 0x00, 0x87, 0x46, 0x61, 0x3D, 0x6C, 0xDA, 0x0E, 0x33, 0x05, 0x1B, 0xAD, 0x63, 0x35,
+    0xE1, 0x9D, 0x94, 0xD5, 0x6F, 0x0E, 0xE9, 0xD4, 0x0E, 0xC6, 0xB7, 0xB9, 0x00, 0x80, 0x11, 0x48,
+    0x54, 0x00, 0x84, 0xDB, 0x8E, 0xFE, 0xD3, 0x0A, 0x6D, 0x5B, 0x83, 0x3A, 0x62, 0x3C, 0x99, 0xFE,
+    0x5F, 0x16, 0x00, 0x81, 0x7E, 0x33, 0xD0, 0xD7, 0xB1, 0x8C, 0x00, 0x89, 0x73, 0xAA, 0x6D, 0xE7,
+    0x64, 0x75, 0x89, 0x35, 0xD7, 0x81, 0x3C, 0x2E, 0xAD, 0x3A, 0x28, 0xD0, 0xD3, 0x1A, 0x44, 0x23,
+    0x7C, 0x52, 0xC3, 0xE8, 0x76, 0xBB, 0x89, 0x6C, 0x32, 0x2A, 0x00, 0x80, 0xC6, 0xCD, 0x1C, 0x00,
+    0x80, 0xB5, 0xDB, 0x23, 0x00, 0x81, 0xF6, 0x02, 0x64, 0xEE, 0x90, 0xF1, 0x00, 0x80, 0x7C, 0x02,
+    0x80, 0x00, 0x80, 0xC7, 0xAC, 0xF7, 0x00, 0x89, 0x8D, 0xAD, 0x84, 0x6B, 0x73, 0xE5, 0x2E, 0xCC,
+    0xFB, 0xF1, 0xCE, 0x5F, 0x9E, 0xAC, 0x27, 0x75, 0xED, 0x9D, 0x6E, 0x60, 0xB4, 0xCB, 0x8F, 0xA9,
+    0x4E, 0xDD, 0x52, 0x07, 0xFB, 0x9A, 0x01, 0x00, 0x7A, 0x00, 0x19, 0x00, 0x00, 0x00, 0x05, 0x80,
+    0x59, 0xEF, 0x1D, 0x30, 0x80, 0x9C, 0x97, 0xD4, 0x1A, 0x80, 0x35, 0xAD, 0xB4, 0x05, 0x80, 0x04,
+    0x6B, 0xD1, 0x10, 0x80, 0x72, 0x5E, 0xC9, 0x01, 0x00, 0xC5, 0x00, 0x91, 0x00, 0x00, 0x00, 0x03,
+    0x80, 0x03, 0xDD, 0x42, 0x04, 0x80, 0xE9, 0x8A, 0xEF, 0x01, 0x80, 0x65, 0xAF, 0x47, 0x02, 0x80,
+    0xBD, 0xAD, 0x14, 0x05, 0x80, 0xEE, 0x5A, 0x8D, 0x01, 0x80, 0x1A, 0x42, 0x1A, 0x02, 0x80, 0xAF,
+    0x7C, 0xEF, 0x0B, 0x80, 0x5C, 0x22, 0xE9, 0x02, 0x81, 0xFB, 0xBD, 0x18, 0x2B, 0xE9, 0x89, 0x03,
+    0x80, 0xC3, 0xD9, 0x40, 0x00, 0x82, 0x20, 0x9D, 0x96, 0x9A, 0x9D, 0x7C, 0xEF, 0x4A, 0x1D, 0x03,
+    0x82, 0x7B, 0x68, 0xEA, 0x7B, 0xF3, 0x0F, 0xBE, 0x2A, 0x77, 0x02, 0x82, 0xD6, 0x16, 0xAF, 0x19,
+    0x40, 0xEA, 0xBD, 0x7C, 0xD6, 0x04, 0x81, 0xE1, 0x09, 0x74, 0xB0, 0x41, 0xDF, 0x03, 0x80, 0xA1,
+    0x5A, 0xDF, 0x07, 0x80, 0x36, 0x40, 0x17, 0x04, 0x80, 0x3E, 0x02, 0x52, 0x00, 0x80, 0x57, 0x4B,
+    0x67, 0x05, 0x80, 0x0C, 0xCB, 0x25, 0x01, 0x80, 0xC0, 0x83, 0x2C, 0x06, 0x80, 0x81, 0xE7, 0x0D,
+    0x00, 0x82, 0xA0, 0xA0, 0x3A, 0xA1, 0xF7, 0x29, 0x23, 0x6D, 0x96, 0x00, 0x80, 0xB6, 0x8C, 0x8F,
+    0x01, 0x00, 0x60, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x80, 0x4A, 0xCC, 0x6B, 0x01, 0x82, 0x78,
+    0x26, 0x81, 0x71, 0x5D, 0xA1, 0x5F, 0xED, 0x8E, 0x09, 0x80, 0x8B, 0xC5, 0xD9, 0x00, 0x80, 0x04,
+    0x44, 0xCC, 0x03, 0x80, 0x4F, 0xA5, 0xDF, 0x06, 0x80, 0x54, 0x6B, 0xA7, 0x04, 0x80, 0xC2, 0x6F,
+    0x41, 0x00, 0x80, 0xD5, 0x25, 0xC3, 0x03, 0x81, 0x5B, 0x09, 0x89, 0x34, 0x75, 0x1E, 0x01, 0x80,
+    0x6E, 0x63, 0xAC, 0x08, 0x80, 0xEF, 0x1A, 0xF6, 0x01, 0x80, 0x47, 0xC0, 0xD5, 0x00, 0x80, 0x5E,
+    0x87, 0x1A, 0x03, 0x80, 0x32, 0x01, 0x4D, 0x02, 0x80, 0x6E, 0xC4, 0x8B, 0x02, 0x80, 0xDB, 0x08,
+    0x8C, 0x02, 0x81, 0x82, 0x58, 0x0E, 0x20, 0x9C, 0x4B, 0x01, 0x80, 0x2D, 0x91, 0x90, 0x04, 0x80,
+    0xA9, 0xDC, 0x11, 0x01, 0x83, 0x57, 0xAE, 0xA8, 0x05, 0x70, 0x5D, 0x96, 0xC1, 0x95, 0x74, 0x93,
+    0x07, 0x00, 0x80, 0x67, 0xE0, 0x82, 0x00, 0x80, 0x2C, 0xFF, 0xBA, 0x05, 0x80, 0xF4, 0x8C, 0xEC,
+    0x01, 0x80, 0x19, 0x93, 0x95, 0x00, 0x80, 0xF2, 0x8F, 0xF9, 0x01, 0x80, 0xCA, 0xEE, 0x9D, 0x09,
+    0x80, 0x84, 0x9A, 0x5A, 0x01, 0x00, 0x9D, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0A, 0x80, 0xB8, 0xA7,
+    0xE5, 0x0E, 0x80, 0xC7, 0xD5, 0x05, 0x10, 0x80, 0x2A, 0x08, 0x10, 0x24, 0x80, 0x61, 0x2D, 0x35,
+    0x1A, 0x80, 0x98, 0xE5, 0x24, 0x01, 0x00, 0x46, 0x00, 0x5F, 0x01, 0x00, 0x00, 0x87, 0xC1, 0x1A,
+    0xBB, 0x80, 0xAA, 0x15, 0xF8, 0xAC, 0x8B, 0xD6, 0x97, 0x9D, 0xEC, 0x2B, 0x67, 0x12, 0x81, 0x64,
+    0xDF, 0x7D, 0x93, 0xC5, 0x02, 0xDD, 0x00, 0x80, 0x37, 0xEF, 0x9D, 0x01, 0x80, 0xDB, 0xC0, 0x82,
+    0x00, 0x85, 0xB5, 0xE7, 0x66, 0x74, 0xE6, 0x8C, 0x4E, 0xFF, 0x83, 0x82, 0x6A, 0x05, 0x90, 0x48,
+    0x46, 0xA2, 0x0A, 0xF5, 0x02, 0x81, 0x8A, 0x50, 0x5A, 0x46, 0x6B, 0xB0, 0x00, 0x81, 0x3C, 0x9D,
+    0xFA, 0xD3, 0x97, 0x6E, 0x00, 0x8C, 0x2C, 0x2C, 0x30, 0xB7, 0x48, 0x46, 0x32, 0xAB, 0xCE, 0xB9,
+    0x33, 0xFE, 0x18, 0xD9, 0x6B, 0x4B, 0x92, 0x5B, 0x8F, 0x58, 0x3C, 0x39, 0x27, 0x98, 0xAA, 0x70,
+    0x72, 0x79, 0xBD, 0x8B, 0xB5, 0xF8, 0x75, 0x35, 0xB8, 0x3D, 0x40, 0x2F, 0x83, 0x00, 0x84, 0x76,
+    0x2E, 0x6E, 0xB3, 0xBC, 0xD9, 0x0E, 0xC1, 0xAF, 0x34, 0xFC, 0xF3, 0x56, 0x26, 0xB0, 0x00, 0x85,
+    0x84, 0x62, 0x5A, 0x40, 0xF9, 0x50, 0xC9, 0xE8, 0xD4, 0x58, 0xBF, 0xFD, 0x7C, 0xB5, 0x67, 0x62,
+    0x8E, 0x8D, 0x00, 0x87, 0xDB, 0xF5, 0x41, 0x71, 0xFD, 0x79, 0x20, 0x49, 0xBB, 0x72, 0xE9, 0xC9,
+    0xE9, 0xED, 0x38, 0x85, 0x8A, 0xD9, 0xC7, 0x23, 0x65, 0xB4, 0x4E, 0xDA, 0x00, 0x81, 0x34, 0x4E,
+    0xAC, 0xAD, 0x7F, 0xAE, 0x00, 0x8E, 0xB4, 0x9E, 0xE2, 0x61, 0xA7, 0x44, 0xC3, 0x37, 0x6B, 0x36,
+    0xD4, 0x04, 0x65, 0x26, 0x5C, 0xF6, 0x1B, 0xD8, 0xED, 0x34, 0x45, 0x22, 0xFC, 0x40, 0x04, 0x1D,
+    0xC7, 0x5C, 0x41, 0xE0, 0x40, 0x2D, 0x1B, 0xAA, 0x72, 0x95, 0x52, 0x38, 0x71, 0x71, 0xCB, 0xB0,
+    0x34, 0xE3, 0x7E, 0x00, 0x85, 0xE4, 0x25, 0x29, 0xC6, 0x3C, 0x58, 0x14, 0xF3, 0x05, 0x56, 0xA5,
+    0xCF, 0x48, 0xA9, 0x04, 0x9C, 0xDE, 0x73, 0x00, 0x82, 0xC1, 0xD8, 0xCD, 0x54, 0xCF, 0x25, 0xC1,
+    0x10, 0xB5, 0x01, 0x80, 0x7A, 0xFE, 0x31, 0x00, 0x80, 0x18, 0xE3, 0x64, 0x00, 0x86, 0x64, 0xC9,
+    0x18, 0x63, 0x2F, 0xA8, 0xDF, 0x96, 0x42, 0x73, 0x1D, 0x4A, 0xBE, 0x9D, 0xC7, 0x1A, 0x62, 0x39,
+    0xD4, 0x34, 0x05, 0x00, 0x83, 0x9B, 0xEC, 0xF2, 0x7E, 0xE8, 0xAC, 0x70, 0x1C, 0x65, 0x45, 0x77,
+    0xD5, 0x00, 0x80, 0x05, 0xFF, 0x4B, 0x00, 0x82, 0x3E, 0xEF, 0xD1, 0x68, 0x6A, 0xC5, 0x9D, 0xBC,
+    0x6A, 0x00, 0x80, 0x22, 0x60, 0xA7, 0x00, 0x83, 0x9F, 0x8F, 0x3A, 0x45, 0x0B, 0x31, 0xED, 0xDC,
+    0xE0, 0xCE, 0x22, 0xB7, 0x00, 0x81, 0x46, 0x95, 0xBC, 0x5D, 0xEC, 0xD3, 0x01, 0x00, 0xAA, 0x00,
+    0x0F, 0x00, 0x00, 0x00, 0x29, 0x80, 0x4A, 0x6D, 0x06, 0x1A, 0x80, 0xCE, 0x4A, 0xB5, 0x35, 0x80,
+    0x83, 0xAA, 0x99, 0x01, 0x00, 0x15, 0x00, 0x57, 0x01, 0x00, 0x00, 0x81, 0x99, 0x70, 0x64, 0x79,
+    0xDC, 0xE4, 0x00, 0x80, 0xEB, 0x73, 0x92, 0x00, 0x83, 0x18, 0xB0, 0x96, 0x6A, 0x48, 0x45, 0x72,
+    0xE0, 0x43, 0x1A, 0xDF, 0xA2, 0x00, 0x80, 0x90, 0x3B, 0x5A, 0x00, 0x81, 0xE6, 0x96, 0xD9, 0x82,
+    0x0C, 0xF4, 0x00, 0x82, 0xFC, 0xB9, 0xDB, 0x7B, 0x19, 0x16, 0x11, 0x22, 0xCA, 0x00, 0x8C, 0xF2,
+    0xCF, 0xD0, 0x2E, 0x93, 0x6B, 0xCD, 0x3E, 0x5C, 0x61, 0xBA, 0x90, 0x5F, 0x0C, 0xAF, 0xCE, 0xD3,
+    0xBA, 0x65, 0x17, 0xCD, 0x16, 0x4F, 0x61, 0x0B, 0x04, 0x90, 0x2B, 0xDF, 0x99, 0x70, 0xBF, 0x79,
+    0xAB, 0x13, 0xDF, 0xBA, 0x6A, 0x88, 0x00, 0x8C, 0x8C, 0x79, 0x58, 0xD7, 0x09, 0x15, 0x1C, 0xB6,
+    0xB8, 0xD0, 0x4B, 0xA8, 0x31, 0x16, 0x0A, 0x85, 0x6C, 0x5C, 0xDE, 0x82, 0xCD, 0x87, 0xF9, 0x9C,
+    0xE1, 0x3A, 0xCA, 0xA1, 0xBC, 0xB8, 0x06, 0x34, 0x85, 0x57, 0x6A, 0x6A, 0x71, 0x4C, 0x2C, 0x00,
+    0x83, 0xF4, 0x6F, 0x9A, 0x6A, 0xB1, 0x36, 0xDF, 0x30, 0x85, 0x0D, 0xBE, 0x97, 0x00, 0x81, 0xC5,
+    0x5F, 0x60, 0x7A, 0x92, 0x6A, 0x00, 0x81, 0xBE, 0xC3, 0xCB, 0x9E, 0xE8, 0x20, 0x00, 0x87, 0xF6,
+    0xDB, 0x77, 0xDC, 0x22, 0x32, 0xE0, 0x8F, 0x51, 0x7F, 0x93, 0x8B, 0x37, 0xC4, 0xE9, 0x9D, 0x2B,
+    0x98, 0x55, 0x05, 0x83, 0x0E, 0xAB, 0xF9, 0x00, 0x82, 0xCE, 0x79, 0xA2, 0x31, 0x4A, 0x11, 0x3A,
+    0x60, 0x2D, 0x00, 0x83, 0x4C, 0x01, 0x9F, 0x06, 0xBD, 0x01, 0x59, 0x4A, 0x1A, 0x13, 0x4F, 0xE6,
+    0x00, 0x82, 0xF0, 0xE2, 0x06, 0xE3, 0xBD, 0x7E, 0x32, 0xCB, 0x1A, 0x00, 0x8A, 0xBE, 0x91, 0x63,
+    0x49, 0xC7, 0x95, 0x83, 0xE1, 0xFD, 0x55, 0x66, 0x83, 0xEA, 0x95, 0xE1, 0x48, 0x84, 0x72, 0xB7,
+    0x2A, 0x3F, 0xE7, 0x14, 0x0F, 0xE4, 0x4F, 0x05, 0xF6, 0x12, 0x52, 0xAF, 0x77, 0xC6, 0x02, 0x81,
+    0x9C, 0x02, 0xC4, 0x20, 0xDF, 0x84, 0x00, 0x81, 0xB2, 0x87, 0x4B, 0x14, 0xFA, 0x03, 0x02, 0x83,
+    0xAC, 0xD9, 0x3C, 0x23, 0xDB, 0xD6, 0xED, 0x3D, 0xD5, 0xD7, 0xF0, 0x34, 0x01, 0x83, 0x42, 0x1A,
+    0x36, 0xE4, 0x4B, 0x48, 0xF3, 0xED, 0x30, 0xEC, 0x07, 0xFE, 0x00, 0x86, 0x15, 0x1E, 0x51, 0x8D,
+    0x20, 0x89, 0x09, 0x17, 0x95, 0x92, 0xD7, 0xEF, 0xAC, 0x72, 0x85, 0xFF, 0xF0, 0x56, 0x38, 0xB6,
+    0xA5, 0x00, 0x84, 0x4A, 0x9B, 0x0C, 0x09, 0xC0, 0x82, 0x28, 0x98, 0x78, 0x87, 0xD2, 0xCA, 0x10,
+    0xF1, 0x71, 0x00, 0x00, 0x20, 0x00, 0x82, 0x01, 0x00, 0x00, 0xBF, 0x99, 0x70, 0x64, 0x79, 0xDC,
+    0xE4, 0xED, 0x76, 0xEA, 0x84, 0x02, 0x05, 0x57, 0x56, 0xC9, 0x7C, 0x70, 0x2A, 0xAA, 0xC1, 0x06,
+    0x11, 0xDD, 0xFA, 0x2B, 0xDC, 0x6F, 0x37, 0xEF, 0x9D, 0x90, 0x3B, 0x5A, 0xC1, 0xAF, 0x75, 0x60,
+    0xD7, 0xA4, 0xF5, 0x4F, 0x0A, 0xE7, 0x84, 0x62, 0xE1, 0xAD, 0x79, 0x7B, 0x19, 0x16, 0x67, 0x2A,
+    0xCE, 0xE4, 0x5E, 0xAE, 0x1B, 0xC4, 0x08, 0x22, 0x68, 0x9C, 0xC2, 0x39, 0x7C, 0x8C, 0x26, 0x3F,
+    0x8B, 0x72, 0x77, 0xB4, 0xD0, 0x56, 0xF2, 0xD4, 0x5C, 0xA5, 0x6B, 0x9F, 0x0B, 0x04, 0x90, 0x4A,
+    0x6B, 0x55, 0x9F, 0xF2, 0x69, 0x2D, 0x83, 0x22, 0x2D, 0x58, 0xE7, 0x34, 0x03, 0xFE, 0x65, 0x08,
+    0xC5, 0xFF, 0x45, 0x79, 0x6E, 0x01, 0x4F, 0x22, 0xC7, 0xC4, 0xFE, 0x9D, 0xBF, 0x53, 0x4A, 0x00,
+    0xDE, 0x82, 0xCD, 0xBE, 0xC7, 0xC3, 0x2F, 0xAF, 0x94, 0xAE, 0xA4, 0xEC, 0xFB, 0xB5, 0x18, 0x40,
+    0xCE, 0xDC, 0x71, 0x4C, 0x2C, 0x69, 0xC2, 0x76, 0xF4, 0x6F, 0x9A, 0x6A, 0xB1, 0x36, 0xCC, 0x75,
+    0x5A, 0x32, 0xBA, 0x6B, 0x2D, 0x5A, 0xB4, 0xBD, 0x78, 0x10, 0x7A, 0x92, 0x6A, 0x2B, 0x92, 0x78,
+    0x55, 0x34, 0xF2, 0x1D, 0x5A, 0xB6, 0x26, 0x2D, 0x13, 0x3B, 0x78, 0xF8, 0xBA, 0x84, 0x35, 0x3D,
+    0x1F, 0x90, 0xAB, 0x39, 0xFB, 0x82, 0xDF, 0xCB, 0x4E, 0xE8, 0x27, 0xBF, 0x55, 0x05, 0x83, 0xA4,
+    0xDE, 0x4D, 0xBF, 0x3A, 0x9C, 0xA5, 0xA9, 0x1B, 0x10, 0x92, 0x9F, 0xDE, 0x72, 0x7C, 0x74, 0x95,
+    0xAC, 0x4C, 0x01, 0x9F, 0xEA, 0x8D, 0xA9, 0xC6, 0xD3, 0xD2, 0xF9, 0x12, 0xFF, 0x47, 0x81, 0xE2,
+    0x23, 0x9D, 0xD2, 0xB9, 0x84, 0xAA, 0x67, 0x5E, 0xA4, 0x03, 0x83, 0x58, 0x52, 0xB2, 0x38, 0x50,
+    0xBB, 0x4F, 0x28, 0xD5, 0x01, 0x90, 0x6A, 0x20, 0xF5, 0xD8, 0xF5, 0x48, 0x84, 0x72, 0xB7, 0x2A,
+    0x3F, 0xF2, 0x92, 0xDC, 0xF7, 0xE3, 0xAA, 0x5B, 0x12, 0xCF, 0x30, 0xE8, 0x40, 0xB4, 0xF9, 0x97,
+    0x57, 0x33, 0x46, 0x8A, 0xA2, 0xF8, 0x9C, 0x02, 0xC4, 0x83, 0x93, 0xC1, 0x7A, 0xB2, 0xB8, 0xB2,
+    0x87, 0x4B, 0x14, 0xFA, 0x03, 0x83, 0x5E, 0xEE, 0xD0, 0xF2, 0xE3, 0x0D, 0xDF, 0xFD, 0xCF, 0x78,
+    0x15, 0x23, 0xDB, 0xD6, 0xED, 0x3D, 0xD5, 0xB0, 0xC7, 0x48, 0x38, 0x61, 0xB3, 0x04, 0x90, 0x9D,
+    0xF1, 0xB8, 0x7B, 0xB7, 0xB2, 0xA4, 0x35, 0xA7, 0x5D, 0xEC, 0x07, 0xFE, 0x31, 0xF8, 0x59, 0x56,
+    0x7C, 0xC0, 0x8D, 0x20, 0x89, 0xF1, 0x81, 0x0C, 0x37, 0xB3, 0x4C, 0xE4, 0x4D, 0x5D, 0xFF, 0xF0,
+    0x56, 0x37, 0x90, 0x14, 0xA0, 0xA0, 0x3A, 0x81, 0xC3, 0x59, 0x16, 0x44, 0x5C, 0x8B, 0x8A, 0xC6,
+    0xE6, 0xEE, 0xAD, 0x5B, 0xB8, 0xD9, 0x4A, 0x3A, 0x61, 0x54, 0x9B, 0x5B, 0x01, 0x00, 0x45, 0x00,
+    0x65, 0x01, 0x00, 0x00, 0x00, 0x86, 0x90, 0xDA, 0x99, 0xC6, 0xA0, 0x5E, 0xC4, 0x90, 0x98, 0x02,
+    0x5B, 0xD7, 0x60, 0xF4, 0xB6, 0x6B, 0x22, 0x9B, 0xBF, 0x62, 0x3F, 0x00, 0x8B, 0x95, 0x6D, 0x61,
+    0x10, 0xFB, 0xE4, 0x84, 0xE7, 0x8A, 0x41, 0x1D, 0x9B, 0x85, 0x6B, 0x2D, 0x3A, 0x3A, 0xDE, 0xF9,
+    0xB3, 0xCE, 0x3D, 0x33, 0x1B, 0x7C, 0x4E, 0x29, 0x6F, 0xE6, 0xE2, 0x62, 0x23, 0x40, 0x3F, 0xA1,
+    0x91, 0x00, 0x80, 0x1C, 0x25, 0x33, 0x00, 0x87, 0x2B, 0x17, 0x80, 0xC9, 0xF5, 0x8D, 0xA8, 0x38,
+    0xCB, 0x13, 0xE9, 0x06, 0x27, 0xC0, 0x6A, 0xC3, 0x8F, 0xAA, 0xC7, 0x8D, 0x3B, 0x43, 0x9E, 0x63,
+    0x00, 0x83, 0x90, 0xC7, 0x74, 0xEE, 0xC5, 0xEB, 0xC3, 0xCE, 0xF3, 0x13, 0xD6, 0x4D, 0x00, 0x85,
+    0xB0, 0x3A, 0xEE, 0xBB, 0x44, 0x7C, 0x92, 0xFC, 0x64, 0x8C, 0x3D, 0x9D, 0x10, 0x71, 0x68, 0x15,
+    0x4B, 0xE7, 0x00, 0x80, 0xF0, 0x19, 0x21, 0x00, 0x83, 0x5E, 0x6D, 0xAA, 0xDE, 0x07, 0x46, 0x5C,
+    0x76, 0xC2, 0xB9, 0x76, 0x70, 0x00, 0x80, 0x0D, 0x97, 0xAC, 0x00, 0x8F, 0xE8, 0xBB, 0x5A, 0x5A,
+    0x58, 0x4E, 0xAF, 0xFA, 0xBB, 0x91, 0x63, 0xAB, 0xE3, 0x2E, 0x90, 0x12, 0xAF, 0xD5, 0x0D, 0x43,
+    0xAB, 0xD9, 0x33, 0x2A, 0x09, 0xC0, 0x81, 0xDF, 0xF4, 0xA8, 0xC0, 0x17, 0xC6, 0xE0, 0xCB, 0x87,
+    0xA6, 0x06, 0x97, 0xE8, 0xD1, 0x3F, 0xC4, 0x21, 0xA3, 0x22, 0x1F, 0x7C, 0x00, 0x80, 0x1B, 0x59,
+    0xAF, 0x00, 0x80, 0x01, 0xE5, 0x1E, 0x00, 0x80, 0x7D, 0x8F, 0x14, 0x00, 0x81, 0x4D, 0x95, 0x01,
+    0x6A, 0xBD, 0xDA, 0x00, 0x81, 0x3F, 0x68, 0xD2, 0xCE, 0x26, 0x7F, 0x00, 0x80, 0xD1, 0x06, 0x40,
+    0x00, 0x84, 0x53, 0x68, 0x72, 0x1E, 0x97, 0xBE, 0x07, 0x48, 0x40, 0x6F, 0xD5, 0xFF, 0x89, 0x28,
+    0x50, 0x00, 0x8C, 0x2D, 0x25, 0x0F, 0x8F, 0x4E, 0xC6, 0xE6, 0x9F, 0xF0, 0x8E, 0x9F, 0x8C, 0x50,
+    0xE2, 0xF3, 0x3B, 0x85, 0xB1, 0x21, 0x31, 0x88, 0xAF, 0xAA, 0x39, 0x5D, 0x57, 0x22, 0xAC, 0xAA,
+    0x14, 0x39, 0xB6, 0x2F, 0x44, 0x75, 0xE0, 0x4B, 0x25, 0x40, 0x00, 0x8C, 0x7F, 0x97, 0xE9, 0x61,
+    0xD2, 0x29, 0x0A, 0x01, 0xF0, 0xC8, 0x39, 0x5B, 0xA2, 0x52, 0x52, 0xA1, 0x4E, 0xFE, 0x9F, 0xCE,
+    0x6C, 0xCB, 0x33, 0xF7, 0x5B, 0x06, 0x52, 0xAD, 0x25, 0x74, 0x78, 0xF5, 0xA8, 0xFD, 0x56, 0xC8,
+    0x46, 0x6C, 0x1D, 0x00, 0x82, 0x1A, 0x7D, 0x06, 0x53, 0xF5, 0x41, 0xB9, 0xD9, 0x2F, 0x02, 0x82,
+    0xE0, 0x9A, 0x88, 0x7B, 0x15, 0xEC, 0xD4, 0x1A, 0x40, 0x00, 0x00, 0x3B, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x7F, 0xC4, 0xB7, 0x44, 0x7F, 0xC4, 0xB7, 0x44, 0x00, 0x00, 0x7D, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x7F, 0x38, 0x46, 0x76, 0x7F, 0x38, 0x46, 0x76, 0x01, 0x00, 0x53, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x1B, 0x80, 0xA7, 0x32, 0x41, 0x3F, 0x01, 0x00, 0x53, 0x00, 0x64, 0x01, 0x00, 0x00, 0x80,
+    0x51, 0x81, 0xBB, 0x00, 0x82, 0xF0, 0x49, 0x9C, 0x35, 0xED, 0xA1, 0x5B, 0x68, 0x2C, 0x00, 0x82,
+    0x11, 0xB5, 0xF8, 0xA1, 0x38, 0x8B, 0x2B, 0xDA, 0x38, 0x00, 0x8C, 0xA3, 0x01, 0x60, 0x12, 0x5B,
+    0xB1, 0x73, 0xDA, 0x3D, 0x71, 0x2D, 0xF4, 0xA1, 0x48, 0x48, 0xA1, 0xE1, 0xB4, 0x63, 0xE5, 0x12,
+    0x28, 0x06, 0xC2, 0xCD, 0xC3, 0x1C, 0x04, 0x74, 0x54, 0xC2, 0x05, 0xE5, 0x57, 0x1C, 0x65, 0xBD,
+    0x8F, 0x86, 0x00, 0x85, 0x5B, 0xCE, 0x76, 0xF2, 0x96, 0xEA, 0x7A, 0xAC, 0xF4, 0x0C, 0x40, 0x29,
+    0x1C, 0xD5, 0x83, 0x55, 0xEE, 0x6F, 0x00, 0x84, 0x1F, 0xDB, 0x93, 0xEC, 0x16, 0x2E, 0xCD, 0xC0,
+    0xBF, 0x29, 0xAA, 0x81, 0x36, 0x1B, 0x62, 0x00, 0x88, 0x84, 0xE4, 0x6A, 0x8E, 0x4E, 0xA0, 0x45,
+    0xBE, 0xC3, 0x00, 0x87, 0x36, 0x83, 0x7F, 0xCD, 0x0C, 0xEF, 0x19, 0x6E, 0xEA, 0xE4, 0xC2, 0x1C,
+    0x40, 0x54, 0x5D, 0x76, 0x01, 0x80, 0x24, 0x69, 0x4C, 0x00, 0x83, 0x2B, 0x11, 0xEC, 0x1B, 0x6C,
+    0x8C, 0x83, 0xBD, 0x17, 0x37, 0xD6, 0x68, 0x00, 0x82, 0x3D, 0x4E, 0x3E, 0xBE, 0x7B, 0x04, 0x1A,
+    0x11, 0xEA, 0x00, 0x81, 0xE0, 0xC8, 0x39, 0xD9, 0x76, 0x47, 0x00, 0x85, 0xC1, 0x0D, 0x6D, 0xBD,
+    0x00, 0xFA, 0x97, 0xBE, 0xD3, 0x75, 0x02, 0x0A, 0x4A, 0x07, 0x68, 0x67, 0xDB, 0x65, 0x01, 0x80,
+    0x73, 0x4C, 0x66, 0x01, 0x85, 0xDE, 0xC2, 0xE5, 0x0B, 0xEF, 0x0A, 0x9F, 0xD9, 0xD3, 0x42, 0xA5,
+    0x8B, 0x90, 0xA7, 0x16, 0xAF, 0x37, 0xA3, 0x00, 0x81, 0x00, 0x5D, 0x45, 0xCB, 0x8E, 0xC7, 0x00,
+    0x8B, 0x55, 0xDF, 0x0D, 0x45, 0x23, 0x06, 0xD4, 0xA6, 0xB5, 0xEC, 0xCC, 0x12, 0x48, 0xC0, 0x09,
+    0x30, 0x4F, 0x72, 0xFE, 0xC5, 0x6B, 0x9A, 0x9D, 0x0B, 0x27, 0xE8, 0xCF, 0xBE, 0xA5, 0x0D, 0xE5,
+    0xF8, 0xD4, 0x36, 0x21, 0xAF, 0x00, 0x89, 0x78, 0x93, 0x6D, 0xD8, 0x35, 0xCD, 0x3E, 0x94, 0x5B,
+    0xB7, 0x53, 0x5A, 0x28, 0xC5, 0xD5, 0xD9, 0xB4, 0xC2, 0x57, 0xA1, 0x76, 0xC7, 0x62, 0xDD, 0xE8,
+    0xCD, 0xFE, 0x0D, 0xB5, 0xFD, 0x00, 0x81, 0xEE, 0xF6, 0xE8, 0x75, 0x6B, 0x5C, 0x00, 0x84, 0xDD,
+    0xEE, 0x25, 0xA4, 0xDF, 0xD2, 0x0F, 0xF5, 0x67, 0x30, 0x67, 0x48, 0xCD, 0xD3, 0x6C, 0x00, 0x83,
+    0xAF, 0x97, 0x5E, 0x83, 0x01, 0x0E, 0x11, 0x02, 0x94, 0x8D, 0x44, 0xDE, 0x00, 0x86, 0x85, 0x3F,
+    0x00, 0xDD, 0x6E, 0xED, 0x8F, 0x52, 0xA6, 0x04, 0x3D, 0xB5, 0xD7, 0x6D, 0x06, 0x8F, 0xF2, 0x99,
+    0x9E, 0x53, 0xE0, 0x01, 0x00, 0x35, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3B, 0x80, 0xD2, 0x24, 0x58,
+    0x0B, 0x80, 0x4C, 0x61, 0xEA, 0x2F, 0x80, 0xE1, 0x9A, 0x8B, 0x01, 0x00, 0x99, 0x00, 0x56, 0x01,
+    0x00, 0x00, 0x8D, 0x8F, 0x83, 0x08, 0xC4, 0xB8, 0xBC, 0x64, 0xEF, 0xD3, 0xEF, 0xF2, 0x6D, 0x6B,
+    0x33, 0x56, 0xA5, 0xBA, 0x77, 0x5E, 0x20, 0xEB, 0xD6, 0x16, 0xEF, 0xA2, 0xB1, 0xF4, 0xC6, 0xFD,
+    0x70, 0xEE, 0xB1, 0xC3, 0x9E, 0x11, 0xD6, 0x48, 0xF5, 0x04, 0x43, 0x28, 0xF5, 0x02, 0x82, 0xDD,
+    0x06, 0xD3, 0x03, 0x89, 0x80, 0x06, 0x8A, 0x40, 0x00, 0x84, 0x8D, 0xBE, 0xD2, 0x3D, 0xE3, 0x8E,
+    0x12, 0x47, 0xFC, 0xF2, 0x62, 0x15, 0x80, 0xD7, 0xBA, 0x00, 0x83, 0xE2, 0xA3, 0x97, 0x32, 0x5B,
+    0xC7, 0x45, 0x92, 0x34, 0xF1, 0x35, 0xFE, 0x00, 0x80, 0x47, 0x99, 0xDD, 0x00, 0x80, 0xE7, 0x63,
+    0x77, 0x02, 0x84, 0xBA, 0x65, 0x3A, 0xBF, 0xC0, 0x81, 0x4A, 0x02, 0x86, 0xDE, 0x19, 0xC2, 0x34,
+    0x18, 0xE5, 0x00, 0x8A, 0x8E, 0x53, 0x89, 0x40, 0x75, 0xB4, 0x3D, 0x70, 0x3F, 0x1C, 0x10, 0x95,
+    0xD2, 0x66, 0xC0, 0xB7, 0x5C, 0x30, 0x1B, 0xB1, 0x44, 0x50, 0xEB, 0xA3, 0x68, 0xA0, 0x95, 0x5E,
+    0x87, 0x01, 0x58, 0xA1, 0xD0, 0x00, 0x80, 0x1E, 0x1B, 0xE9, 0x00, 0x82, 0xF8, 0x44, 0xA3, 0x46,
+    0x6B, 0x1D, 0xFB, 0x4A, 0x53, 0x00, 0x84, 0xB8, 0x8C, 0x13, 0x25, 0x6D, 0x55, 0x47, 0xBA, 0xEE,
+    0x47, 0x3C, 0x15, 0x94, 0x0B, 0xC3, 0x01, 0x85, 0x34, 0x0B, 0xCA, 0xAC, 0xF4, 0x26, 0x26, 0xC2,
+    0xAA, 0x99, 0x45, 0xC7, 0x1F, 0x13, 0x85, 0x1C, 0x1A, 0x21, 0x01, 0x82, 0xC4, 0x40, 0xA9, 0xC7,
+    0xBA, 0x33, 0xD0, 0x65, 0xCD, 0x00, 0x89, 0x70, 0xA8, 0xF4, 0xAD, 0xBA, 0xC0, 0x67, 0x77, 0xC1,
+    0xEB, 0x19, 0xE4, 0xEF, 0x00, 0x6D, 0xAE, 0x39, 0x15, 0xAE, 0x6E, 0x28, 0xAD, 0x2D, 0x01, 0x88,
+    0x4B, 0x28, 0x13, 0x08, 0xCD, 0x00, 0x86, 0x03, 0xD6, 0x71, 0x4B, 0xE1, 0x0E, 0x3B, 0xAB, 0x00,
+    0x7B, 0x88, 0x1F, 0x26, 0x24, 0x21, 0x0E, 0x20, 0x43, 0x59, 0xD4, 0xF7, 0x00, 0x80, 0x3B, 0xDE,
+    0xD6, 0x00, 0x86, 0xF4, 0x8C, 0xEE, 0x47, 0x2D, 0xD9, 0x9C, 0x22, 0x45, 0x2A, 0x6B, 0x34, 0x18,
+    0xBE, 0x4D, 0x5E, 0xC1, 0xE5, 0x7E, 0x45, 0xE3, 0x01, 0x85, 0x2B, 0x51, 0xF6, 0x45, 0xA1, 0x72,
+    0xA4, 0x91, 0x40, 0xB3, 0x65, 0xC7, 0x16, 0x4A, 0x08, 0xFB, 0x05, 0x1F, 0x00, 0x82, 0x4B, 0x0A,
+    0x02, 0x63, 0x99, 0xA4, 0xFA, 0x7B, 0x93, 0x00, 0x84, 0xF4, 0x68, 0xF0, 0x8C, 0x6C, 0x3E, 0x4D,
+    0x99, 0x58, 0x3F, 0x0A, 0x46, 0xC8, 0xA3, 0xB8, 0x01, 0x00, 0x1D, 0x00, 0x3B, 0x00, 0x00, 0x00,
+    0x80, 0xC3, 0xCC, 0x4D, 0x06, 0x80, 0xD0, 0x40, 0xA1, 0x07, 0x80, 0x02, 0x6E, 0xE6, 0x0E, 0x80,
+    0x43, 0x73, 0xC6, 0x03, 0x80, 0x29, 0xAD, 0xD2, 0x03, 0x80, 0x29, 0xB7, 0x6A, 0x07, 0x80, 0xCB,
+    0x17, 0xE2, 0x15, 0x80, 0x20, 0x61, 0x17, 0x1A, 0x80, 0x78, 0x15, 0x30, 0x00, 0x80, 0xA2, 0xA1,
+    0x03, 0x0C, 0x80, 0x2D, 0x4D, 0x44, 0x00, 0x80, 0xA1, 0xEA, 0x1B, 0x01, 0x00, 0xA3, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x9E, 0x76, 0x95, 0x0E, 0x80, 0x57, 0x6C, 0x4D, 0x3B, 0x80, 0x13,
+    0x49, 0x9A, 0x01, 0x00, 0x6E, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2E, 0x80, 0xE9, 0xA6, 0xF2, 0x3F,
+    0x00, 0x00, 0x24, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7F, 0x35, 0xA9, 0x4D, 0x7F, 0x35, 0xA9, 0x4D,
+    0x00, 0x00, 0x7C, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7F, 0x62, 0x20, 0x5A, 0x7F, 0x62, 0x20, 0x5A,
+    0x00, 0x00, 0x88, 0x00, 0x08, 0x00, 0x00, 0x00, 0x7F, 0x4E, 0xB7, 0x8C, 0x7F, 0x4E, 0xB7, 0x8C,
+    0x01, 0x00, 0xA1, 0x00, 0x5A, 0x01, 0x00, 0x00, 0x00, 0x81, 0x51, 0xCE, 0xD0, 0x40, 0x6A, 0xD5,
+    0x00, 0x80, 0x51, 0x3C, 0x63, 0x00, 0x80, 0x06, 0x8D, 0x3B, 0x00, 0x88, 0xB3, 0x4D, 0xD9, 0x14,
+    0xA5, 0xD8, 0x24, 0x5C, 0xCF, 0x51, 0xEE, 0x4E, 0x29, 0x39, 0x00, 0x95, 0x8C, 0xC9, 0x20, 0x81,
+    0x59, 0x2F, 0xCF, 0x04, 0xFD, 0x42, 0x29, 0x00, 0x81, 0x29, 0x91, 0x87, 0x6D, 0x10, 0xDB, 0x00,
+    0x81, 0xB1, 0x96, 0x71, 0x42, 0x85, 0xC5, 0x01, 0x81, 0x8F, 0xF0, 0xB5, 0xA5, 0xD9, 0x98, 0x00,
+    0x83, 0xB6, 0xB8, 0xD6, 0x28, 0x33, 0xEE, 0x27, 0x4E, 0x02, 0x04, 0x58, 0x3B, 0x03, 0x82, 0xFC,
+    0x9F, 0x75, 0xE1, 0xEA, 0xFE, 0xAE, 0xB6, 0xA8, 0x00, 0x91, 0x10, 0xFC, 0x50, 0xA0, 0x4A, 0xD0,
+    0x76, 0x1F, 0x86, 0xBD, 0x3A, 0x03, 0x43, 0x08, 0xC0, 0x64, 0x7B, 0xA1, 0x97, 0xB8, 0x91, 0xC8,
+    0x68, 0xE4, 0x70, 0x5B, 0x6F, 0xAB, 0x4E, 0xEF, 0x18, 0x27, 0xD2, 0xFB, 0x9B, 0x3B, 0xA2, 0x8E,
+    0x27, 0xA3, 0xAC, 0x93, 0x73, 0x64, 0x2F, 0x24, 0xF5, 0xAA, 0xAB, 0xB5, 0x5D, 0x7E, 0x46, 0xF5,
+    0x00, 0x8B, 0x20, 0x58, 0x9F, 0x65, 0x82, 0xBE, 0x0C, 0x91, 0xBE, 0xE5, 0x84, 0x64, 0xA7, 0xAD,
+    0x12, 0xB2, 0xC0, 0xFF, 0x1F, 0x2B, 0xEA, 0x83, 0xC7, 0x68, 0x92, 0xF0, 0x24, 0x49, 0x39, 0xC1,
+    0x72, 0xAB, 0x34, 0x16, 0x38, 0x64, 0x01, 0x83, 0xFC, 0x9A, 0xD6, 0x78, 0xE9, 0x2B, 0x6A, 0xBC,
+    0xC1, 0x11, 0x44, 0xC9, 0x01, 0x89, 0xF2, 0xD3, 0xA4, 0x31, 0x44, 0xA2, 0x34, 0xE1, 0x69, 0xD6,
+    0x5A, 0xE4, 0x73, 0x22, 0x80, 0xC6, 0x4D, 0x76, 0x2B, 0xDF, 0x5D, 0x51, 0xA0, 0xD6, 0xE5, 0x9E,
+    0xD3, 0x0E, 0x03, 0x7A, 0x00, 0x81, 0xB9, 0x7F, 0xD7, 0x03, 0x57, 0x5F, 0x00, 0x80, 0x99, 0xC2,
+    0x97, 0x00, 0x85, 0x4B, 0x4B, 0x52, 0x4C, 0xEE, 0x9A, 0x41, 0xED, 0x68, 0x4C, 0xB8, 0x2A, 0x40,
+    0xAF, 0x99, 0x78, 0xCB, 0x54, 0x00, 0x81, 0x03, 0x66, 0x7F, 0xED, 0x90, 0xD3, 0x00, 0x82, 0x80,
+    0x64, 0x8D, 0xAC, 0xE9, 0xBD, 0xAE, 0x66, 0xBB, 0x00, 0x8A, 0x5F, 0xA3, 0xBC, 0x94, 0x71, 0x3F,
+    0x87, 0x71, 0x68, 0x33, 0x53, 0xFE, 0x6A, 0x05, 0x12, 0x40, 0xCD, 0xDA, 0x95, 0x21, 0xF6, 0x41,
+    0x8A, 0x9E, 0xBA, 0xB0, 0xCD, 0x82, 0x5B, 0x2E, 0xD3, 0x42, 0x88, 0x00, 0x86, 0x12, 0x54, 0x75,
+    0x27, 0x27, 0x0B, 0xD8, 0xA3, 0x77, 0x3F, 0xC8, 0xCA, 0x7E, 0x9B, 0xAD, 0xCA, 0x6F, 0x06, 0x76,
+    0x3A, 0x94, 0x01, 0x00, 0xB6, 0x00, 0x10, 0x00, 0x00, 0x00, 0x22, 0x80, 0x11, 0x1F, 0x6C, 0x0A,
+    0x80, 0xC3, 0xAD, 0x2F, 0x05, 0x80, 0x7A, 0x7D, 0x9A, 0x3F,
+};
@@ -0,0 +1,81 @@
+"""Writes fixture.h: an animation encoded by anim_encoder.py, for the anim_codec host tests.
+
+The frames come from the same generator as fixture_frame() in test_main.c, so the tests
+can check every decoded frame without storing them. Run from the repository root:
+    python test/test_anim_codec/make_fixture.py
+"""
+import os
+import sys
+import types
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), "..", ".."))
+try:
+    import PIL  # noqa: F401
+except ImportError:
+    # encode() does not need it, only loading images does
+    sys.modules["PIL"] = types.ModuleType("PIL")
+    sys.modules["PIL"].Image = sys.modules["PIL"].ImageSequence = None
+import anim_encoder  # noqa: E402
+
+WIDTH = 16
+HEIGHT = 8
+FRAMES = 64
+KEYFRAME_INTERVAL = 16
+
+
+class Lcg:
+    """The C library's example rand(), so test_main.c can produce the same numbers."""
+
+    def __init__(self, seed):
+        self.state = seed
+
+    def next(self, n):
+        self.state = (self.state * 1103515245 + 12345) & 0x7FFFFFFF
+        return (self.state >> 16) % n
+
+
+def frames():
+    rng = Lcg(1)
+    pixels = [(0, 0, 0)] * (WIDTH * HEIGHT)
+    result = []
+    for _ in range(FRAMES):
+        pixels = list(pixels)
+        kind = rng.next(8)
+        if kind == 0:
+            # A plain background, for FILL runs
+            color = (rng.next(256), rng.next(256), rng.next(256))
+            pixels = [color] * (WIDTH * HEIGHT)
+        else:
+            # A few, some or a lot of pixels change, for SKIP and COPY
+            for _ in range((0, 1, 5, 40, 200, 200, 3, 12)[kind]):
+                index = rng.next(WIDTH * HEIGHT)
+                pixels[index] = (rng.next(256), rng.next(256), rng.next(256))
+        result.append((pixels, rng.next(200)))
+    return result
+
+
+def main():
+    data = anim_encoder.encode(frames(), WIDTH, HEIGHT, KEYFRAME_INTERVAL)
+    lines = [
+        "// Generated by make_fixture.py from anim_encoder.py, do not edit",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        f"#define FIXTURE_WIDTH {WIDTH}",
+        f"#define FIXTURE_HEIGHT {HEIGHT}",
+        f"#define FIXTURE_FRAMES {FRAMES}",
+        "",
+        f"static const uint8_t fixture[{len(data)}] = {{",
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join(f"0x{b:02X}," for b in data[i:i + 16]))
+    lines.append("};")
+    path = os.path.join(os.path.dirname(__file__), "fixture.h")
+    with open(path, "w") as output_file:
+        output_file.write("\n".join(lines) + "\n")
+    print(f"{FRAMES} frames, {len(data)} bytes")
+
+
+if __name__ == "__main__":
+    main()
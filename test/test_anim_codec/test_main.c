@@ -0,0 +1,319 @@
+// Host tests for the LMA1 animation decoder. Run with: pio test -e native
+#include <unity.h>
+
+#include "utils/anim_codec.c"
+
+#include "fixture.h"
+
+#include "esp_timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FIXTURE_PIXELS (FIXTURE_WIDTH * FIXTURE_HEIGHT)
+
+// The pixels and durations make_fixture.py encoded, from the same generator
+static uint32_t fixture_pixels[FIXTURE_FRAMES][FIXTURE_PIXELS];
+static uint32_t fixture_durations[FIXTURE_FRAMES];
+
+static uint32_t lcg_state;
+
+static uint32_t lcg_next(uint32_t n)
+{
+    lcg_state = (lcg_state * 1103515245u + 12345u) & 0x7FFFFFFF;
+    return (lcg_state >> 16) % n;
+}
+
+static uint32_t lcg_color(void)
+{
+    uint32_t r = lcg_next(256);
+    uint32_t g = lcg_next(256);
+    uint32_t b = lcg_next(256);
+    return (r << 16) | (g << 8) | b;
+}
+
+// Mirror of frames() in make_fixture.py
+static void fixture_generate(void)
+{
+    static const uint32_t changes[8] = { 0, 1, 5, 40, 200, 200, 3, 12 };
+    uint32_t pixels[FIXTURE_PIXELS] = { 0 };
+    lcg_state = 1;
+    for (uint32_t f = 0; f < FIXTURE_FRAMES; f++) {
+        uint32_t kind = lcg_next(8);
+        if (kind == 0) {
+            uint32_t color = lcg_color();
+            for (uint32_t i = 0; i < FIXTURE_PIXELS; i++) {
+                pixels[i] = color;
+            }
+        } else {
+            for (uint32_t n = 0; n < changes[kind]; n++) {
+                uint32_t index = lcg_next(FIXTURE_PIXELS);
+                pixels[index] = lcg_color();
+            }
+        }
+        memcpy(fixture_pixels[f], pixels, sizeof(pixels));
+        fixture_durations[f] = lcg_next(200);
+    }
+}
+
+// A copy of data in a buffer of exactly size bytes, so reads past its end are caught
+static uint8_t* copy_exact(const uint8_t* data, size_t size)
+{
+    uint8_t* copy = malloc(size ? size : 1);
+    memcpy(copy, data, size);
+    return copy;
+}
+
+// Play every frame, as anim_player does: decode into a canvas from two frames back,
+// with the last one shown as previous. Returns the first result that is not ANIM_OK
+static anim_codec_result_E play(anim_codec_t* anim, uint32_t* decoded)
+{
+    static uint32_t canvases[3][FIXTURE_PIXELS];
+    const uint32_t* shown = NULL;
+    uint32_t draw = 0;
+    anim_codec_result_E result;
+    *decoded = 0;
+    while ((result = anim_codec_decodeFrame(anim, canvases[draw], shown, NULL)) == ANIM_OK) {
+        shown = canvases[draw];
+        draw = (draw + 1) % 3;
+        (*decoded)++;
+    }
+    return result;
+}
+
+void setUp(void)
+{
+    srand(1);
+}
+
+void tearDown(void)
+{
+}
+
+static void test_header_is_checked(void)
+{
+    anim_codec_header_t header;
+    TEST_ASSERT_EQUAL(ANIM_OK, anim_codec_readHeader(fixture, sizeof(fixture), &header));
+    TEST_ASSERT_EQUAL_UINT16(FIXTURE_WIDTH, header.width);
+    TEST_ASSERT_EQUAL_UINT16(FIXTURE_HEIGHT, header.height);
+    TEST_ASSERT_EQUAL_UINT16(FIXTURE_FRAMES, header.frame_count);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(fixture), header.size);
+
+    for (size_t len = 0; len < ANIM_HEADER_SIZE; len++) {
+        uint8_t* data = copy_exact(fixture, len);
+        TEST_ASSERT_EQUAL(ANIM_ERR_TRUNCATED, anim_codec_readHeader(data, len, &header));
+        free(data);
+    }
+
+    // An erased partition
+    uint8_t erased[64];
+    memset(erased, 0xFF, sizeof(erased));
+    TEST_ASSERT_EQUAL(ANIM_ERR_MAGIC, anim_codec_readHeader(erased, sizeof(erased), &header));
+
+    // Zero width, height, frames, or a size smaller than the header
+    const size_t fields[] = { 4, 6, 8, 12 };
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+        uint8_t data[ANIM_HEADER_SIZE];
+        memcpy(data, fixture, sizeof(data));
+        memset(&data[fields[i]], 0, (fields[i] == 12) ? 4 : 2);
+        TEST_ASSERT_EQUAL(ANIM_ERR_CORRUPT, anim_codec_readHeader(data, sizeof(data), &header));
+    }
+}
+
+// Every frame anim_encoder.py made decodes back to what it was given, over several
+// loops and whichever canvas it lands on
+static void test_fixture_round_trips(void)
+{
+    static uint32_t canvases[3][FIXTURE_PIXELS];
+    uint32_t in_place[FIXTURE_PIXELS];
+    memset(canvases, 0xAB, sizeof(canvases)); // Whatever the buffers held before
+    memset(in_place, 0xAB, sizeof(in_place));
+
+    anim_codec_t anim;
+    anim_codec_t again;
+    TEST_ASSERT_EQUAL(ANIM_OK, anim_codec_open(&anim, fixture, sizeof(fixture)));
+    TEST_ASSERT_EQUAL(ANIM_OK, anim_codec_open(&again, fixture, sizeof(fixture)));
+    const uint32_t* shown = NULL;
+    uint32_t draw = 0;
+    uint32_t keyframes = 0;
+    for (int loop = 0; loop < 3; loop++) {
+        for (uint32_t f = 0; f < FIXTURE_FRAMES; f++) {
+            keyframes += (loop == 0 && fixture[anim.next] == ANIM_FRAME_KEY);
+            uint32_t duration = 0xFFFFFFFF;
+            TEST_ASSERT_EQUAL(ANIM_OK, anim_codec_decodeFrame(&anim, canvases[draw], shown, &duration));
+            TEST_ASSERT_EQUAL_HEX32_ARRAY(fixture_pixels[f], canvases[draw], FIXTURE_PIXELS);
+            TEST_ASSERT_EQUAL_UINT32(fixture_durations[f], duration);
+            shown = canvases[draw];
+            draw = (draw + 1 + rand() % 2) % 3; // Sometimes two back, sometimes one
+            draw = (canvases[draw] == shown) ? (draw + 1) % 3 : draw;
+
+            // Without previous, into the buffer that holds the last frame
+            TEST_ASSERT_EQUAL(ANIM_OK, anim_codec_decodeFrame(&again, in_place, NULL, NULL));
+            TEST_ASSERT_EQUAL_HEX32_ARRAY(fixture_pixels[f], in_place, FIXTURE_PIXELS);
+        }
+        TEST_ASSERT_EQUAL(ANIM_END, anim_codec_decodeFrame(&anim, canvases[draw], shown, NULL));
+        TEST_ASSERT_EQUAL(ANIM_END, anim_codec_decodeFrame(&again, in_place, NULL, NULL));
+        anim_codec_rewind(&anim);
+        anim_codec_rewind(&again);
+    }
+
+    char message[128];
+    snprintf(message, sizeof(message), "%d frames, %u keyframes: %u bytes, %.1f%% of raw RGB",
+             FIXTURE_FRAMES, (unsigned)keyframes, (unsigned)sizeof(fixture),
+             100.0 * sizeof(fixture) / (FIXTURE_FRAMES * FIXTURE_PIXELS * ANIM_BYTES_PER_PIXEL));
+    TEST_MESSAGE(message);
+}
+
+// Cut short anywhere, by the flash size or by the header's own size field, the frames
+// before the cut still decode and the one it runs into is rejected
+static void test_every_truncation_is_caught(void)
+{
+    uint32_t ends[FIXTURE_FRAMES];
+    for (uint32_t f = 0, at = ANIM_HEADER_SIZE; f < FIXTURE_FRAMES; f++) {
+        at += ANIM_FRAME_HEADER_SIZE + anim_codec_read32(&fixture[at + 4]);
+        ends[f] = at;
+    }
+    TEST_ASSERT_EQUAL_UINT32(sizeof(fixture), ends[FIXTURE_FRAMES - 1]);
+
+    for (size_t cut = 0; cut < sizeof(fixture); cut++) {
+        uint8_t* data = copy_exact(fixture, cut);
+        anim_codec_t anim;
+        TEST_ASSERT_EQUAL(ANIM_ERR_TRUNCATED, anim_codec_open(&anim, data, cut));
+        free(data);
+
+        if (cut < ANIM_HEADER_SIZE + ANIM_FRAME_HEADER_SIZE) {
+            continue;
+        }
+        data = copy_exact(fixture, cut);
+        data[12] = cut;
+        data[13] = cut >> 8;
+        data[14] = cut >> 16;
+        data[15] = cut >> 24;
+        TEST_ASSERT_EQUAL(ANIM_OK, anim_codec_open(&anim, data, cut));
+        uint32_t decoded;
+        TEST_ASSERT_EQUAL(ANIM_ERR_TRUNCATED, play(&anim, &decoded));
+        uint32_t whole = 0;
+        while (ends[whole] <= cut) {
+            whole++;
+        }
+        TEST_ASSERT_EQUAL_UINT32(whole, decoded);
+        free(data);
+    }
+}
+
+// Hand-built frames the encoder never makes
+static void test_corrupt_ops_are_rejected(void)
+{
+    const struct
+    {
+        uint8_t type;
+        uint8_t ops[8];
+        uint32_t length;
+        anim_codec_result_E result;
+    } cases[] = {
+        { ANIM_FRAME_KEY, { 0x41, 1, 2, 3 }, 4, ANIM_ERR_CORRUPT },          // Keyframe leaving pixels unset
+        { ANIM_FRAME_KEY, { 0x00 }, 1, ANIM_ERR_CORRUPT },                   // Keyframe with a SKIP
+        { ANIM_FRAME_KEY, { 0xC0 }, 1, ANIM_ERR_CORRUPT },                   // No such op
+        { 2, { 0x41, 1, 2, 3 }, 4, ANIM_ERR_CORRUPT },                       // No such frame type
+        { ANIM_FRAME_KEY, { 0x7F, 1, 2 }, 3, ANIM_ERR_TRUNCATED },           // FILL without its colour
+        { ANIM_FRAME_KEY, { 0x81, 1, 2, 3, 4, 5 }, 6, ANIM_ERR_TRUNCATED },  // COPY short of its pixels
+        { ANIM_FRAME_KEY, { 0x7F, 1, 2, 3, 0x7F, 1, 2, 3 }, 8, ANIM_ERR_CORRUPT }, // Past the last pixel
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        // A 8x8 container of one frame: 64 pixels, one full FILL
+        size_t size = ANIM_HEADER_SIZE + ANIM_FRAME_HEADER_SIZE + cases[i].length;
+        uint8_t* data = calloc(1, size);
+        memcpy(data, ANIM_MAGIC, 4);
+        data[4] = 8;
+        data[6] = 8;
+        data[8] = 1;
+        data[12] = size;
+        data[ANIM_HEADER_SIZE] = cases[i].type;
+        data[ANIM_HEADER_SIZE + 4] = cases[i].length;
+        memcpy(&data[ANIM_HEADER_SIZE + ANIM_FRAME_HEADER_SIZE], cases[i].ops, cases[i].length);
+
+        anim_codec_t anim;
+        uint32_t pixels[64];
+        anim_codec_result_E result = anim_codec_open(&anim, data, size);
+        if (result == ANIM_OK) {
+            result = anim_codec_decodeFrame(&anim, pixels, NULL, NULL);
+        }
+        TEST_ASSERT_EQUAL_MESSAGE(cases[i].result, result, "case");
+        free(data);
+    }
+
+    // Playback loops to the first frame, so it cannot be a delta
+    uint8_t* data = copy_exact(fixture, sizeof(fixture));
+    anim_codec_t anim;
+    data[ANIM_HEADER_SIZE] = ANIM_FRAME_DELTA;
+    TEST_ASSERT_EQUAL(ANIM_ERR_CORRUPT, anim_codec_open(&anim, data, sizeof(fixture)));
+    free(data);
+}
+
+// Random bit flips past the header: decoding either fails or writes only the frame's pixels
+static void test_bit_flips_stay_in_bounds(void)
+{
+    uint32_t results[ANIM_ERR_CORRUPT + 1] = { 0 };
+    uint32_t frames = 0;
+    for (int i = 0; i < 20000; i++) {
+        uint8_t* data = copy_exact(fixture, sizeof(fixture));
+        int flips = 1 + rand() % 4;
+        for (int f = 0; f < flips; f++) {
+            uint32_t at = ANIM_HEADER_SIZE + rand() % (sizeof(fixture) - ANIM_HEADER_SIZE);
+            data[at] ^= 1 << (rand() % 8);
+        }
+        anim_codec_t anim;
+        anim_codec_result_E result = anim_codec_open(&anim, data, sizeof(fixture));
+        if (result == ANIM_OK) {
+            uint32_t decoded;
+            result = play(&anim, &decoded);
+            frames += decoded;
+        }
+        results[result]++;
+        free(data);
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, results[ANIM_END]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, results[ANIM_ERR_TRUNCATED]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, results[ANIM_ERR_CORRUPT]);
+
+    char message[160];
+    snprintf(message, sizeof(message), "20000 damaged copies: %lu played through, %lu truncated, %lu corrupt, "
+             "%lu frames decoded", (unsigned long)results[ANIM_END], (unsigned long)results[ANIM_ERR_TRUNCATED],
+             (unsigned long)results[ANIM_ERR_CORRUPT], (unsigned long)frames);
+    TEST_MESSAGE(message);
+}
+
+static void test_benchmark_decode(void)
+{
+    anim_codec_t anim;
+    TEST_ASSERT_EQUAL(ANIM_OK, anim_codec_open(&anim, fixture, sizeof(fixture)));
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int loop = 0; loop < 200; loop++) {
+            uint32_t decoded;
+            anim_codec_rewind(&anim);
+            TEST_ASSERT_EQUAL(ANIM_END, play(&anim, &decoded));
+        }
+        double us = (esp_timer_get_time() - start) / (200.0 * FIXTURE_FRAMES);
+        best = (us < best) ? us : best;
+    }
+
+    char message[128];
+    snprintf(message, sizeof(message), "%dx%d frame decoded in %.3f us, %.2f ns/pixel",
+             FIXTURE_WIDTH, FIXTURE_HEIGHT, best, best * 1000.0 / FIXTURE_PIXELS);
+    TEST_MESSAGE(message);
+}
+
+int main(void)
+{
+    fixture_generate();
+    UNITY_BEGIN();
+    RUN_TEST(test_header_is_checked);
+    RUN_TEST(test_fixture_round_trips);
+    RUN_TEST(test_every_truncation_is_caught);
+    RUN_TEST(test_corrupt_ops_are_rejected);
+    RUN_TEST(test_bit_flips_stay_in_bounds);
+    RUN_TEST(test_benchmark_decode);
+    return UNITY_END();
+}
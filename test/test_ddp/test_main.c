@@ -0,0 +1,357 @@
+// Host tests for the DDP parser and frame assembly. Run with: pio test -e native
+#include <unity.h>
+
+#include "utils/ddp.c"
+
+#include "esp_timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_PIXELS 512 // A 16x32 panel
+#define FRAME_BYTES (TEST_PIXELS * DDP_BYTES_PER_PIXEL)
+
+// Canvases the frame is assembled into, traded the way a double-buffered display buffer does
+static uint32_t canvases[3][TEST_PIXELS];
+static uint32_t draw;
+static ddp_frame_t frame;
+
+void setUp(void)
+{
+    srand(1);
+    memset(canvases, 0, sizeof(canvases));
+    draw = 0;
+    ddp_frame_init(&frame, canvases[0], TEST_PIXELS);
+}
+
+void tearDown(void)
+{
+}
+
+// Build a packet in a buffer of exactly its size, so reads past its end are caught
+static uint8_t* build_packet(uint8_t flags, uint8_t sequence, uint8_t type, uint8_t id,
+                             uint32_t offset, const uint8_t* data, uint16_t length, size_t* size)
+{
+    size_t header = DDP_HEADER_SIZE + ((flags & DDP_FLAG_TIMECODE) ? DDP_TIMECODE_SIZE : 0);
+    *size = header + length;
+    uint8_t* packet = malloc(*size);
+    packet[0] = flags;
+    packet[1] = sequence;
+    packet[2] = type;
+    packet[3] = id;
+    packet[4] = offset >> 24;
+    packet[5] = offset >> 16;
+    packet[6] = offset >> 8;
+    packet[7] = offset;
+    packet[8] = length >> 8;
+    packet[9] = length;
+    memset(packet + DDP_HEADER_SIZE, 0xEE, header - DDP_HEADER_SIZE);
+    memcpy(packet + header, data, length);
+    return packet;
+}
+
+// Parse and apply one pixel packet. A completed frame is handed over like udp_stream
+// does: the canvas becomes previous and assembly moves on to the next one
+static ddp_frame_E send(bool push, uint8_t sequence, uint32_t offset, const uint8_t* data, uint16_t length)
+{
+    size_t size;
+    uint8_t* packet = build_packet(DDP_FLAG_VERSION_1 | (push ? DDP_FLAG_PUSH : 0), sequence,
+                                   DDP_TYPE_RGB24, DDP_ID_DISPLAY, offset, data, length, &size);
+    ddp_packet_t parsed;
+    TEST_ASSERT_EQUAL(DDP_OK, ddp_parse(packet, size, &parsed));
+    ddp_frame_E result = ddp_frame_apply(&frame, &parsed);
+    free(packet);
+    if (result == DDP_FRAME_COMPLETE) {
+        frame.previous = frame.pixels;
+        draw = (draw + 1) % 3;
+        frame.pixels = canvases[draw];
+    }
+    return result;
+}
+
+static void assert_shown(const uint8_t* expected)
+{
+    TEST_ASSERT_NOT_NULL(frame.previous);
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        const uint8_t* rgb = &expected[i * DDP_BYTES_PER_PIXEL];
+        TEST_ASSERT_EQUAL_HEX32(((uint32_t)rgb[0] << 16) | (rgb[1] << 8) | rgb[2], frame.previous[i]);
+    }
+}
+
+static void test_parse_reads_header(void)
+{
+    uint8_t data[6] = { 1, 2, 3, 4, 5, 6 };
+    for (int timecode = 0; timecode < 2; timecode++) {
+        size_t size;
+        uint8_t flags = DDP_FLAG_VERSION_1 | DDP_FLAG_PUSH | (timecode ? DDP_FLAG_TIMECODE : 0);
+        uint8_t* packet = build_packet(flags, 0xA7, DDP_TYPE_RGB24, DDP_ID_DISPLAY, 0x01020304, data, 6, &size);
+        ddp_packet_t parsed;
+        TEST_ASSERT_EQUAL(DDP_OK, ddp_parse(packet, size, &parsed));
+        TEST_ASSERT_EQUAL_HEX8(flags, parsed.flags);
+        TEST_ASSERT_EQUAL_UINT8(7, parsed.sequence);
+        TEST_ASSERT_EQUAL_HEX8(DDP_TYPE_RGB24, parsed.type);
+        TEST_ASSERT_EQUAL_UINT8(DDP_ID_DISPLAY, parsed.id);
+        TEST_ASSERT_EQUAL_HEX32(0x01020304, parsed.offset);
+        TEST_ASSERT_EQUAL_UINT16(6, parsed.length);
+        TEST_ASSERT_EQUAL_PTR(packet + size - 6, parsed.data);
+        free(packet);
+    }
+}
+
+static void test_parse_rejects_what_it_cannot_show(void)
+{
+    uint8_t data[3] = { 0 };
+    size_t size;
+    ddp_packet_t parsed;
+    uint8_t* packet = build_packet(DDP_FLAG_VERSION_1, 1, DDP_TYPE_UNDEFINED, DDP_ID_DISPLAY, 0, data, 3, &size);
+    TEST_ASSERT_EQUAL(DDP_OK, ddp_parse(packet, size, &parsed));
+    for (size_t len = 0; len < size; len++) {
+        TEST_ASSERT_EQUAL(DDP_ERR_SHORT, ddp_parse(packet, len, &parsed));
+    }
+    free(packet);
+
+    // The timecode is part of the header
+    packet = build_packet(DDP_FLAG_VERSION_1 | DDP_FLAG_TIMECODE, 1, DDP_TYPE_RGB24, DDP_ID_DISPLAY, 0, data, 3, &size);
+    TEST_ASSERT_EQUAL(DDP_ERR_SHORT, ddp_parse(packet, size - 1, &parsed));
+    free(packet);
+
+    const struct
+    {
+        uint8_t flags;
+        uint8_t type;
+        uint8_t id;
+        ddp_result_E result;
+    } cases[] = {
+        { 0x00, DDP_TYPE_RGB24, DDP_ID_DISPLAY, DDP_ERR_VERSION },
+        { 0x80, DDP_TYPE_RGB24, DDP_ID_DISPLAY, DDP_ERR_VERSION },
+        { 0xC0, DDP_TYPE_RGB24, DDP_ID_DISPLAY, DDP_ERR_VERSION },
+        { DDP_FLAG_VERSION_1 | DDP_FLAG_QUERY, DDP_TYPE_RGB24, DDP_ID_DISPLAY, DDP_ERR_UNSUPPORTED },
+        { DDP_FLAG_VERSION_1 | DDP_FLAG_REPLY, DDP_TYPE_RGB24, DDP_ID_DISPLAY, DDP_ERR_UNSUPPORTED },
+        { DDP_FLAG_VERSION_1, DDP_TYPE_RGB24, 2, DDP_ERR_UNSUPPORTED },
+        { DDP_FLAG_VERSION_1, 0x1B, DDP_ID_DISPLAY, DDP_ERR_UNSUPPORTED },
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        packet = build_packet(cases[i].flags, 1, cases[i].type, cases[i].id, 0, data, 3, &size);
+        TEST_ASSERT_EQUAL(cases[i].result, ddp_parse(packet, size, &parsed));
+        free(packet);
+    }
+}
+
+// Random bytes of random lengths: accepted payloads always lie within the packet
+static void test_parse_stays_in_bounds(void)
+{
+    uint32_t accepted = 0;
+    for (int i = 0; i < 200000; i++) {
+        size_t len = rand() % 40;
+        uint8_t* packet = malloc(len ? len : 1);
+        for (size_t b = 0; b < len; b++) {
+            packet[b] = rand();
+        }
+        if (len > 0) {
+            packet[0] = (packet[0] & ~DDP_FLAG_VERSION_MASK) | DDP_FLAG_VERSION_1;
+        }
+        if (len >= DDP_HEADER_SIZE && rand() % 2) {
+            packet[2] = DDP_TYPE_RGB24;
+            packet[3] = DDP_ID_DISPLAY;
+            packet[8] = 0;
+            packet[9] = rand() % 32;
+        }
+        ddp_packet_t parsed;
+        if (ddp_parse(packet, len, &parsed) == DDP_OK) {
+            TEST_ASSERT_TRUE(parsed.data + parsed.length <= packet + len);
+            accepted++;
+        }
+        free(packet);
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, accepted);
+}
+
+static void test_payload_is_clipped_to_the_frame(void)
+{
+    static uint8_t data[FRAME_BYTES + 30];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = i * 7;
+    }
+    TEST_ASSERT_EQUAL(DDP_FRAME_PARTIAL, send(false, 1, FRAME_BYTES - 4, data, 20));
+    TEST_ASSERT_EQUAL(DDP_FRAME_PARTIAL, send(false, 1, 0xFFFFFFF0, data, 20));
+    TEST_ASSERT_EQUAL(DDP_FRAME_COMPLETE, send(true, 1, 0, data, sizeof(data)));
+    assert_shown(data);
+}
+
+// Stragglers of a shown frame, and older frames up to 7 behind, are dropped untouched
+static void test_late_packets_are_dropped(void)
+{
+    static uint8_t first[FRAME_BYTES];
+    static uint8_t other[FRAME_BYTES];
+    memset(first, 0x11, sizeof(first));
+    memset(other, 0x22, sizeof(other));
+    TEST_ASSERT_EQUAL(DDP_FRAME_COMPLETE, send(true, 5, 0, first, FRAME_BYTES));
+
+    TEST_ASSERT_EQUAL(DDP_FRAME_LATE, send(false, 5, 0, other, 300));
+    TEST_ASSERT_EQUAL(DDP_FRAME_LATE, send(true, 4, 0, other, 300));
+    TEST_ASSERT_EQUAL(DDP_FRAME_LATE, send(true, 13, 0, other, 300)); // 7 behind across the wrap
+    TEST_ASSERT_EQUAL_UINT32(3, frame.late);
+    assert_shown(first);
+
+    // 8 behind is taken as a newer frame
+    TEST_ASSERT_EQUAL(DDP_FRAME_COMPLETE, send(true, 12, 0, other, 300));
+    memcpy(other + 300, first + 300, FRAME_BYTES - 300);
+    assert_shown(other);
+}
+
+// Bytes a frame does not send are the ones last shown, however its packets are cut,
+// ordered or lost, and frames abandoned without a push never show
+static void test_random_streams_match_model(void)
+{
+    static uint8_t shown[FRAME_BYTES];
+    static uint8_t expected[FRAME_BYTES];
+    static uint8_t next[FRAME_BYTES];
+    struct
+    {
+        uint32_t offset;
+        uint32_t length;
+    } chunks[FRAME_BYTES];
+    uint8_t sequence = 1;
+    bool carried = false; // An abandoned sequenced frame that the next unsequenced one continues
+    uint32_t frames = 0;
+    uint32_t sent = 0;
+    // Until a frame has been shown there is nothing to keep bytes from, start from a whole one
+    for (uint32_t i = 0; i < FRAME_BYTES; i++) {
+        shown[i] = rand();
+    }
+    TEST_ASSERT_EQUAL(DDP_FRAME_COMPLETE, send(true, 0, 0, shown, FRAME_BYTES));
+
+    for (int it = 0; it < 20000; it++) {
+        for (uint32_t i = 0; i < FRAME_BYTES; i++) {
+            next[i] = rand();
+        }
+        int mode = rand() % 4; // Whole in order, with gaps, shuffled, or one range
+        bool sequenced = rand() % 8 != 0;
+        bool dropPush = rand() % 20 == 0;
+        if (!(carried && !sequenced)) {
+            memcpy(expected, shown, sizeof(expected));
+        }
+
+        uint32_t count = 0;
+        if (mode == 3) {
+            uint32_t offset = rand() % FRAME_BYTES;
+            uint32_t length = 1 + rand() % (FRAME_BYTES - offset);
+            chunks[count].offset = offset;
+            chunks[count++].length = MIN(length, 1400);
+        } else {
+            for (uint32_t offset = 0; offset < FRAME_BYTES; ) {
+                uint32_t length = 1 + rand() % 700;
+                length = MIN(length, FRAME_BYTES - offset);
+                if (!(mode == 1 && rand() % 3 == 0)) {
+                    chunks[count].offset = offset;
+                    chunks[count++].length = length;
+                }
+                offset += length;
+            }
+        }
+        if (count == 0) {
+            // Every range was a gap: a bare push, showing the last frame again
+            chunks[count].offset = 0;
+            chunks[count++].length = 0;
+        }
+        if (mode == 2) {
+            for (uint32_t i = count - 1; i > 0; i--) {
+                uint32_t j = rand() % (i + 1);
+                __typeof__(chunks[0]) swap = chunks[i];
+                chunks[i] = chunks[j];
+                chunks[j] = swap;
+            }
+        }
+
+        for (uint32_t i = 0; i < count; i++) {
+            bool push = (i == count - 1) && !dropPush;
+            uint32_t offset = chunks[i].offset;
+            memcpy(expected + offset, next + offset, chunks[i].length);
+            sent += chunks[i].length;
+            ddp_frame_E result = send(push, sequenced ? sequence : 0, offset, next + offset, chunks[i].length);
+            TEST_ASSERT_EQUAL(push ? DDP_FRAME_COMPLETE : DDP_FRAME_PARTIAL, result);
+        }
+        if (!dropPush) {
+            assert_shown(expected);
+            memcpy(shown, expected, sizeof(shown));
+            frames++;
+            if (sequenced && rand() % 10 == 0) {
+                // A straggler of the frame just shown changes nothing
+                TEST_ASSERT_EQUAL(DDP_FRAME_LATE, send(false, sequence, 0, next, 30));
+            }
+        }
+        carried = dropPush && sequenced;
+        if (dropPush && !sequenced) {
+            ddp_frame_reset(&frame); // Quiet sender, as udp_stream does after a timeout
+        }
+        if (sequenced) {
+            sequence = sequence % 15 + 1;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(frames + 1, frame.frames);
+    char message[128];
+    snprintf(message, sizeof(message), "%lu frames: %lu bytes sent, %lu bytes kept from the frame before",
+             (unsigned long)frames, (unsigned long)sent, (unsigned long)frame.kept);
+    TEST_MESSAGE(message);
+}
+
+// Microseconds to assemble a whole frame sent in two packets
+static double time_frame(bool copy)
+{
+    static uint8_t data[FRAME_BYTES];
+    for (uint32_t i = 0; i < FRAME_BYTES; i++) {
+        data[i] = rand();
+    }
+    size_t size[2];
+    uint8_t* packets[2];
+    packets[0] = build_packet(DDP_FLAG_VERSION_1, 0, DDP_TYPE_RGB24, DDP_ID_DISPLAY, 0, data, 1440, &size[0]);
+    packets[1] = build_packet(DDP_FLAG_VERSION_1 | DDP_FLAG_PUSH, 0, DDP_TYPE_RGB24, DDP_ID_DISPLAY, 1440,
+                              data + 1440, FRAME_BYTES - 1440, &size[1]);
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 2000; i++) {
+            if (copy) {
+                // What display_manager_present did for every frame: start from a copy of the last one
+                memcpy(canvases[(draw + 1) % 3], frame.pixels, sizeof(canvases[0]));
+            }
+            for (int p = 0; p < 2; p++) {
+                ddp_packet_t parsed;
+                ddp_parse(packets[p], size[p], &parsed);
+                if (ddp_frame_apply(&frame, &parsed) == DDP_FRAME_COMPLETE) {
+                    frame.previous = copy ? NULL : frame.pixels;
+                    draw = (draw + 1) % 3;
+                    frame.pixels = canvases[draw];
+                }
+            }
+        }
+        double us = (esp_timer_get_time() - start) / 2000.0;
+        best = (us < best) ? us : best;
+    }
+    free(packets[0]);
+    free(packets[1]);
+    return best;
+}
+
+static void test_benchmark_frames(void)
+{
+    double copied = time_frame(true);
+    double kept = time_frame(false);
+    char message[128];
+    snprintf(message, sizeof(message), "%d-pixel frame in two packets: canvas copied first %.2f us, no copy %.2f us",
+             TEST_PIXELS, copied, kept);
+    TEST_MESSAGE(message);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_parse_reads_header);
+    RUN_TEST(test_parse_rejects_what_it_cannot_show);
+    RUN_TEST(test_parse_stays_in_bounds);
+    RUN_TEST(test_payload_is_clipped_to_the_frame);
+    RUN_TEST(test_late_packets_are_dropped);
+    RUN_TEST(test_random_streams_match_model);
+    RUN_TEST(test_benchmark_frames);
+    return UNITY_END();
+}
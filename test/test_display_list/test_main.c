@@ -0,0 +1,600 @@
+// Host tests for retained display lists: every replay must leave the buffer as a full
+// clear and redraw of the same commands would. Run with: pio test -e native
+#include <unity.h>
+
+#include "display_manager.c"
+#undef TAG
+#include "utils/display_list.c"
+#undef TAG
+#include "utils/graphics.c"
+#undef TAG
+#include "utils/fonts.c"
+#include "5x3.c"
+
+#include "display_host.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Odd sizes, so INDEXED4 rows end on half a byte
+#define TEST_WIDTH 23
+#define TEST_HEIGHT 13
+#define NUM_FORMATS 4
+#define NUM_VARIANTS (NUM_FORMATS + 1) // And RGB888 with per-pixel alpha
+
+static const uint32_t palette[] = {
+    0xFF0000, 0x00FF00, 0x0000FF, 0xFFFFFF, 0x102030, 0x808000,
+    0x008080, 0x800080, 0x123456, 0xFEDCBA, 0x0F0F0F, 0xF0F0F0,
+};
+
+#define PALETTE_SIZE (sizeof(palette) / sizeof(palette[0]))
+
+void setUp(void)
+{
+    srand(1);
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+}
+
+void tearDown(void)
+{
+    host_display_stop();
+}
+
+// Variants 0-3 are the formats, 4 is RGB888 with per-pixel alpha. Indexed buffers get
+// the same palette, so the colours drawn are always in it
+static displayManager_buffer_t* make_buffer(const char* name, uint32_t width, uint32_t height, int variant)
+{
+    displayManager_format_E format = (variant < NUM_FORMATS) ? variant : DISPLAY_FORMAT_RGB888;
+    displayManager_buffer_t* buf = display_manager_create_buffer_ex(name, width, height, 0, 0,
+                                                                    DISPLAY_MANAGER_LAYER_BACKGROUND, format);
+    TEST_ASSERT_NOT_NULL(buf);
+    if (buf->palette) {
+        TEST_ASSERT_EQUAL(ESP_OK, display_manager_setBufferPalette(buf, palette, PALETTE_SIZE));
+    }
+    display_manager_setBufferPixelAlpha(buf, variant == NUM_FORMATS);
+    return buf;
+}
+
+static void free_buffer(displayManager_buffer_t* buf)
+{
+    display_manager_free_buffer(buf);
+    display_manager_renderFrame(); // Reclaims it, along with its list
+}
+
+static uint32_t random_color(const displayManager_buffer_t* buf)
+{
+    if (buf->palette) {
+        return palette[rand() % PALETTE_SIZE];
+    }
+    if (buf->pixel_alpha) {
+        return ((uint32_t)rand() << 8) | (rand() & 0xFF);
+    }
+    return (uint32_t)rand() & 0xFFFFFF;
+}
+
+// Mostly around the buffer, sometimes past a character's byte coordinates
+static int32_t random_coord(int32_t size)
+{
+    if (rand() % 16 == 0) {
+        return rand() % 600 - 300;
+    }
+    return rand() % (3 * size) - size;
+}
+
+// Every pixel of a buffer as RGB888
+static void read_pixels(const displayManager_buffer_t* buf, uint32_t* out)
+{
+    for (uint32_t y = 0; y < buf->height; y++) {
+        const uint32_t* row = display_manager_expandRow(buf, buf->buffer8, 0, y, buf->width, &out[y * buf->width]);
+        memmove(&out[y * buf->width], row, buf->width * sizeof(uint32_t));
+    }
+}
+
+// Commands as the test recorded them, replayed into the reference buffer directly
+typedef struct
+{
+    displayList_op_E op;
+    char c;
+    int32_t x;
+    int32_t y;
+    int32_t a;
+    int32_t b;
+    int32_t src_x;
+    int32_t src_y;
+    uint32_t color;
+} test_command_t;
+
+typedef struct
+{
+    test_command_t commands[DISPLAY_LIST_MAX_COMMANDS];
+    uint32_t count;
+} test_list_t;
+
+static void random_list(test_list_t* out, const displayManager_buffer_t* buf, const displayManager_buffer_t* src)
+{
+    memset(out, 0, sizeof(*out));
+    out->count = rand() % (DISPLAY_LIST_MAX_COMMANDS / 2);
+    for (uint32_t i = 0; i < out->count; i++) {
+        test_command_t* cmd = &out->commands[i];
+        cmd->op = (src ? rand() % 4 : rand() % 3);
+        cmd->x = random_coord(TEST_WIDTH);
+        cmd->y = random_coord(TEST_HEIGHT);
+        cmd->color = random_color(buf);
+        switch (cmd->op) {
+            case DISPLAY_LIST_CHAR:
+                cmd->c = 32 + rand() % 96;
+                break;
+            case DISPLAY_LIST_RECT:
+                cmd->a = rand() % (TEST_WIDTH + 4) - 3; // Some empty or negative
+                cmd->b = rand() % (TEST_HEIGHT + 4) - 3;
+                break;
+            case DISPLAY_LIST_LINE:
+                cmd->a = random_coord(TEST_WIDTH);
+                cmd->b = random_coord(TEST_HEIGHT);
+                break;
+            default:
+                cmd->src_x = random_coord(src->width);
+                cmd->src_y = random_coord(src->height);
+                cmd->a = rand() % (TEST_WIDTH + 4) - 3;
+                cmd->b = rand() % (TEST_HEIGHT + 4) - 3;
+                cmd->color = 0;
+                break;
+        }
+    }
+}
+
+static void record(displayList_t* list, const test_list_t* in, const displayManager_buffer_t* src)
+{
+    display_list_begin(list);
+    for (uint32_t i = 0; i < in->count; i++) {
+        const test_command_t* cmd = &in->commands[i];
+        bool added = false;
+        switch (cmd->op) {
+            case DISPLAY_LIST_CHAR:
+                added = display_list_char(list, cmd->x, cmd->y, cmd->c, FONT_SIZE_5x3, cmd->color);
+                break;
+            case DISPLAY_LIST_RECT:
+                added = display_list_rect(list, cmd->x, cmd->y, cmd->a, cmd->b, cmd->color);
+                break;
+            case DISPLAY_LIST_LINE:
+                added = display_list_line(list, cmd->x, cmd->y, cmd->a, cmd->b, cmd->color);
+                break;
+            default:
+                added = display_list_blit(list, cmd->x, cmd->y, src, cmd->src_x, cmd->src_y, cmd->a, cmd->b);
+                break;
+        }
+        TEST_ASSERT_TRUE(added);
+    }
+}
+
+// The reference: the whole buffer cleared, then every command drawn straight into it
+static void redraw(displayManager_buffer_t* buf, const test_list_t* in, const displayManager_buffer_t* src)
+{
+    display_manager_fillBufferRect(buf, 0, 0, buf->width, buf->height, buf->pixel_alpha ? 0x00000000 : TRANSPARENT);
+    for (uint32_t i = 0; i < in->count; i++) {
+        const test_command_t* cmd = &in->commands[i];
+        switch (cmd->op) {
+            case DISPLAY_LIST_CHAR:
+                if (cmd->x >= 0 && cmd->y >= 0 && cmd->x <= UINT8_MAX && cmd->y <= UINT8_MAX) {
+                    graphics_drawChar(buf, cmd->x, cmd->y, cmd->c, FONT_SIZE_5x3, cmd->color);
+                }
+                break;
+            case DISPLAY_LIST_RECT:
+                graphics_fillRect(buf, cmd->x, cmd->y, cmd->a, cmd->b, cmd->color);
+                break;
+            case DISPLAY_LIST_LINE:
+                graphics_drawLine(buf, cmd->x, cmd->y, cmd->a, cmd->b, cmd->color);
+                break;
+            default:
+                graphics_blit(buf, cmd->x, cmd->y, src, cmd->src_x, cmd->src_y, cmd->a, cmd->b);
+                break;
+        }
+    }
+}
+
+// got matches want, and every pixel that changed from before lies in got's dirty rect
+static void assert_replayed(const displayManager_buffer_t* got, const displayManager_buffer_t* want,
+                            const uint32_t* before)
+{
+    static uint32_t gotPixels[TEST_WIDTH * TEST_HEIGHT];
+    static uint32_t wantPixels[TEST_WIDTH * TEST_HEIGHT];
+    read_pixels(got, gotPixels);
+    read_pixels(want, wantPixels);
+    for (uint32_t y = 0; y < got->height; y++) {
+        for (uint32_t x = 0; x < got->width; x++) {
+            uint32_t i = y * got->width + x;
+            if (gotPixels[i] != wantPixels[i]) {
+                char message[160];
+                snprintf(message, sizeof(message), "variant %d%s: pixel (%lu, %lu) is %08lX, want %08lX",
+                         got->format, got->pixel_alpha ? " with alpha" : "", (unsigned long)x, (unsigned long)y,
+                         (unsigned long)gotPixels[i], (unsigned long)wantPixels[i]);
+                TEST_FAIL_MESSAGE(message);
+            }
+            if (gotPixels[i] != before[i]) {
+                TEST_ASSERT_TRUE_MESSAGE(got->dirty && x >= got->dirty_x0 && x <= got->dirty_x1 &&
+                                         y >= got->dirty_y0 && y <= got->dirty_y1, "changed pixel not dirty");
+            }
+        }
+    }
+}
+
+static void fill_source(displayManager_buffer_t* src)
+{
+    for (uint32_t y = 0; y < src->height; y++) {
+        for (uint32_t x = 0; x < src->width; x++) {
+            display_manager_setBufferPixel(src, x, y, random_color(src));
+        }
+    }
+}
+
+// Random lists submitted one to three at a time, some of them repeats, with the display
+// task replaying in between. After each replay the buffer is the last submitted list
+// drawn from scratch, and only the area that changed was marked dirty
+static void test_replays_match_redraw(void)
+{
+    static uint32_t before[TEST_WIDTH * TEST_HEIGHT];
+    static test_list_t lists[3];
+    uint32_t replays = 0;
+    uint64_t cleared = 0;
+    uint64_t marked = 0;
+    for (int variant = 0; variant < NUM_VARIANTS; variant++) {
+        displayManager_buffer_t* got = make_buffer("got", TEST_WIDTH, TEST_HEIGHT, variant);
+        displayManager_buffer_t* want = make_buffer("want", TEST_WIDTH, TEST_HEIGHT, variant);
+        displayManager_buffer_t* src = make_buffer("src", TEST_WIDTH + 5, TEST_HEIGHT - 2, variant);
+        fill_source(src);
+        // Whatever the buffer held before its list is cleared by the first replay
+        for (uint32_t y = 0; y < TEST_HEIGHT; y++) {
+            for (uint32_t x = 0; x < TEST_WIDTH; x++) {
+                display_manager_setBufferPixel(got, x, y, random_color(got));
+            }
+        }
+        displayList_t* list = display_list_create(got);
+        TEST_ASSERT_NOT_NULL(list);
+
+        const test_list_t* shown = NULL;
+        for (int it = 0; it < 4000; it++) {
+            uint32_t submits = 1 + rand() % 3;
+            const test_list_t* submitted = shown;
+            for (uint32_t s = 0; s < submits; s++) {
+                // Now and then the same list again, which is not handed over
+                if (submitted && rand() % 4 == 0) {
+                    record(list, submitted, src);
+                    TEST_ASSERT_FALSE(display_list_submit(list));
+                    continue;
+                }
+                random_list(&lists[s], got, src);
+                record(list, &lists[s], src);
+                display_list_submit(list);
+                submitted = &lists[s];
+            }
+            if (!submitted) {
+                continue;
+            }
+
+            read_pixels(got, before);
+            got->dirty = false;
+            const displayList_bounds_t* old = &list->drawn_bounds;
+            uint32_t oldArea = (old->x0 <= old->x1) ? (old->x1 - old->x0 + 1) * (old->y1 - old->y0 + 1) : 0;
+            if (display_list_rasterize(list)) {
+                replays++;
+                cleared += oldArea;
+                marked += got->dirty ? (got->dirty_x1 - got->dirty_x0 + 1) * (got->dirty_y1 - got->dirty_y0 + 1) : 0;
+            }
+            redraw(want, submitted, src);
+            assert_replayed(got, want, before);
+            shown = submitted;
+            // Keep the lists a replay may still be compared against
+            if (shown != &lists[0]) {
+                lists[0] = *shown;
+                shown = &lists[0];
+            }
+        }
+        free_buffer(src);
+        free_buffer(got);
+        free_buffer(want);
+    }
+    char message[160];
+    snprintf(message, sizeof(message), "%lu replays of %dx%d: %.0f pixels cleared and %.0f marked dirty per replay, of %d",
+             (unsigned long)replays, TEST_WIDTH, TEST_HEIGHT, (double)cleared / replays, (double)marked / replays,
+             TEST_WIDTH * TEST_HEIGHT);
+    TEST_MESSAGE(message);
+}
+
+// Lists that are the same as the last one cost a hash: no handover and no replay. A list
+// changed and changed back before the display task got to it is not replayed either
+static void test_unchanged_lists_are_skipped(void)
+{
+    displayManager_buffer_t* buf = make_buffer("clock", 13, 7, DISPLAY_FORMAT_RGB888);
+    displayList_t* list = display_list_create(buf);
+    TEST_ASSERT_NOT_NULL(list);
+
+    display_list_begin(list);
+    display_list_char(list, 0, 0, '1', FONT_SIZE_5x3, 0xFF0000);
+    TEST_ASSERT_TRUE(display_list_submit(list));
+    TEST_ASSERT_TRUE(display_list_rasterize(list));
+    TEST_ASSERT_FALSE(display_list_rasterize(list)); // Nothing new
+
+    display_list_begin(list);
+    display_list_char(list, 0, 0, '1', FONT_SIZE_5x3, 0xFF0000);
+    TEST_ASSERT_FALSE(display_list_submit(list));
+    TEST_ASSERT_FALSE(display_list_rasterize(list));
+
+    display_list_begin(list);
+    display_list_char(list, 0, 0, '2', FONT_SIZE_5x3, 0xFF0000);
+    TEST_ASSERT_TRUE(display_list_submit(list));
+    display_list_begin(list);
+    display_list_char(list, 0, 0, '1', FONT_SIZE_5x3, 0xFF0000);
+    TEST_ASSERT_TRUE(display_list_submit(list));
+    TEST_ASSERT_FALSE(display_list_rasterize(list)); // Back to what is shown
+
+    TEST_ASSERT_EQUAL_UINT32(3, list->submits);
+    TEST_ASSERT_EQUAL_UINT32(1, list->unchanged);
+    TEST_ASSERT_EQUAL_UINT32(1, list->replays);
+    free_buffer(buf);
+}
+
+// Every field takes part in the hash: a list that differs from the last one in any
+// single field is handed over and replayed
+static void test_every_field_changes_the_list(void)
+{
+    displayManager_buffer_t* buf = make_buffer("buf", TEST_WIDTH, TEST_HEIGHT, DISPLAY_FORMAT_RGB888);
+    displayManager_buffer_t* src = make_buffer("src", TEST_WIDTH, TEST_HEIGHT, DISPLAY_FORMAT_RGB888);
+    displayManager_buffer_t* other = make_buffer("other", TEST_WIDTH, TEST_HEIGHT, DISPLAY_FORMAT_RGB888);
+    fill_source(src);
+    fill_source(other);
+    displayList_t* list = display_list_create(buf);
+    TEST_ASSERT_NOT_NULL(list);
+
+    static const test_list_t base = {
+        .commands = {
+            { .op = DISPLAY_LIST_CHAR, .c = '7', .x = 1, .y = 2, .color = 0xFF0000 },
+            { .op = DISPLAY_LIST_RECT, .x = 3, .y = 4, .a = 5, .b = 6, .color = 0x00FF00 },
+            { .op = DISPLAY_LIST_LINE, .x = 7, .y = 8, .a = 9, .b = 10, .color = 0x0000FF },
+            { .op = DISPLAY_LIST_BLIT, .x = 11, .y = 1, .a = 6, .b = 5, .src_x = 2, .src_y = 3 },
+        },
+        .count = 4,
+    };
+    record(list, &base, src);
+    TEST_ASSERT_TRUE(display_list_submit(list));
+    TEST_ASSERT_TRUE(display_list_rasterize(list));
+
+    // Fields each command uses: x, y, a, b, color, c, src_x, src_y, the source, and
+    // the op itself where another one takes the same fields
+    static const uint32_t uses[] = {
+        [DISPLAY_LIST_CHAR] = 0x033,
+        [DISPLAY_LIST_RECT] = 0x21F,
+        [DISPLAY_LIST_LINE] = 0x21F,
+        [DISPLAY_LIST_BLIT] = 0x1CF,
+    };
+    for (uint32_t i = 0; i < base.count; i++) {
+        for (int field = 0; field < 10; field++) {
+            if (!(uses[base.commands[i].op] & (1u << field))) {
+                continue;
+            }
+            test_list_t changed = base;
+            test_command_t* cmd = &changed.commands[i];
+            const displayManager_buffer_t* from = src;
+            switch (field) {
+                case 0: cmd->x++; break;
+                case 1: cmd->y++; break;
+                case 2: cmd->a++; break;
+                case 3: cmd->b++; break;
+                case 4: cmd->color ^= 0x000100; break;
+                case 5: cmd->c++; break;
+                case 6: cmd->src_x++; break;
+                case 7: cmd->src_y++; break;
+                case 8: from = other; break;
+                default: cmd->op = (cmd->op == DISPLAY_LIST_RECT) ? DISPLAY_LIST_LINE : DISPLAY_LIST_RECT; break;
+            }
+            char message[64];
+            snprintf(message, sizeof(message), "command %lu, field %d", (unsigned long)i, field);
+            record(list, &changed, from);
+            TEST_ASSERT_TRUE_MESSAGE(display_list_submit(list), message);
+            TEST_ASSERT_TRUE_MESSAGE(display_list_rasterize(list), message);
+            record(list, &base, src);
+            TEST_ASSERT_TRUE_MESSAGE(display_list_submit(list), message);
+            TEST_ASSERT_TRUE_MESSAGE(display_list_rasterize(list), message);
+        }
+    }
+    free_buffer(other);
+    free_buffer(src);
+    free_buffer(buf);
+}
+
+// A blit copies its source at replay. When only the source's pixels change, the list
+// is the same and is skipped until it is invalidated
+static void test_invalidate_replays_blits(void)
+{
+    displayManager_buffer_t* buf = make_buffer("buf", 8, 4, DISPLAY_FORMAT_RGB888);
+    displayManager_buffer_t* src = make_buffer("src", 8, 4, DISPLAY_FORMAT_RGB888);
+    displayList_t* list = display_list_create(buf);
+    TEST_ASSERT_NOT_NULL(list);
+
+    display_manager_setBufferPixel(src, 2, 1, 0x123456);
+    display_list_begin(list);
+    display_list_blit(list, 0, 0, src, 0, 0, 8, 4);
+    TEST_ASSERT_TRUE(display_list_submit(list));
+    TEST_ASSERT_TRUE(display_list_rasterize(list));
+    TEST_ASSERT_EQUAL_HEX32(0x123456, buf->buffer[1 * 8 + 2]);
+
+    display_manager_setBufferPixel(src, 2, 1, 0x654321);
+    display_list_begin(list);
+    display_list_blit(list, 0, 0, src, 0, 0, 8, 4);
+    TEST_ASSERT_FALSE(display_list_submit(list));
+    TEST_ASSERT_EQUAL_HEX32(0x123456, buf->buffer[1 * 8 + 2]);
+
+    display_list_invalidate(list);
+    display_list_begin(list);
+    display_list_blit(list, 0, 0, src, 0, 0, 8, 4);
+    TEST_ASSERT_TRUE(display_list_submit(list));
+    TEST_ASSERT_TRUE(display_list_rasterize(list));
+    TEST_ASSERT_EQUAL_HEX32(0x654321, buf->buffer[1 * 8 + 2]);
+    free_buffer(src);
+    free_buffer(buf);
+}
+
+// Commands that do not fit their int16_t fields, and any past a full list, are dropped
+// rather than drawn somewhere else
+static void test_out_of_range_commands_are_dropped(void)
+{
+    displayManager_buffer_t* buf = make_buffer("buf", 8, 4, DISPLAY_FORMAT_RGB888);
+    displayList_t* list = display_list_create(buf);
+    TEST_ASSERT_NOT_NULL(list);
+
+    display_list_begin(list);
+    TEST_ASSERT_FALSE(display_list_char(list, INT16_MAX + 1, 0, '1', FONT_SIZE_5x3, 0xFF0000));
+    TEST_ASSERT_FALSE(display_list_rect(list, 0, 0, 65536 + 4, 4, 0xFF0000));
+    TEST_ASSERT_FALSE(display_list_line(list, 0, 0, 2, INT16_MIN - 1, 0xFF0000));
+    TEST_ASSERT_FALSE(display_list_blit(list, 0, 0, buf, INT32_MIN, 0, 1, 1));
+    TEST_ASSERT_TRUE(display_list_rect(list, INT16_MIN, INT16_MIN, INT16_MAX, INT16_MAX, 0x00FF00));
+    TEST_ASSERT_EQUAL_UINT32(1, list->count[list->record]);
+    for (uint32_t i = 1; i < DISPLAY_LIST_MAX_COMMANDS; i++) {
+        TEST_ASSERT_TRUE(display_list_rect(list, 0, 0, 1, 1, 0x0000FF));
+    }
+    TEST_ASSERT_FALSE(display_list_rect(list, 0, 0, 1, 1, 0xFF0000));
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_LIST_MAX_COMMANDS, list->count[list->record]);
+
+    TEST_ASSERT_TRUE(display_list_submit(list));
+    TEST_ASSERT_TRUE(display_list_rasterize(list));
+    TEST_ASSERT_EQUAL_HEX32(0x0000FF, buf->buffer[0]);
+    TEST_ASSERT_EQUAL_HEX32(TRANSPARENT, buf->buffer[1]); // The big rect ends at (-2, -2)
+    free_buffer(buf);
+}
+
+static void test_create_rejects_unsuitable_buffers(void)
+{
+    displayManager_buffer_t* buf = make_buffer("buf", 8, 4, DISPLAY_FORMAT_RGB888);
+    TEST_ASSERT_NULL(display_list_create(NULL));
+    TEST_ASSERT_NOT_NULL(display_list_create(buf));
+    TEST_ASSERT_NULL(display_list_create(buf)); // Already has one
+    free_buffer(buf);
+
+    displayManager_buffer_t* canvas = display_manager_create_buffer_ex("canvas", 8, 4, 0, 0,
+                                                                       DISPLAY_MANAGER_LAYER_BACKGROUND,
+                                                                       DISPLAY_FORMAT_RGB888);
+    TEST_ASSERT_NOT_NULL(canvas);
+    TEST_ASSERT_EQUAL(ESP_OK, display_manager_enableDoubleBuffer(canvas));
+    TEST_ASSERT_NULL(display_list_create(canvas));
+    free_buffer(canvas);
+}
+
+// The compositor replays submitted lists itself, so a list reaches the LEDs in the
+// next frame without the app touching the buffer
+static void test_frames_show_submitted_lists(void)
+{
+    displayManager_buffer_t* buf = make_buffer("buf", 8, 4, DISPLAY_FORMAT_RGB888);
+    displayList_t* list = display_list_create(buf);
+    TEST_ASSERT_NOT_NULL(list);
+    display_manager_renderFrame();
+
+    for (uint32_t color = 0x000010; color <= 0x000030; color += 0x10) {
+        display_list_begin(list);
+        display_list_rect(list, 1, 1, 3, 2, color);
+        TEST_ASSERT_TRUE(display_list_submit(list));
+        TEST_ASSERT_TRUE(display_manager_renderFrame());
+        for (uint32_t y = 0; y < 4; y++) {
+            for (uint32_t x = 0; x < 8; x++) {
+                bool inside = x >= 1 && x <= 3 && y >= 1 && y <= 2;
+                TEST_ASSERT_EQUAL_HEX32(inside ? color : BLACK,
+                                        host_leds[dm_ctx.index_map[y * dm_ctx.cols + x]]);
+            }
+        }
+        TEST_ASSERT_FALSE(display_manager_renderFrame()); // Nothing new to replay
+    }
+    free_buffer(buf);
+}
+
+// The clock's list: four digits and a colon on 13x7
+static void clock_list(displayList_t* list, const char* digits, uint32_t colon)
+{
+    display_list_begin(list);
+    display_list_char(list, 0, 0, digits[0], FONT_SIZE_5x3, 0xFF0000);
+    display_list_char(list, 3, 0, digits[1], FONT_SIZE_5x3, 0x00FF00);
+    display_list_rect(list, 6, 1, 1, 1, colon);
+    display_list_rect(list, 6, 3, 1, 1, colon);
+    display_list_char(list, 7, 0, digits[2], FONT_SIZE_5x3, 0x0000FF);
+    display_list_char(list, 10, 0, digits[3], FONT_SIZE_5x3, 0xFFFF00);
+}
+
+// The clock drawn the way it was before lists: the whole buffer cleared and redrawn
+static void clock_redraw(displayManager_buffer_t* buf, const char* digits, uint32_t colon)
+{
+    display_manager_fillBufferRect(buf, 0, 0, buf->width, buf->height, TRANSPARENT);
+    graphics_drawChar(buf, 0, 0, digits[0], FONT_SIZE_5x3, 0xFF0000);
+    graphics_drawChar(buf, 3, 0, digits[1], FONT_SIZE_5x3, 0x00FF00);
+    graphics_fillRect(buf, 6, 1, 1, 1, colon);
+    graphics_fillRect(buf, 6, 3, 1, 1, colon);
+    graphics_drawChar(buf, 7, 0, digits[2], FONT_SIZE_5x3, 0x0000FF);
+    graphics_drawChar(buf, 10, 0, digits[3], FONT_SIZE_5x3, 0xFFFF00);
+}
+
+typedef enum
+{
+    BENCH_REDRAW,
+    BENCH_UNCHANGED,
+    BENCH_CHANGED,
+    BENCH_COUNT,
+} bench_E;
+
+static double time_clock(displayManager_buffer_t* buf, displayList_t* list, bench_E bench)
+{
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 100000; i++) {
+            uint32_t colon = (i & 1) ? 0xFFFF00 : 0x000000;
+            switch (bench) {
+                case BENCH_REDRAW:
+                    clock_redraw(buf, "1230", colon);
+                    break;
+                case BENCH_UNCHANGED:
+                    clock_list(list, "1230", 0xFFFF00);
+                    display_list_submit(list);
+                    display_list_rasterize(list);
+                    break;
+                default:
+                    clock_list(list, "1230", colon);
+                    display_list_submit(list);
+                    display_list_rasterize(list);
+                    break;
+            }
+            __asm__ volatile("" ::: "memory");
+        }
+        double ns = (esp_timer_get_time() - start) * 1000.0 / 100000;
+        best = (ns < best) ? ns : best;
+    }
+    return best;
+}
+
+static void test_benchmark_clock(void)
+{
+    static const char* names[BENCH_COUNT] = {
+        "full redraw", "list, unchanged", "list, colon blinking",
+    };
+    displayManager_buffer_t* plain = make_buffer("plain", 13, 7, DISPLAY_FORMAT_RGB888);
+    displayManager_buffer_t* buf = make_buffer("clock", 13, 7, DISPLAY_FORMAT_RGB888);
+    displayList_t* list = display_list_create(buf);
+    TEST_ASSERT_NOT_NULL(list);
+    for (int bench = 0; bench < BENCH_COUNT; bench++) {
+        double ns = time_clock(bench == BENCH_REDRAW ? plain : buf, list, bench);
+        char message[128];
+        snprintf(message, sizeof(message), "clock on 13x7, %s: %.0f ns per update", names[bench], ns);
+        TEST_MESSAGE(message);
+    }
+    free_buffer(buf);
+    free_buffer(plain);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_replays_match_redraw);
+    RUN_TEST(test_unchanged_lists_are_skipped);
+    RUN_TEST(test_every_field_changes_the_list);
+    RUN_TEST(test_invalidate_replays_blits);
+    RUN_TEST(test_out_of_range_commands_are_dropped);
+    RUN_TEST(test_create_rejects_unsuitable_buffers);
+    RUN_TEST(test_frames_show_submitted_lists);
+    RUN_TEST(test_benchmark_clock);
+    return UNITY_END();
+}
@@ -0,0 +1,1583 @@
+// Host tests for the display manager's LED mapping, compositor and buffer pool.
+// Run with: pio test -e native
+#include <unity.h>
+
+#include "display_manager.c"
+#undef TAG
+#include "utils/display_list.c"
+#undef TAG
+#include "utils/graphics.c"
+#undef TAG
+#include "utils/fonts.c"
+#include "5x3.c"
+
+#include "display_host.h"
+
+#include "esp_timer.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static const struct
+{
+    uint32_t rows;
+    uint32_t cols;
+} geometries[] = { { 8, 32 }, { 16, 32 }, { 5, 7 }, { 1, 9 } };
+
+#define NUM_GEOMETRIES (sizeof(geometries) / sizeof(geometries[0]))
+
+void setUp(void)
+{
+    srand(1);
+}
+
+void tearDown(void)
+{
+    host_display_stop();
+}
+
+// The mapping before the index table: the one rotation setRawPixel handled, with the
+// panel size the build was made for
+static uint32_t baseline_index(uint32_t row, uint32_t col, uint32_t rows, uint32_t cols)
+{
+    if (col % 2 == 0) {
+        return (cols - 1 - col) * rows + row;
+    }
+    return (cols - 1 - col) * rows + (rows - 1 - row);
+}
+
+// The default mounting is the panel the old formula was written for
+static void test_default_map_matches_baseline(void)
+{
+    for (uint32_t g = 0; g < 2; g++) {
+        uint32_t rows = geometries[g].rows;
+        uint32_t cols = geometries[g].cols;
+        host_display_start(rows, cols, GENEALOGY_UNSET, GENEALOGY_UNSET);
+        TEST_ASSERT_NOT_NULL(dm_ctx.index_map);
+        for (uint32_t row = 0; row < rows; row++) {
+            for (uint32_t col = 0; col < cols; col++) {
+                TEST_ASSERT_EQUAL_UINT32(baseline_index(row, col, rows, cols),
+                                         dm_ctx.index_map[row * cols + col]);
+            }
+        }
+        host_display_stop();
+    }
+}
+
+// Every layout sends each logical pixel to its own LED, and walking the strip
+// moves to a neighbouring pixel each step
+static void test_every_map_is_a_snake(void)
+{
+    for (uint32_t g = 0; g < NUM_GEOMETRIES; g++) {
+        uint32_t rows = geometries[g].rows;
+        uint32_t cols = geometries[g].cols;
+        for (int rot = DISPLAY_ROTATION_0; rot <= DISPLAY_ROTATION_270; rot++) {
+            for (int wire = DISPLAY_WIRING_ROW_SERPENTINE; wire <= DISPLAY_WIRING_COLUMN_SERPENTINE; wire++) {
+                for (int mirrored = 0; mirrored < 2; mirrored++) {
+                    uint16_t* map = display_manager_buildIndexMap(rows, cols, rot, wire, mirrored);
+                    TEST_ASSERT_NOT_NULL(map);
+                    int32_t* where = malloc(rows * cols * sizeof(int32_t));
+                    for (uint32_t i = 0; i < rows * cols; i++) {
+                        where[i] = -1;
+                    }
+                    for (uint32_t i = 0; i < rows * cols; i++) {
+                        TEST_ASSERT_LESS_THAN_UINT32(rows * cols, map[i]);
+                        TEST_ASSERT_EQUAL_INT32(-1, where[map[i]]);
+                        where[map[i]] = i;
+                    }
+                    for (uint32_t led = 1; led < rows * cols; led++) {
+                        int32_t dr = where[led] / (int32_t)cols - where[led - 1] / (int32_t)cols;
+                        int32_t dc = where[led] % (int32_t)cols - where[led - 1] % (int32_t)cols;
+                        TEST_ASSERT_EQUAL_INT32(1, abs(dr) + abs(dc));
+                    }
+                    free(where);
+                    free(map);
+                }
+            }
+        }
+    }
+}
+
+// Rotating by 180 degrees and mirroring flip the logical coordinates of a layout
+static void test_maps_are_related_by_flips(void)
+{
+    for (uint32_t g = 0; g < NUM_GEOMETRIES; g++) {
+        uint32_t rows = geometries[g].rows;
+        uint32_t cols = geometries[g].cols;
+        for (int wire = DISPLAY_WIRING_ROW_SERPENTINE; wire <= DISPLAY_WIRING_COLUMN_SERPENTINE; wire++) {
+            uint16_t* map[4];
+            uint16_t* mirrored[4];
+            for (int rot = DISPLAY_ROTATION_0; rot <= DISPLAY_ROTATION_270; rot++) {
+                map[rot] = display_manager_buildIndexMap(rows, cols, rot, wire, false);
+                mirrored[rot] = display_manager_buildIndexMap(rows, cols, rot, wire, true);
+            }
+            for (uint32_t row = 0; row < rows; row++) {
+                for (uint32_t col = 0; col < cols; col++) {
+                    uint32_t i = row * cols + col;
+                    uint32_t flipped = (rows - 1 - row) * cols + (cols - 1 - col);
+                    uint32_t opposite = row * cols + (cols - 1 - col);
+                    TEST_ASSERT_EQUAL_UINT16(map[DISPLAY_ROTATION_0][flipped], map[DISPLAY_ROTATION_180][i]);
+                    TEST_ASSERT_EQUAL_UINT16(map[DISPLAY_ROTATION_90][flipped], map[DISPLAY_ROTATION_270][i]);
+                    for (int rot = DISPLAY_ROTATION_0; rot <= DISPLAY_ROTATION_270; rot++) {
+                        TEST_ASSERT_EQUAL_UINT16(map[rot][opposite], mirrored[rot][i]);
+                    }
+                }
+            }
+            for (int rot = DISPLAY_ROTATION_0; rot <= DISPLAY_ROTATION_270; rot++) {
+                free(map[rot]);
+                free(mirrored[rot]);
+            }
+        }
+    }
+}
+
+// A pixel drawn into a buffer comes out of the driver at the LED the old formula picked
+static void test_frame_reaches_mapped_leds(void)
+{
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    displayManager_buffer_t* buf = display_manager_create_buffer("test", 32, 16, 0, 0,
+                                                                DISPLAY_MANAGER_LAYER_BACKGROUND);
+    TEST_ASSERT_NOT_NULL(buf);
+    for (uint32_t y = 0; y < 16; y++) {
+        for (uint32_t x = 0; x < 32; x++) {
+            display_manager_setBufferPixel(buf, x, y, (y << 16) | x);
+        }
+    }
+    TEST_ASSERT_TRUE(display_manager_renderFrame());
+    TEST_ASSERT_EQUAL_UINT32(1, host_frames_submitted);
+    for (uint32_t y = 0; y < 16; y++) {
+        for (uint32_t x = 0; x < 32; x++) {
+            TEST_ASSERT_EQUAL_HEX32((y << 16) | x, host_leds[baseline_index(y, x, 16, 32)]);
+        }
+    }
+}
+
+// A full-screen picture drawn after init reaches the LEDs of the panel it came up on
+static void assert_panel_works(uint32_t rows, uint32_t cols)
+{
+    TEST_ASSERT_TRUE(dm_ctx.initialized);
+    TEST_ASSERT_EQUAL_UINT32(rows, dm_ctx.rows);
+    TEST_ASSERT_EQUAL_UINT32(cols, dm_ctx.cols);
+    TEST_ASSERT_EQUAL_UINT32(rows * cols, host_num_leds);
+    displayManager_buffer_t* buf = display_manager_create_buffer("test", cols, rows, 0, 0,
+                                                                DISPLAY_MANAGER_LAYER_BACKGROUND);
+    TEST_ASSERT_NOT_NULL(buf);
+    for (uint32_t i = 0; i < rows * cols; i++) {
+        display_manager_setBufferPixel(buf, i % cols, i / cols, 0x10000 + i);
+    }
+    TEST_ASSERT_TRUE(display_manager_renderFrame());
+    for (uint32_t i = 0; i < rows * cols; i++) {
+        TEST_ASSERT_EQUAL_HEX32(0x10000 + i, host_leds[dm_ctx.index_map[i]]);
+    }
+}
+
+// Geometries past DISPLAY_MANAGER_MAX_PIXELS are refused when saved, and ignored at
+// boot if one was stored anyway
+static void test_oversized_geometry_is_rejected(void)
+{
+    const genealogy_geometry_t saved = { 32, 32, DISPLAY_WIRING_ROW_SERPENTINE, DISPLAY_ROTATION_180 };
+    TEST_ASSERT_EQUAL(ESP_OK, display_manager_saveGeometry(32, 32, DISPLAY_WIRING_ROW_SERPENTINE,
+                                                           DISPLAY_ROTATION_180));
+    TEST_ASSERT_EQUAL_MEMORY(&saved, &host_geometry, sizeof(saved));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, display_manager_saveGeometry(32, 33, 0, 0));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, display_manager_saveGeometry(33, 32, 0, 0));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, display_manager_saveGeometry(254, 254, 0, 0));
+    TEST_ASSERT_EQUAL_MEMORY(&saved, &host_geometry, sizeof(saved));
+
+    host_display_start(32, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    assert_panel_works(32, 32);
+    host_display_stop();
+    host_heap_allocations = 0;
+    host_display_start(NEOPIXEL_NUM_ROWS, NEOPIXEL_NUM_COLS, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    uint32_t allocations = host_heap_allocations;
+    host_display_stop();
+
+    // Not even tried: booting takes no more allocations than on the default panel
+    host_heap_allocations = 0;
+    host_display_start(40, 40, DISPLAY_WIRING_COLUMN_SERPENTINE, DISPLAY_ROTATION_90);
+    TEST_ASSERT_EQUAL_UINT32(allocations, host_heap_allocations);
+    assert_panel_works(NEOPIXEL_NUM_ROWS, NEOPIXEL_NUM_COLS);
+    TEST_ASSERT_EQUAL(DISPLAY_WIRING_COLUMN_SERPENTINE, dm_ctx.wiring);
+    TEST_ASSERT_EQUAL(DISPLAY_ROTATION_90, dm_ctx.rotation);
+}
+
+// Failing each allocation of a stored 16x32 geometry in turn, the frame buffers' or
+// the driver's, init still comes up on the default panel. Only when that fails too
+// does it give up, with nothing left allocated
+static void test_geometry_falls_back_when_memory_is_short(void)
+{
+    host_heap_allocations = 0;
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    uint32_t allocations = host_heap_allocations;
+    host_display_stop();
+
+    for (uint32_t n = 1; n <= allocations; n++) {
+        host_heap_allocations = 0;
+        host_heap_fail_at = n;
+        host_display_start(16, 32, DISPLAY_WIRING_COLUMN_SERPENTINE, DISPLAY_ROTATION_0);
+        assert_panel_works(NEOPIXEL_NUM_ROWS, NEOPIXEL_NUM_COLS);
+        TEST_ASSERT_EQUAL(DISPLAY_WIRING_COLUMN_SERPENTINE, dm_ctx.wiring);
+        host_display_stop();
+    }
+
+    // Room for the default panel's buffers but not the stored one's
+    host_heap_limit = NEOPIXEL_NUM_ROWS * NEOPIXEL_NUM_COLS * sizeof(uint32_t);
+    host_display_start(32, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    assert_panel_works(NEOPIXEL_NUM_ROWS, NEOPIXEL_NUM_COLS);
+    host_display_stop();
+
+    host_heap_limit = 16;
+    host_geometry = (genealogy_geometry_t){ 32, 32, GENEALOGY_UNSET, GENEALOGY_UNSET };
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, display_manager_init());
+    TEST_ASSERT_FALSE(dm_ctx.initialized);
+    TEST_ASSERT_NULL(dm_ctx.output_buffer);
+    TEST_ASSERT_NULL(dm_ctx.index_map);
+    TEST_ASSERT_NULL(dm_ctx.block_state);
+}
+
+// Every buffer painted bottom layer first, the way the compositor did before dirty
+// regions, in logical order
+static void reference_frame(uint32_t* out)
+{
+    memset(out, 0, dm_ctx.rows * dm_ctx.cols * sizeof(uint32_t));
+    for (int layer = DISPLAY_MANAGER_LAYER_BACKGROUND; layer <= DISPLAY_MANAGER_LAYER_SYSTEM; layer++) {
+        for (uint32_t i = 0; i < dm_ctx.num_buffers; i++) {
+            displayManager_buffer_t* buf = dm_ctx.buffers[i];
+            if (!buf->active || (int)buf->layer != layer) {
+                continue;
+            }
+            for (uint32_t y = 0; y < buf->height; y++) {
+                for (uint32_t x = 0; x < buf->width; x++) {
+                    uint32_t color = buf->buffer[y * buf->width + x];
+                    if (buf->x + x < dm_ctx.cols && buf->y + y < dm_ctx.rows && color != TRANSPARENT) {
+                        out[(buf->y + y) * dm_ctx.cols + buf->x + x] = color;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Draws, direct writes, moves and show/hide between frames. Whatever was recomposed,
+// the LEDs must show the full picture, and frames with no change are not sent
+static void test_dirty_frames_match_full_recompose(void)
+{
+    static uint32_t expected[DISPLAY_MANAGER_MAX_PIXELS];
+    host_display_start(8, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    displayManager_buffer_t* bufs[3] = {
+        display_manager_create_buffer("back", dm_ctx.cols, dm_ctx.rows, 0, 0,
+                                      DISPLAY_MANAGER_LAYER_BACKGROUND),
+        display_manager_create_buffer("mid", 9, 5, 3, 2, DISPLAY_MANAGER_LAYER_FOREGROUND),
+        display_manager_create_buffer("top", 4, 4, 20, 1, DISPLAY_MANAGER_LAYER_SYSTEM),
+    };
+    for (uint32_t i = 0; i < dm_ctx.rows * dm_ctx.cols; i++) {
+        display_manager_setBufferPixel(bufs[0], i % dm_ctx.cols, i / dm_ctx.cols, rand() & 0xFFFFFF);
+    }
+
+    TEST_ASSERT_TRUE(display_manager_renderFrame());
+
+    uint32_t frames = 5000;
+    uint32_t idle = 0;
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        uint32_t ops = (rand() % 3 == 0) ? 0 : 1 + rand() % 3;
+        for (uint32_t op = 0; op < ops; op++) {
+            displayManager_buffer_t* buf = bufs[rand() % 3];
+            uint32_t x = rand() % buf->width;
+            uint32_t y = rand() % buf->height;
+            uint32_t color = (rand() % 4 == 0) ? TRANSPARENT : (rand() & 0xFFFFFF);
+            switch (rand() % 8) {
+                case 0:
+                    display_manager_setBufferActive(buf, !buf->active);
+                    break;
+                case 1:
+                    buf->x = rand() % dm_ctx.cols;
+                    buf->y = rand() % dm_ctx.rows;
+                    break;
+                case 2:
+                    buf->buffer[y * buf->width + x] = color;
+                    display_manager_markDirty(buf, x, y, 1, 1);
+                    break;
+                default:
+                    display_manager_setBufferPixel(buf, x, y, color);
+                    break;
+            }
+        }
+        bool sent = display_manager_renderFrame();
+        if (ops == 0) {
+            TEST_ASSERT_FALSE(sent);
+            idle++;
+        }
+        reference_frame(expected);
+        for (uint32_t i = 0; i < dm_ctx.rows * dm_ctx.cols; i++) {
+            TEST_ASSERT_EQUAL_HEX32(expected[i], host_leds[dm_ctx.index_map[i]]);
+        }
+    }
+
+    uint32_t composed;
+    display_manager_getFrameCounts(&composed, NULL);
+    TEST_ASSERT_EQUAL_UINT32(host_frames_submitted, composed);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(frames + 1 - idle, composed);
+}
+
+#define BENCH_ROWS 16
+#define BENCH_COLS 32
+
+static uint32_t bench_logical[BENCH_ROWS * BENCH_COLS];
+static uint32_t bench_physical[BENCH_ROWS * BENCH_COLS];
+static uint16_t* bench_map;
+static volatile displayManager_rotation_E bench_rotation = DISPLAY_ROTATION_270;
+
+// The old per-pixel path: the rotation switch and serpentine arithmetic for every pixel
+static void map_baseline(void)
+{
+    for (uint32_t row = 0; row < BENCH_ROWS; row++) {
+        for (uint32_t col = 0; col < BENCH_COLS; col++) {
+            uint32_t index = 0;
+            switch (bench_rotation)
+            {
+                case DISPLAY_ROTATION_270:
+                    index = baseline_index(row, col, BENCH_ROWS, BENCH_COLS);
+                    break;
+                default:
+                    break;
+            }
+            bench_physical[index] = bench_logical[row * BENCH_COLS + col];
+        }
+    }
+}
+
+// The display task's loop: one table load per pixel
+static void map_table(void)
+{
+    for (uint32_t i = 0; i < BENCH_ROWS * BENCH_COLS; i++) {
+        bench_physical[bench_map[i]] = bench_logical[i];
+    }
+}
+
+// Nanoseconds per pixel, best of a few runs
+static double time_per_pixel(void (*map)(void))
+{
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 2000; i++) {
+            map();
+        }
+        double ns = (esp_timer_get_time() - start) * 1000.0 / (2000.0 * BENCH_ROWS * BENCH_COLS);
+        best = (ns < best) ? ns : best;
+    }
+    return best;
+}
+
+static void test_benchmark_mapping(void)
+{
+    for (uint32_t i = 0; i < BENCH_ROWS * BENCH_COLS; i++) {
+        bench_logical[i] = rand() & 0xFFFFFF;
+    }
+    bench_map = display_manager_buildIndexMap(BENCH_ROWS, BENCH_COLS, DISPLAY_ROTATION_180,
+                                              DISPLAY_WIRING_COLUMN_SERPENTINE, false);
+    double baseline = time_per_pixel(map_baseline);
+    static uint32_t expected[BENCH_ROWS * BENCH_COLS];
+    memcpy(expected, bench_physical, sizeof(expected));
+    double table = time_per_pixel(map_table);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected, bench_physical, BENCH_ROWS * BENCH_COLS);
+    free(bench_map);
+    char message[128];
+    snprintf(message, sizeof(message), "%dx%d: formula per pixel %.2f ns/pixel, index table %.2f ns/pixel",
+             BENCH_ROWS, BENCH_COLS, baseline, table);
+    TEST_MESSAGE(message);
+}
+
+static uint32_t random_rgb(void)
+{
+    return ((uint32_t)rand() << 8 ^ (uint32_t)rand()) & 0xFFFFFF;
+}
+
+// A buffer pixel decoded from its format by hand, with its alpha (0-255)
+static uint32_t reference_pixel(const displayManager_buffer_t* buf, uint32_t x, uint32_t y, uint32_t* alpha)
+{
+    uint32_t value;
+    switch (buf->format)
+    {
+        case DISPLAY_FORMAT_RGB565:
+        {
+            uint16_t v = buf->buffer16[y * buf->width + x];
+            uint32_t r = v >> 11;
+            uint32_t g = (v >> 6) & 0x1F;
+            uint32_t b = v & 0x1F;
+            *alpha = (v & 0x0020) ? 255 : 0;
+            return (((r << 3) | (r >> 2)) << 16) | (((g << 3) | (g >> 2)) << 8) | ((b << 3) | (b >> 2));
+        }
+
+        case DISPLAY_FORMAT_INDEXED8:
+            value = buf->palette[buf->buffer8[y * buf->stride + x]];
+            break;
+
+        case DISPLAY_FORMAT_INDEXED4:
+        {
+            uint8_t pair = buf->buffer8[y * buf->stride + x / 2];
+            value = buf->palette[(x % 2) ? (pair & 0x0F) : (pair >> 4)];
+            break;
+        }
+
+        default:
+            value = buf->buffer[y * buf->width + x];
+            if (buf->pixel_alpha) {
+                *alpha = value >> 24;
+                return value & 0xFFFFFF;
+            }
+            break;
+    }
+    *alpha = (value == TRANSPARENT) ? 0 : 255;
+    return value & 0xFFFFFF;
+}
+
+// Paint buffers back to front in real numbers, over black
+static void reference_compose(displayManager_buffer_t* const* order, uint32_t count, double* out)
+{
+    uint32_t rows = dm_ctx.rows;
+    uint32_t cols = dm_ctx.cols;
+    memset(out, 0, rows * cols * 3 * sizeof(double));
+    for (uint32_t i = 0; i < count; i++) {
+        const displayManager_buffer_t* buf = order[i];
+        if (!buf->active) {
+            continue;
+        }
+        for (uint32_t y = 0; y < buf->height; y++) {
+            for (uint32_t x = 0; x < buf->width; x++) {
+                uint32_t sx = buf->x + x;
+                uint32_t sy = buf->y + y;
+                if (sx >= cols || sy >= rows) {
+                    continue;
+                }
+                uint32_t alpha;
+                uint32_t rgb = reference_pixel(buf, x, y, &alpha);
+                double a = (alpha / 255.0) * (buf->opacity / 255.0);
+                double* px = &out[(sy * cols + sx) * 3];
+                for (int c = 0; c < 3; c++) {
+                    px[c] = px[c] * (1.0 - a) + ((rgb >> (16 - 8 * c)) & 0xFF) * a;
+                }
+            }
+        }
+    }
+}
+
+// Largest channel difference between the composed frame and the reference
+static uint32_t compose_error(const double* reference)
+{
+    double worst = 0;
+    for (uint32_t i = 0; i < dm_ctx.num_pixels; i++) {
+        for (int c = 0; c < 3; c++) {
+            double got = (dm_ctx.output_buffer[i] >> (16 - 8 * c)) & 0xFF;
+            double diff = fabs(got - reference[i * 3 + c]);
+            worst = (diff > worst) ? diff : worst;
+        }
+    }
+    return (uint32_t)(worst + 0.5);
+}
+
+// Recompose the whole screen
+static void compose_all(void)
+{
+    dm_ctx.full_redraw = true;
+    TEST_ASSERT_TRUE(display_manager_renderFrame());
+}
+
+static void fill_random(displayManager_buffer_t* buf, uint32_t transparent_percent)
+{
+    for (uint32_t y = 0; y < buf->height; y++) {
+        for (uint32_t x = 0; x < buf->width; x++) {
+            uint32_t color = random_rgb();
+            if (buf->pixel_alpha) {
+                color |= (uint32_t)(rand() & 0xFF) << 24;
+            } else if ((uint32_t)(rand() % 100) < transparent_percent) {
+                color = TRANSPARENT;
+            }
+            display_manager_setBufferPixel(buf, x, y, color);
+        }
+    }
+}
+
+static double reference[16 * 32 * 3];
+
+// Opaque pixels replace what is below them exactly, transparent ones leave it
+static void test_opaque_pixels_are_exact(void)
+{
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    displayManager_buffer_t* stack[3];
+    stack[0] = display_manager_create_buffer("back", 32, 16, 0, 0, DISPLAY_MANAGER_LAYER_BACKGROUND);
+    stack[1] = display_manager_create_buffer("mid", 20, 10, 5, 3, DISPLAY_MANAGER_LAYER_FOREGROUND);
+    stack[2] = display_manager_create_buffer("front", 32, 4, 3, 14, DISPLAY_MANAGER_LAYER_SYSTEM);
+    for (int i = 0; i < 3; i++) {
+        fill_random(stack[i], 40);
+    }
+    compose_all();
+    reference_compose(stack, 3, reference);
+    TEST_ASSERT_EQUAL_UINT32(0, compose_error(reference));
+}
+
+static void test_opacity_zero_hides_buffer(void)
+{
+    host_display_start(8, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    displayManager_buffer_t* back = display_manager_create_buffer("back", 32, 8, 0, 0, DISPLAY_MANAGER_LAYER_BACKGROUND);
+    displayManager_buffer_t* front = display_manager_create_buffer("front", 32, 8, 0, 0, DISPLAY_MANGER_LAYER_POPUP);
+    fill_random(back, 0);
+    fill_random(front, 0);
+    display_manager_setBufferOpacity(front, 0);
+    compose_all();
+    reference_compose(&back, 1, reference);
+    TEST_ASSERT_EQUAL_UINT32(0, compose_error(reference));
+}
+
+// Random stacks of buffer opacity and pixel alpha against the real-valued blend
+static void test_blend_matches_reference(void)
+{
+    uint32_t worst[5] = { 0 };
+    for (int trial = 0; trial < 300; trial++) {
+        uint32_t rows = (trial % 2) ? 16 : 8;
+        host_display_start(rows, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+        displayManager_buffer_t* stack[4];
+        uint32_t count = 2 + rand() % 3;
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t w = 1 + rand() % 32;
+            uint32_t h = 1 + rand() % rows;
+            stack[i] = display_manager_create_buffer("layer", w, h, rand() % (33 - w), rand() % (rows + 1 - h), i);
+            display_manager_setBufferPixelAlpha(stack[i], rand() % 2);
+            fill_random(stack[i], 30);
+            display_manager_setBufferOpacity(stack[i], (rand() % 3) ? rand() & 0xFF : 255);
+        }
+        compose_all();
+        reference_compose(stack, count, reference);
+        // Each layer's weight and contribution round down once
+        uint32_t error = compose_error(reference);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * count, error);
+        worst[count] = (error > worst[count]) ? error : worst[count];
+        host_display_stop();
+    }
+    char message[96];
+    snprintf(message, sizeof(message), "largest error per channel: 2 layers %lu, 3 layers %lu, 4 layers %lu",
+             (unsigned long)worst[2], (unsigned long)worst[3], (unsigned long)worst[4]);
+    TEST_MESSAGE(message);
+}
+
+// A fade only recomposes the area the fading buffer covers
+static void test_opacity_change_recomposes_buffer_area(void)
+{
+    host_display_start(8, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    display_manager_create_buffer("clock", 32, 8, 0, 0, DISPLAY_MANAGER_LAYER_BACKGROUND);
+    displayManager_buffer_t* popup = display_manager_create_buffer("popup", 10, 4, 6, 2, DISPLAY_MANGER_LAYER_POPUP);
+    compose_all();
+    TEST_ASSERT_FALSE(display_manager_renderFrame());
+
+    display_manager_setBufferOpacity(popup, 128);
+    display_manager_rect_t rect;
+    TEST_ASSERT_TRUE(collect_dirty(&rect));
+    TEST_ASSERT_EQUAL_INT32(6, rect.x0);
+    TEST_ASSERT_EQUAL_INT32(2, rect.y0);
+    TEST_ASSERT_EQUAL_INT32(15, rect.x1);
+    TEST_ASSERT_EQUAL_INT32(5, rect.y1);
+}
+
+// The same blend a channel at a time in float, as a baseline
+static void blend_float(const uint32_t* back, const uint32_t* front, uint32_t* out, uint32_t pixels, float a)
+{
+    for (uint32_t i = 0; i < pixels; i++) {
+        uint32_t color = 0;
+        for (int shift = 0; shift <= 16; shift += 8) {
+            float b = (back[i] >> shift) & 0xFF;
+            float f = (front[i] >> shift) & 0xFF;
+            color |= (uint32_t)(b + (f - b) * a) << shift;
+        }
+        out[i] = color;
+    }
+}
+
+// Microseconds per full-screen merge_buffers of the buffers on screen
+static double time_compose(void)
+{
+    compose_all();
+    display_manager_rect_t screen = { 0, 0, dm_ctx.cols - 1, dm_ctx.rows - 1 };
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 2000; i++) {
+            merge_buffers(&screen);
+            __asm__ volatile("" ::: "memory");
+        }
+        double us = (esp_timer_get_time() - start) / 2000.0;
+        best = (us < best) ? us : best;
+    }
+    return best;
+}
+
+// A clock with a half-transparent popup over it, full screen
+static void test_benchmark_blend(void)
+{
+    char message[200];
+    for (uint32_t rows = 8; rows <= 16; rows += 8) {
+        host_display_start(rows, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+        displayManager_buffer_t* clock = display_manager_create_buffer("clock", 32, rows, 0, 0,
+                                                                      DISPLAY_MANAGER_LAYER_BACKGROUND);
+        displayManager_buffer_t* popup = display_manager_create_buffer("popup", 32, rows, 0, 0,
+                                                                      DISPLAY_MANGER_LAYER_POPUP);
+        fill_random(clock, 0);
+        fill_random(popup, 0);
+        double copy = time_compose();
+        display_manager_setBufferOpacity(popup, 128);
+        double blend = time_compose();
+        display_manager_setBufferPixelAlpha(popup, true);
+        fill_random(popup, 0);
+        double alpha = time_compose();
+
+        uint32_t pixels = rows * 32;
+        double best = 1e30;
+        for (int run = 0; run < 5; run++) {
+            int64_t start = esp_timer_get_time();
+            for (int i = 0; i < 2000; i++) {
+                blend_float(clock->buffer, popup->buffer, dm_ctx.physical_buffer, pixels, 0.5f);
+                __asm__ volatile("" ::: "memory");
+            }
+            double us = (esp_timer_get_time() - start) / 2000.0;
+            best = (us < best) ? us : best;
+        }
+        snprintf(message, sizeof(message),
+                 "%lux32 frame: opaque %.2f us, 50%% opacity %.2f us, pixel alpha %.2f us, float blend alone %.2f us",
+                 (unsigned long)rows, copy, blend, alpha, best);
+        TEST_MESSAGE(message);
+        host_display_stop();
+    }
+}
+
+// Every colour survives RGB565 within its 5 bits, and stored values convert back unchanged
+static void test_rgb565_round_trip(void)
+{
+    uint32_t worst = 0;
+    for (uint32_t color = 0; color <= 0xFFFFFF; color++) {
+        uint16_t stored = display_manager_toRgb565(color);
+        TEST_ASSERT_TRUE(stored & 0x0020);
+        uint32_t back = display_manager_fromRgb565(stored);
+        for (int shift = 0; shift <= 16; shift += 8) {
+            uint32_t diff = abs((int32_t)((color >> shift) & 0xFF) - (int32_t)((back >> shift) & 0xFF));
+            worst = (diff > worst) ? diff : worst;
+        }
+        TEST_ASSERT_EQUAL_HEX16(stored, display_manager_toRgb565(back));
+    }
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(7, worst);
+    TEST_ASSERT_EQUAL_HEX32(0x000000, display_manager_fromRgb565(display_manager_toRgb565(0x000000)));
+    TEST_ASSERT_EQUAL_HEX32(0xFFFFFF, display_manager_fromRgb565(display_manager_toRgb565(0xFFFFFF)));
+    TEST_ASSERT_EQUAL_HEX16(0, display_manager_toRgb565(TRANSPARENT));
+    TEST_ASSERT_EQUAL_HEX32(TRANSPARENT, display_manager_fromRgb565(0));
+}
+
+static void test_compact_buffer_sizes(void)
+{
+    host_display_start(8, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    const size_t expected[] = {
+        [DISPLAY_FORMAT_RGB888] = 32 * 8 * 4,
+        [DISPLAY_FORMAT_RGB565] = 32 * 8 * 2,
+        [DISPLAY_FORMAT_INDEXED8] = 32 * 8 + 256 * 4,
+        [DISPLAY_FORMAT_INDEXED4] = 32 * 8 / 2 + 16 * 4,
+    };
+    for (int format = DISPLAY_FORMAT_RGB888; format <= DISPLAY_FORMAT_INDEXED4; format++) {
+        displayManager_buffer_t* buf = display_manager_create_buffer_ex("test", 32, 8, 0, 0,
+                                                                       DISPLAY_MANAGER_LAYER_BACKGROUND, format);
+        TEST_ASSERT_NOT_NULL(buf);
+        TEST_ASSERT_EQUAL_UINT32(expected[format], buf->storage_size);
+        // Every format starts out transparent
+        for (uint32_t y = 0; y < 8; y++) {
+            for (uint32_t x = 0; x < 32; x++) {
+                uint32_t alpha;
+                reference_pixel(buf, x, y, &alpha);
+                TEST_ASSERT_EQUAL_UINT32(0, alpha);
+            }
+        }
+    }
+}
+
+// Colours are added to the palette as they appear, then the closest one is used
+static void test_palette_grows_then_picks_closest(void)
+{
+    host_display_start(8, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    displayManager_buffer_t* buf = display_manager_create_buffer_ex("test", 5, 4, 0, 0,
+                                                                   DISPLAY_MANAGER_LAYER_BACKGROUND,
+                                                                   DISPLAY_FORMAT_INDEXED4);
+    uint32_t alpha;
+    for (uint32_t i = 1; i < 16; i++) {
+        display_manager_setBufferPixel(buf, i % 5, i / 5, i * 0x101010);
+        TEST_ASSERT_EQUAL_UINT32(i + 1, buf->palette_used);
+        TEST_ASSERT_EQUAL_HEX32(i * 0x101010, buf->palette[i]);
+        TEST_ASSERT_EQUAL_HEX32(i * 0x101010, reference_pixel(buf, i % 5, i / 5, &alpha));
+    }
+    display_manager_setBufferPixel(buf, 0, 0, 0x121314);
+    TEST_ASSERT_EQUAL_UINT32(16, buf->palette_used);
+    TEST_ASSERT_EQUAL_HEX32(0x101010, reference_pixel(buf, 0, 0, &alpha));
+    display_manager_setBufferPixel(buf, 0, 0, 0xF0F0FF);
+    TEST_ASSERT_EQUAL_HEX32(0xF0F0F0, reference_pixel(buf, 0, 0, &alpha));
+
+    uint32_t colors[] = { 0xFF0000, 0x00FF00 };
+    TEST_ASSERT_EQUAL(ESP_OK, display_manager_setBufferPalette(buf, colors, 2));
+    TEST_ASSERT_EQUAL_UINT32(3, buf->palette_used);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, display_manager_setBufferPalette(buf, colors, 16));
+}
+
+static const uint32_t test_colors[] = {
+    0xFF0000, 0x00FF00, 0x0000FF, 0xFFFFFF, 0x123456, 0x808080, 0x010203, 0xFEDCBA,
+    0x00FFFF, 0x7F7F00, 0x000001, 0xA5A5A5, TRANSPARENT,
+};
+#define NUM_TEST_COLORS (sizeof(test_colors) / sizeof(test_colors[0]))
+
+// A colour as the format stores it, read back as RGB888
+static uint32_t stored_color(displayManager_format_E format, uint32_t color)
+{
+    if (format == DISPLAY_FORMAT_RGB565) {
+        return display_manager_fromRgb565(display_manager_toRgb565(color));
+    }
+    return color;
+}
+
+static void assert_matches_shadow(const displayManager_buffer_t* buf, const uint32_t* shadow)
+{
+    for (uint32_t y = 0; y < buf->height; y++) {
+        for (uint32_t x = 0; x < buf->width; x++) {
+            uint32_t alpha;
+            uint32_t color = reference_pixel(buf, x, y, &alpha);
+            TEST_ASSERT_EQUAL_HEX32(shadow[y * buf->width + x], alpha ? color : TRANSPARENT);
+        }
+    }
+}
+
+// Random pixel writes and fills on odd-sized buffers of every format read back as written
+static void test_writes_read_back(void)
+{
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    static uint32_t shadow[7 * 5];
+    for (int format = DISPLAY_FORMAT_RGB888; format <= DISPLAY_FORMAT_INDEXED4; format++) {
+        displayManager_buffer_t* buf = display_manager_create_buffer_ex("test", 7, 5, 0, 0,
+                                                                       DISPLAY_MANAGER_LAYER_BACKGROUND, format);
+        for (uint32_t i = 0; i < 7 * 5; i++) {
+            shadow[i] = TRANSPARENT;
+        }
+        for (int op = 0; op < 2000; op++) {
+            uint32_t color = test_colors[rand() % NUM_TEST_COLORS];
+            uint32_t x = rand() % 7;
+            uint32_t y = rand() % 5;
+            if (rand() % 2) {
+                display_manager_setBufferPixel(buf, x, y, color);
+                shadow[y * 7 + x] = stored_color(format, color);
+            } else {
+                uint32_t w = rand() % 9;
+                uint32_t h = rand() % 7;
+                display_manager_fillBufferRect(buf, x, y, w, h, color);
+                for (uint32_t yy = y; yy < MIN(y + h, 5); yy++) {
+                    for (uint32_t xx = x; xx < MIN(x + w, 7); xx++) {
+                        shadow[yy * 7 + xx] = stored_color(format, color);
+                    }
+                }
+            }
+            assert_matches_shadow(buf, shadow);
+        }
+        display_manager_free_buffer(buf);
+    }
+}
+
+// Copies convert between any two formats
+static void test_copy_converts_formats(void)
+{
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    static uint32_t shadow[9 * 6];
+    for (int from = DISPLAY_FORMAT_RGB888; from <= DISPLAY_FORMAT_INDEXED4; from++) {
+        for (int to = DISPLAY_FORMAT_RGB888; to <= DISPLAY_FORMAT_INDEXED4; to++) {
+            displayManager_buffer_t* src = display_manager_create_buffer_ex("src", 9, 6, 0, 0,
+                                                                           DISPLAY_MANAGER_LAYER_BACKGROUND, from);
+            displayManager_buffer_t* dst = display_manager_create_buffer_ex("dst", 9, 6, 0, 0,
+                                                                           DISPLAY_MANAGER_LAYER_BACKGROUND, to);
+            for (uint32_t i = 0; i < 9 * 6; i++) {
+                uint32_t color = test_colors[rand() % NUM_TEST_COLORS];
+                display_manager_setBufferPixel(src, i % 9, i / 9, color);
+                shadow[i] = TRANSPARENT;
+            }
+            display_manager_copyBufferRect(dst, 3, 1, src, 1, 2, 7, 3);
+            for (uint32_t y = 0; y < 3; y++) {
+                for (uint32_t x = 0; x < 6; x++) {
+                    uint32_t alpha;
+                    uint32_t color = reference_pixel(src, 1 + x, 2 + y, &alpha);
+                    shadow[(1 + y) * 9 + 3 + x] = stored_color(to, alpha ? color : TRANSPARENT);
+                }
+            }
+            assert_matches_shadow(dst, shadow);
+            display_manager_free_buffer(src);
+            display_manager_free_buffer(dst);
+            host_display_stop();
+            host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+        }
+    }
+}
+
+// The compositor expands every format to what the format holds, transparency included
+static void test_compact_formats_compose_exactly(void)
+{
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    displayManager_buffer_t* stack[5];
+    stack[0] = display_manager_create_buffer("back", 32, 16, 0, 0, DISPLAY_MANAGER_LAYER_BACKGROUND);
+    fill_random(stack[0], 0);
+    for (int format = DISPLAY_FORMAT_RGB888; format <= DISPLAY_FORMAT_INDEXED4; format++) {
+        displayManager_buffer_t* buf = display_manager_create_buffer_ex("layer", 13, 9, 5 * format, 2 * format,
+                                                                       DISPLAY_MANAGER_LAYER_FOREGROUND, format);
+        display_manager_setBufferOrder(buf, DISPLAY_MANAGER_LAYER_FOREGROUND, format);
+        for (uint32_t y = 0; y < 9; y++) {
+            for (uint32_t x = 0; x < 13; x++) {
+                display_manager_setBufferPixel(buf, x, y, test_colors[rand() % NUM_TEST_COLORS]);
+            }
+        }
+        stack[1 + format] = buf;
+    }
+    compose_all();
+    reference_compose(stack, 5, reference);
+    TEST_ASSERT_EQUAL_UINT32(0, compose_error(reference));
+}
+
+// What expanding a compact full-screen buffer costs the compositor
+static void test_benchmark_formats(void)
+{
+    static const char* names[] = { "RGB888", "RGB565", "INDEXED8", "INDEXED4" };
+    char message[200];
+    int length = 0;
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    for (int format = DISPLAY_FORMAT_RGB888; format <= DISPLAY_FORMAT_INDEXED4; format++) {
+        displayManager_buffer_t* buf = display_manager_create_buffer_ex("test", 32, 16, 0, 0,
+                                                                       DISPLAY_MANAGER_LAYER_SYSTEM, format);
+        for (uint32_t i = 0; i < 32 * 16; i++) {
+            display_manager_setBufferPixel(buf, i % 32, i / 32, test_colors[i % (NUM_TEST_COLORS - 1)]);
+        }
+        length += snprintf(message + length, sizeof(message) - length, "%s%s %.2f us (%u bytes)",
+                           length ? ", " : "16x32 frame: ", names[format], time_compose(),
+                           (unsigned)buf->storage_size);
+        display_manager_free_buffer(buf);
+        display_manager_renderFrame(); // Reclaims it
+    }
+    TEST_MESSAGE(message);
+}
+
+// Expected stacking, kept the way the compositor documents it: by layer, then
+// order, later buffers in front on ties
+static displayManager_buffer_t* model[MAX_DISPLAY_BUFFERS];
+static uint32_t model_count;
+
+static void model_insert(displayManager_buffer_t* buf)
+{
+    uint32_t i = model_count;
+    while (i > 0 && (model[i - 1]->layer > buf->layer ||
+                     (model[i - 1]->layer == buf->layer && model[i - 1]->order > buf->order))) {
+        i--;
+    }
+    memmove(&model[i + 1], &model[i], (model_count - i) * sizeof(model[0]));
+    model[i] = buf;
+    model_count++;
+}
+
+static void model_remove(displayManager_buffer_t* buf)
+{
+    for (uint32_t i = 0; i < model_count; i++) {
+        if (model[i] == buf) {
+            memmove(&model[i], &model[i + 1], (model_count - i - 1) * sizeof(model[0]));
+            model_count--;
+            return;
+        }
+    }
+}
+
+// Buffers created, restacked, hidden and freed at random compose like a painter
+// going back to front through the expected stacking
+static void test_stacking_order_is_kept(void)
+{
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    model_count = 0;
+    for (int op = 0; op < 3000; op++) {
+        int action = rand() % 4;
+        // Freed descriptors come back at the next frame
+        if (action == 0 && dm_ctx.num_free_descriptors > 0) {
+            uint32_t w = 1 + rand() % 32;
+            uint32_t h = 1 + rand() % 16;
+            displayManager_buffer_t* buf = display_manager_create_buffer_ex("test", w, h, rand() % 32, rand() % 16,
+                                                                           rand() % 4, rand() % 4);
+            TEST_ASSERT_NOT_NULL(buf);
+            fill_random(buf, 50);
+            model_insert(buf);
+        } else if (action == 1 && model_count > 0) {
+            displayManager_buffer_t* buf = model[rand() % model_count];
+            displayManager_layer_E layer = rand() % 4;
+            uint8_t order = rand() % 3;
+            // Setting the same place again leaves the buffer where it is
+            bool moved = (layer != buf->layer || order != buf->order);
+            display_manager_setBufferOrder(buf, layer, order);
+            if (moved) {
+                model_remove(buf);
+                model_insert(buf);
+            }
+        } else if (action == 2 && model_count > 0) {
+            displayManager_buffer_t* buf = model[rand() % model_count];
+            display_manager_setBufferActive(buf, !buf->active);
+        } else if (model_count > 0) {
+            displayManager_buffer_t* buf = model[rand() % model_count];
+            model_remove(buf);
+            display_manager_free_buffer(buf);
+        }
+
+        TEST_ASSERT_EQUAL_UINT32(model_count, dm_ctx.num_buffers);
+        TEST_ASSERT_EQUAL_PTR_ARRAY(model, dm_ctx.buffers, model_count);
+        if (op % 10 == 0) {
+            compose_all();
+            reference_compose(model, model_count, reference);
+            TEST_ASSERT_EQUAL_UINT32(0, compose_error(reference));
+        }
+    }
+}
+
+// Rows an opaque buffer covers are finished once it is drawn, the rest still take layers below
+static void test_opaque_buffer_covers_rows(void)
+{
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    displayManager_buffer_t* stack[MAX_DISPLAY_BUFFERS];
+    for (uint32_t i = 0; i < MAX_DISPLAY_BUFFERS - 1; i++) {
+        stack[i] = display_manager_create_buffer("below", 32, 16, 0, 0, DISPLAY_MANAGER_LAYER_FOREGROUND);
+        fill_random(stack[i], 80);
+    }
+    stack[MAX_DISPLAY_BUFFERS - 1] = display_manager_create_buffer("system", 32, 10, 0, 0,
+                                                                   DISPLAY_MANAGER_LAYER_SYSTEM);
+    fill_random(stack[MAX_DISPLAY_BUFFERS - 1], 0);
+    compose_all();
+    for (uint32_t y = 0; y < 16; y++) {
+        if (y < 10) {
+            TEST_ASSERT_EQUAL_UINT16(0, dm_ctx.row_remaining[y]);
+        }
+        for (uint32_t x = 0; x < 32; x++) {
+            TEST_ASSERT_EQUAL_UINT16((y < 10) ? 0 : dm_ctx.coverage[y * 32 + x], dm_ctx.coverage[y * 32 + x]);
+        }
+    }
+    reference_compose(stack, MAX_DISPLAY_BUFFERS, reference);
+    TEST_ASSERT_EQUAL_UINT32(0, compose_error(reference));
+}
+
+// The compositor before the sorted list: every layer rescans every buffer and
+// paints all of its pixels, back to front
+static void baseline_merge(uint32_t* output)
+{
+    memset(output, 0, dm_ctx.num_pixels * sizeof(uint32_t));
+    for (displayManager_layer_E layer = DISPLAY_MANAGER_LAYER_BACKGROUND;
+         layer <= DISPLAY_MANAGER_LAYER_SYSTEM;
+         layer++) {
+        for (uint32_t i = 0; i < dm_ctx.num_buffers; i++) {
+            displayManager_buffer_t* buf = dm_ctx.buffers[i];
+            if (!buf->active || buf->layer != layer) {
+                continue;
+            }
+            for (uint32_t y = 0; y < buf->height; y++) {
+                for (uint32_t x = 0; x < buf->width; x++) {
+                    uint32_t display_x = buf->x + x;
+                    uint32_t display_y = buf->y + y;
+                    if (display_x >= dm_ctx.cols || display_y >= dm_ctx.rows) {
+                        continue;
+                    }
+                    uint32_t color = buf->buffer[y * buf->width + x];
+                    if (color != TRANSPARENT) {
+                        output[display_y * dm_ctx.cols + display_x] = color;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static double time_baseline_merge(void)
+{
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 2000; i++) {
+            baseline_merge(dm_ctx.physical_buffer);
+            __asm__ volatile("" ::: "memory");
+        }
+        double us = (esp_timer_get_time() - start) / 2000.0;
+        best = (us < best) ? us : best;
+    }
+    return best;
+}
+
+// MAX_DISPLAY_BUFFERS full-screen buffers, one per layer and order
+static void test_benchmark_stack(void)
+{
+    char message[200];
+    for (uint32_t rows = 8; rows <= 16; rows += 8) {
+        host_display_start(rows, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+        displayManager_buffer_t* stack[MAX_DISPLAY_BUFFERS];
+        for (uint32_t i = 0; i < MAX_DISPLAY_BUFFERS; i++) {
+            stack[i] = display_manager_create_buffer("stack", 32, rows, 0, 0, i / 2);
+            fill_random(stack[i], 0);
+        }
+        double opaqueOld = time_baseline_merge();
+        double opaqueNew = time_compose();
+        for (uint32_t i = 0; i < MAX_DISPLAY_BUFFERS; i++) {
+            fill_random(stack[i], 67);
+        }
+        double sparseOld = time_baseline_merge();
+        double sparseNew = time_compose();
+        for (uint32_t i = 0; i < MAX_DISPLAY_BUFFERS; i++) {
+            fill_random(stack[i], 0);
+            display_manager_setBufferOpacity(stack[i], 128);
+        }
+        double blendNew = time_compose();
+        snprintf(message, sizeof(message),
+                 "%lux32, %d buffers (old -> new): opaque %.2f -> %.2f us, 1/3 set %.2f -> %.2f us, "
+                 "all at 50%% opacity %.2f us",
+                 (unsigned long)rows, MAX_DISPLAY_BUFFERS, opaqueOld, opaqueNew, sparseOld, sparseNew, blendNew);
+        TEST_MESSAGE(message);
+        host_display_stop();
+    }
+}
+
+// The app draws into canvas[draw] through buffer, the compositor reads canvas[front]
+// and the third waits in ready. No two of them may be the same canvas
+static void assert_canvases_apart(const displayManager_buffer_t* buf)
+{
+    uint32_t ready = __atomic_load_n(&buf->ready, __ATOMIC_ACQUIRE) & ~DISPLAY_CANVAS_FRESH;
+    TEST_ASSERT_NOT_EQUAL(buf->front, buf->draw);
+    TEST_ASSERT_NOT_EQUAL(ready, buf->draw);
+    TEST_ASSERT_NOT_EQUAL(ready, buf->front);
+    TEST_ASSERT_EQUAL_PTR(buf->canvas[buf->draw], buf->buffer8);
+}
+
+// Draws, presents with and without the copy, and compositor pickups interleaved, with
+// up to three presents per frame and pixels left drawn but not presented when the frame
+// is taken. A model of each canvas follows the app's writes. The LEDs only ever show
+// the last presented picture. After a present drawing carries on from it, after
+// presentDiscard from whatever the canvas handed back last held
+static void test_flip_shows_only_presented_canvases(void)
+{
+    static uint32_t canvases[DISPLAY_CANVAS_COUNT][DISPLAY_MANAGER_MAX_PIXELS];
+    static uint32_t presented[DISPLAY_MANAGER_MAX_PIXELS];
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    const uint32_t pixels = dm_ctx.num_pixels;
+    displayManager_buffer_t* buf = display_manager_create_buffer("flip", dm_ctx.cols, dm_ctx.rows,
+                                                                 0, 0, DISPLAY_MANAGER_LAYER_BACKGROUND);
+    for (uint32_t i = 0; i < pixels; i++) {
+        presented[i] = rand() & 0xFFFFFF;
+        display_manager_setBufferPixel(buf, i % dm_ctx.cols, i / dm_ctx.cols, presented[i]);
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, display_manager_enableDoubleBuffer(buf));
+    for (uint32_t c = 0; c < DISPLAY_CANVAS_COUNT; c++) {
+        memcpy(canvases[c], presented, sizeof(presented));
+    }
+    assert_canvases_apart(buf);
+    TEST_ASSERT_TRUE(display_manager_renderFrame());
+
+    uint32_t discards = 0;
+    for (uint32_t frame = 0; frame < 3000; frame++) {
+        uint32_t presents = rand() % 4;
+        for (uint32_t p = 0; p <= presents; p++) {
+            uint32_t* drawn = canvases[buf->draw];
+            for (uint32_t n = rand() % 6; n > 0; n--) {
+                uint32_t i = rand() % pixels;
+                drawn[i] = rand() & 0xFFFFFF;
+                display_manager_setBufferPixel(buf, i % dm_ctx.cols, i / dm_ctx.cols, drawn[i]);
+            }
+            TEST_ASSERT_EQUAL_HEX32_ARRAY(drawn, buf->buffer, pixels);
+            if (p < presents) {
+                uint32_t was = buf->draw;
+                memcpy(presented, drawn, sizeof(presented));
+                if (rand() % 2) {
+                    display_manager_presentDiscard(buf);
+                    discards++;
+                } else {
+                    display_manager_present(buf);
+                    memcpy(canvases[buf->draw], presented, sizeof(presented));
+                }
+                assert_canvases_apart(buf);
+                TEST_ASSERT_NOT_EQUAL(was, buf->draw);
+                TEST_ASSERT_EQUAL_HEX32_ARRAY(canvases[buf->draw], buf->buffer, pixels);
+                TEST_ASSERT_EQUAL_HEX32_ARRAY(presented, (const uint32_t*)buf->canvas[was], pixels);
+            }
+        }
+
+        // Only a present makes the buffer dirty, drawing into the back canvas does not
+        TEST_ASSERT_EQUAL(presents > 0, display_manager_renderFrame());
+        assert_canvases_apart(buf);
+        TEST_ASSERT_EQUAL_HEX32_ARRAY(presented, (const uint32_t*)buf->canvas[buf->front], pixels);
+        for (uint32_t i = 0; i < pixels; i++) {
+            TEST_ASSERT_EQUAL_HEX32(presented[i], host_leds[dm_ctx.index_map[i]]);
+        }
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, discards);
+}
+
+// What a screen pixel of a full-screen view scrolled to (sx, sy) shows, drawn straight
+// from the canvas: wrapped around it, or black past its edges
+static uint32_t view_reference(const displayManager_buffer_t* buf, int32_t sx, int32_t sy,
+                               uint32_t x, uint32_t y)
+{
+    int32_t cx = (int32_t)x + sx;
+    int32_t cy = (int32_t)y + sy;
+    if (buf->wrap) {
+        cx = ((cx % (int32_t)buf->width) + (int32_t)buf->width) % (int32_t)buf->width;
+        cy = ((cy % (int32_t)buf->height) + (int32_t)buf->height) % (int32_t)buf->height;
+    } else if (cx < 0 || cy < 0 || cx >= (int32_t)buf->width || cy >= (int32_t)buf->height) {
+        return BLACK;
+    }
+    uint32_t color = buf->buffer[cy * buf->width + cx];
+    return (color == TRANSPARENT) ? BLACK : color;
+}
+
+static void assert_view(const displayManager_buffer_t* buf, int32_t sx, int32_t sy)
+{
+    for (uint32_t y = 0; y < dm_ctx.rows; y++) {
+        for (uint32_t x = 0; x < dm_ctx.cols; x++) {
+            TEST_ASSERT_EQUAL_HEX32(view_reference(buf, sx, sy, x, y),
+                                    host_leds[dm_ctx.index_map[y * dm_ctx.cols + x]]);
+        }
+    }
+}
+
+// Scroll a full-screen view to offsets on both sides of each canvas edge, then redraw
+// the canvas edges, which straddle the wrap seam for most of those offsets
+static void check_scrolled_views(uint32_t width, uint32_t height, bool wrap)
+{
+    host_display_start(8, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    displayManager_buffer_t* buf = display_manager_create_buffer("view", width, height, 0, 0,
+                                                                 DISPLAY_MANAGER_LAYER_BACKGROUND);
+    TEST_ASSERT_NOT_NULL(buf);
+    for (uint32_t i = 0; i < width * height; i++) {
+        display_manager_setBufferPixel(buf, i % width, i / width, rand() & 0xFFFFFF);
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, display_manager_setBufferView(buf, dm_ctx.cols, dm_ctx.rows, wrap));
+
+    const int32_t w = width, h = height, cols = dm_ctx.cols, rows = dm_ctx.rows;
+    const int32_t xs[] = { 0, 1, w - cols, w - cols + 1, w - 1, w, -1, 1 - cols, 3 * w + 5, -2 * w - 7 };
+    const int32_t ys[] = { 0, h - rows, h - rows + 1, h - 1, -1, 1 - rows, 5 * h + 2 };
+    for (uint32_t i = 0; i < sizeof(xs) / sizeof(xs[0]); i++) {
+        for (uint32_t j = 0; j < sizeof(ys) / sizeof(ys[0]); j++) {
+            display_manager_setBufferScroll(buf, xs[i], ys[j]);
+            display_manager_renderFrame();
+            assert_view(buf, xs[i], ys[j]);
+
+            for (uint32_t y = 0; y < height; y += height - 1) {
+                display_manager_setBufferPixel(buf, 0, y, rand() & 0xFFFFFF);
+                display_manager_setBufferPixel(buf, width / 2, y, rand() & 0xFFFFFF);
+                display_manager_setBufferPixel(buf, width - 1, y, rand() & 0xFFFFFF);
+            }
+            display_manager_setBufferPixel(buf, 0, height / 2, rand() & 0xFFFFFF);
+            display_manager_setBufferPixel(buf, width - 1, height / 2, rand() & 0xFFFFFF);
+            display_manager_renderFrame();
+            assert_view(buf, xs[i], ys[j]);
+        }
+    }
+    host_display_stop();
+}
+
+static void test_scrolled_views_match_direct_drawing(void)
+{
+    // Larger than the screen both ways, then tiled several times across it
+    check_scrolled_views(48, 12, true);
+    check_scrolled_views(48, 12, false);
+    check_scrolled_views(7, 3, true);
+    check_scrolled_views(7, 3, false);
+}
+
+// A canvas with no pixels has nothing to wrap around
+static void test_empty_canvas_is_rejected(void)
+{
+    host_display_start(8, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    TEST_ASSERT_NULL(display_manager_create_buffer("empty", 0, 8, 0, 0, DISPLAY_MANAGER_LAYER_FOREGROUND));
+    TEST_ASSERT_NULL(display_manager_create_buffer_ex("empty", 8, 0, 0, 0, DISPLAY_MANAGER_LAYER_FOREGROUND,
+                                                      DISPLAY_FORMAT_INDEXED4));
+    TEST_ASSERT_EQUAL_UINT32(0, dm_ctx.num_buffers);
+    displayManager_poolStats_t stats;
+    display_manager_getPoolStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.buffers_in_use);
+
+    displayManager_buffer_t* buf = display_manager_create_buffer("view", 8, 8, 0, 0,
+                                                                 DISPLAY_MANAGER_LAYER_FOREGROUND);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, display_manager_setBufferView(buf, 0, 8, true));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, display_manager_setBufferView(buf, 8, 0, true));
+}
+
+// The display task's loop against host time. After each pass it sleeps until the next
+// period while content changes, or on its notification while the screen is static
+#define HOST_PERIOD DISPLAY_MANAGER_PERIOD_TICKS
+
+static struct host_task host_display_task;
+static TickType_t host_task_due;
+static bool host_task_idle;
+static uint32_t host_task_passes;
+
+static bool host_task_pass(void)
+{
+    bool composed = display_manager_renderFrame();
+    TickType_t elapsed = display_manager_countFrames(host_ticks, HOST_PERIOD, composed);
+    host_task_idle = !composed;
+    host_task_due = composed ? dm_ctx.last_tick + HOST_PERIOD
+                             : host_ticks + display_manager_idleTimeout(HOST_PERIOD, elapsed);
+    host_task_passes++;
+    return composed;
+}
+
+// Whether the task runs at the current host time: its sleep is over, or it idles and
+// was notified. Taking the notification clears it
+static bool host_task_wakes(void)
+{
+    if (host_task_idle && host_display_task.notifications > 0) {
+        host_display_task.notifications = 0;
+        return true;
+    }
+    return (int32_t)(host_ticks - host_task_due) >= 0;
+}
+
+static void host_task_start(void)
+{
+    host_display_start(8, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    host_display_task.notifications = 0;
+    dm_ctx.task = &host_display_task;
+    dm_ctx.last_tick = host_ticks;
+    host_task_passes = 0;
+    host_task_pass();
+}
+
+// Run the task for ticks of host time, checking the idle screen sends nothing
+static void host_task_idle_for(TickType_t ticks)
+{
+    for (TickType_t t = 0; t < ticks; t++) {
+        host_ticks++;
+        if (host_task_wakes()) {
+            TEST_ASSERT_FALSE(host_task_pass());
+        }
+    }
+}
+
+// Bursts of drawing between idle stretches. Every pass finds exactly one tick per
+// period elapsed, however long the task slept
+static void test_idle_ticks_follow_the_clock(void)
+{
+    host_task_start();
+    displayManager_buffer_t* buf = display_manager_create_buffer("app", 8, 8, 0, 0, DISPLAY_MANAGER_LAYER_FOREGROUND);
+    TickType_t start = dm_ctx.last_tick;
+    uint32_t burst = 0;
+    for (uint32_t t = 0; t < 100000; t++) {
+        host_ticks++;
+        if (burst > 0) {
+            display_manager_setBufferPixel(buf, rand() % 8, rand() % 8, rand() & 0xFFFFFF);
+            burst--;
+        } else if (rand() % 500 == 0) {
+            burst = 1 + rand() % 40;
+        }
+        if (host_task_wakes()) {
+            host_task_pass();
+            TEST_ASSERT_EQUAL_UINT32((host_ticks - start) / HOST_PERIOD, dm_ctx.frame_count);
+        }
+    }
+
+    uint32_t composed, skipped;
+    display_manager_getFrameCounts(&composed, &skipped);
+    TEST_ASSERT_EQUAL_UINT32(host_frames_submitted, composed);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(dm_ctx.frame_count, skipped);
+    char message[128];
+    snprintf(message, sizeof(message), "%lu periods: %lu passes, %lu frames sent",
+             (unsigned long)dm_ctx.frame_count, (unsigned long)host_task_passes, (unsigned long)composed);
+    TEST_MESSAGE(message);
+}
+
+// A change on a static screen wakes the task at once, and that pass sends it
+static void test_change_while_idle_recomposes_on_next_wake(void)
+{
+    host_task_start();
+    displayManager_buffer_t* buf = display_manager_create_buffer("app", 8, 8, 0, 0, DISPLAY_MANAGER_LAYER_FOREGROUND);
+    while (!host_task_wakes()) {
+        host_ticks++;
+    }
+    TEST_ASSERT_TRUE(host_task_pass());
+    for (uint32_t trial = 0; trial < 500; trial++) {
+        host_task_idle_for(4 * HOST_PERIOD + rand() % 200);
+        TEST_ASSERT_TRUE(host_task_idle);
+
+        uint32_t x = rand() % 8;
+        uint32_t y = rand() % 8;
+        uint32_t color = rand() & 0xFFFFFF;
+        buf->buffer[y * 8 + x] = color;
+        display_manager_markDirty(buf, x, y, 1, 1);
+        TEST_ASSERT_TRUE(host_task_wakes());
+        TEST_ASSERT_TRUE(host_task_pass());
+        TEST_ASSERT_EQUAL_HEX32(color, host_leds[dm_ctx.index_map[y * dm_ctx.cols + x]]);
+    }
+}
+
+// Apps start waiting at random points of idle stretches. Each is woken exactly at the
+// n-th tick after it started waiting, never before and never late
+static void test_waits_end_on_time_while_idle(void)
+{
+    static struct host_task apps[3];
+    TickType_t due[3];
+    host_task_start();
+    TickType_t start = dm_ctx.last_tick;
+    for (uint32_t trial = 0; trial < 2000; trial++) {
+        host_task_idle_for(rand() % 100);
+        uint32_t waiting = 1 + rand() % 3;
+        for (uint32_t i = 0; i < waiting; i++) {
+            uint32_t frames = 1 + rand() % 20;
+            apps[i].notifications = 0;
+            TEST_ASSERT_TRUE(display_manager_addWaiter(&apps[i], frames) >= 0);
+            display_manager_wake(); // As display_manager_waitFrames does
+            due[i] = start + ((host_ticks - start) / HOST_PERIOD + frames) * HOST_PERIOD;
+        }
+        for (uint32_t pending = waiting; pending > 0;) {
+            host_task_idle_for(1);
+            for (uint32_t i = 0; i < waiting; i++) {
+                if (apps[i].notifications > 0 && due[i] != 0) {
+                    TEST_ASSERT_EQUAL_UINT32(due[i], host_ticks);
+                    due[i] = 0;
+                    pending--;
+                } else if (due[i] != 0) {
+                    TEST_ASSERT_TRUE((int32_t)(due[i] - host_ticks) > 0);
+                }
+            }
+        }
+    }
+}
+
+// Pool bytes a live buffer holds: its storage and any extra canvases
+static void pool_usage(const displayManager_buffer_t* buf, uint32_t* pool, uint32_t* heap)
+{
+    const uint8_t* blocks[DISPLAY_CANVAS_COUNT] = { buf->storage };
+    size_t sizes[DISPLAY_CANVAS_COUNT] = { buf->storage_size };
+    uint32_t count = 1;
+    if (buf->double_buffered) {
+        for (uint32_t i = 1; i < DISPLAY_CANVAS_COUNT; i++) {
+            blocks[count] = buf->canvas[i];
+            sizes[count++] = buf->height * buf->stride;
+        }
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (display_manager_poolChunk(blocks[i]) >= 0) {
+            uint32_t order = 0;
+            while (display_manager_blockSize(order) < sizes[i]) {
+                order++;
+            }
+            *pool += display_manager_blockSize(order);
+        } else {
+            *heap += sizes[i];
+        }
+    }
+}
+
+static uint32_t pool_free_bytes(void)
+{
+    uint32_t bytes = 0;
+    for (uint32_t order = 0; order <= dm_ctx.max_order; order++) {
+        for (display_manager_freeBlock_t* block = dm_ctx.free_blocks[order]; block; block = block->next) {
+            bytes += display_manager_blockSize(order);
+        }
+    }
+    return bytes;
+}
+
+// Every byte a live buffer owns, canvases included, set to its tag
+static void tag_buffer(displayManager_buffer_t* buf, uint8_t tag)
+{
+    memset(buf->storage, tag, buf->storage_size);
+    if (buf->double_buffered) {
+        for (uint32_t i = 1; i < DISPLAY_CANVAS_COUNT; i++) {
+            memset(buf->canvas[i], tag, buf->height * buf->stride);
+        }
+    }
+}
+
+static void assert_tagged(const displayManager_buffer_t* buf, uint8_t tag)
+{
+    for (size_t i = 0; i < buf->storage_size; i++) {
+        TEST_ASSERT_EQUAL_HEX8(tag, buf->storage[i]);
+    }
+    if (buf->double_buffered) {
+        for (uint32_t c = 1; c < DISPLAY_CANVAS_COUNT; c++) {
+            for (size_t i = 0; i < buf->height * buf->stride; i++) {
+                TEST_ASSERT_EQUAL_HEX8(tag, buf->canvas[c][i]);
+            }
+        }
+    }
+}
+
+// Apps coming and going at random: blocks never overlap, the stats add up and
+// everything merges back into whole chunks at the end
+static void test_pool_churn(void)
+{
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    displayManager_buffer_t* live[MAX_DISPLAY_BUFFERS];
+    uint8_t tags[MAX_DISPLAY_BUFFERS];
+    uint32_t numLive = 0;
+    uint32_t heapUsed = 0;
+    for (int op = 0; op < 20000; op++) {
+        if (rand() % 2 && dm_ctx.num_free_descriptors > 0) {
+            // Mostly app-sized buffers, now and then one larger than a chunk
+            uint32_t widest = (rand() % 50) ? 32 : 64;
+            uint32_t w = 1 + rand() % widest;
+            uint32_t h = 1 + rand() % 16;
+            displayManager_buffer_t* buf = display_manager_create_buffer_ex("app", w, h, 0, 0,
+                                                                           DISPLAY_MANAGER_LAYER_FOREGROUND,
+                                                                           rand() % 4);
+            TEST_ASSERT_NOT_NULL(buf);
+            if (rand() % 4 == 0) {
+                TEST_ASSERT_EQUAL(ESP_OK, display_manager_enableDoubleBuffer(buf));
+            }
+            tags[numLive] = rand();
+            tag_buffer(buf, tags[numLive]);
+            live[numLive++] = buf;
+        } else if (numLive > 0) {
+            uint32_t i = rand() % numLive;
+            display_manager_free_buffer(live[i]);
+            live[i] = live[--numLive];
+            tags[i] = tags[numLive];
+        }
+        if (rand() % 3 == 0) {
+            display_manager_renderFrame(); // Reclaims what was freed
+        }
+
+        uint32_t pool = 0;
+        uint32_t heap = 0;
+        for (uint32_t i = 0; i < numLive; i++) {
+            assert_tagged(live[i], tags[i]);
+            pool_usage(live[i], &pool, &heap);
+        }
+        for (uint32_t i = 0; i < dm_ctx.num_pending_free; i++) {
+            pool_usage(dm_ctx.pending_free[i], &pool, &heap);
+        }
+        displayManager_poolStats_t stats;
+        display_manager_getPoolStats(&stats);
+        TEST_ASSERT_EQUAL_UINT32(numLive + dm_ctx.num_pending_free, stats.buffers_in_use);
+        TEST_ASSERT_EQUAL_UINT32(pool, stats.pool_bytes_in_use);
+        TEST_ASSERT_EQUAL_UINT32(heap, stats.heap_bytes);
+        TEST_ASSERT_EQUAL_UINT32(stats.chunks * stats.chunk_size, pool + pool_free_bytes());
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(stats.chunk_limit, stats.chunks);
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stats.buffers_in_use, stats.buffers_high_water);
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stats.pool_bytes_in_use, stats.pool_bytes_high_water);
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stats.heap_bytes, stats.heap_bytes_high_water);
+        heapUsed = MAX(heapUsed, stats.heap_bytes_high_water);
+    }
+
+    while (numLive > 0) {
+        display_manager_free_buffer(live[--numLive]);
+    }
+    display_manager_renderFrame();
+    displayManager_poolStats_t stats;
+    display_manager_getPoolStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.buffers_in_use);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.pool_bytes_in_use);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.heap_bytes);
+    uint32_t whole = 0;
+    for (display_manager_freeBlock_t* block = dm_ctx.free_blocks[dm_ctx.max_order]; block; block = block->next) {
+        whole++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(stats.chunks, whole);
+
+    char message[160];
+    snprintf(message, sizeof(message),
+             "20000 rounds: %lu chunks of %lu bytes, pool high water %lu bytes, heap high water %lu bytes",
+             (unsigned long)stats.chunks, (unsigned long)stats.chunk_size,
+             (unsigned long)stats.pool_bytes_high_water, (unsigned long)heapUsed);
+    TEST_MESSAGE(message);
+}
+
+// Descriptors run out at MAX_DISPLAY_BUFFERS and come back once the frame that
+// may still read a freed buffer is over
+static void test_descriptors_come_back_after_a_frame(void)
+{
+    host_display_start(8, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    displayManager_buffer_t* bufs[MAX_DISPLAY_BUFFERS];
+    for (uint32_t i = 0; i < MAX_DISPLAY_BUFFERS; i++) {
+        bufs[i] = display_manager_create_buffer("app", 8, 8, 0, 0, DISPLAY_MANAGER_LAYER_FOREGROUND);
+        TEST_ASSERT_NOT_NULL(bufs[i]);
+    }
+    TEST_ASSERT_NULL(display_manager_create_buffer("app", 8, 8, 0, 0, DISPLAY_MANAGER_LAYER_FOREGROUND));
+    display_manager_free_buffer(bufs[3]);
+    TEST_ASSERT_NULL(display_manager_create_buffer("app", 8, 8, 0, 0, DISPLAY_MANAGER_LAYER_FOREGROUND));
+    display_manager_renderFrame();
+    TEST_ASSERT_NOT_NULL(display_manager_create_buffer("app", 8, 8, 0, 0, DISPLAY_MANAGER_LAYER_FOREGROUND));
+
+    displayManager_poolStats_t stats;
+    display_manager_getPoolStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(MAX_DISPLAY_BUFFERS, stats.buffers_high_water);
+}
+
+// Nanoseconds per allocate and free of a mixed set of sizes
+static double time_alloc(bool pool)
+{
+    static const size_t sizes[] = { 64, 192, 320, 512, 1024, 1280, 2048, 100 };
+    void* blocks[8];
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 20000; i++) {
+            for (int b = 0; b < 8; b++) {
+                blocks[b] = pool ? display_manager_allocPixels(sizes[b]) : heap_caps_calloc(1, sizes[b], MALLOC_CAP_8BIT);
+            }
+            for (int b = 0; b < 8; b++) {
+                uint32_t k = (b * 5 + i) % 8; // Free in a shifting order
+                if (pool) {
+                    display_manager_freePixels(blocks[k], sizes[k]);
+                } else {
+                    free(blocks[k]);
+                }
+            }
+        }
+        double ns = (esp_timer_get_time() - start) * 1000.0 / (20000.0 * 8);
+        best = (ns < best) ? ns : best;
+    }
+    return best;
+}
+
+static void test_benchmark_pool(void)
+{
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+    double pool = time_alloc(true);
+    double heap = time_alloc(false);
+    displayManager_poolStats_t stats;
+    display_manager_getPoolStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.heap_bytes_high_water);
+    char message[128];
+    snprintf(message, sizeof(message), "alloc + free: pool %.1f ns, host malloc %.1f ns, %lu chunks",
+             pool, heap, (unsigned long)stats.chunks);
+    TEST_MESSAGE(message);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_default_map_matches_baseline);
+    RUN_TEST(test_every_map_is_a_snake);
+    RUN_TEST(test_maps_are_related_by_flips);
+    RUN_TEST(test_frame_reaches_mapped_leds);
+    RUN_TEST(test_oversized_geometry_is_rejected);
+    RUN_TEST(test_geometry_falls_back_when_memory_is_short);
+    RUN_TEST(test_dirty_frames_match_full_recompose);
+    RUN_TEST(test_benchmark_mapping);
+    RUN_TEST(test_opaque_pixels_are_exact);
+    RUN_TEST(test_opacity_zero_hides_buffer);
+    RUN_TEST(test_blend_matches_reference);
+    RUN_TEST(test_opacity_change_recomposes_buffer_area);
+    RUN_TEST(test_benchmark_blend);
+    RUN_TEST(test_rgb565_round_trip);
+    RUN_TEST(test_compact_buffer_sizes);
+    RUN_TEST(test_palette_grows_then_picks_closest);
+    RUN_TEST(test_writes_read_back);
+    RUN_TEST(test_copy_converts_formats);
+    RUN_TEST(test_compact_formats_compose_exactly);
+    RUN_TEST(test_benchmark_formats);
+    RUN_TEST(test_stacking_order_is_kept);
+    RUN_TEST(test_opaque_buffer_covers_rows);
+    RUN_TEST(test_benchmark_stack);
+    RUN_TEST(test_flip_shows_only_presented_canvases);
+    RUN_TEST(test_scrolled_views_match_direct_drawing);
+    RUN_TEST(test_empty_canvas_is_rejected);
+    RUN_TEST(test_idle_ticks_follow_the_clock);
+    RUN_TEST(test_change_while_idle_recomposes_on_next_wake);
+    RUN_TEST(test_waits_end_on_time_while_idle);
+    RUN_TEST(test_pool_churn);
+    RUN_TEST(test_descriptors_come_back_after_a_frame);
+    RUN_TEST(test_benchmark_pool);
+    return UNITY_END();
+}
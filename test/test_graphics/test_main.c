@@ -0,0 +1,860 @@
+// Host tests for the graphics primitives, against a reference plotter that sets one
+// pixel at a time. Run with: pio test -e native
+#include <unity.h>
+
+#include "display_manager.c"
+#undef TAG
+#include "utils/display_list.c"
+#undef TAG
+#include "utils/graphics.c"
+#undef TAG
+#include "utils/fonts.c"
+#include "5x3.c"
+
+#include "display_host.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Odd sizes, so INDEXED4 rows end on half a byte
+#define TEST_WIDTH 23
+#define TEST_HEIGHT 13
+#define NUM_FORMATS 4
+
+static const uint32_t palette[] = {
+    0xFF0000, 0x00FF00, 0x0000FF, 0xFFFFFF, 0x102030, 0x808000,
+    0x008080, 0x800080, 0x123456, 0xFEDCBA, 0x0F0F0F, 0xF0F0F0,
+};
+
+#define PALETTE_SIZE (sizeof(palette) / sizeof(palette[0]))
+
+void setUp(void)
+{
+    srand(1);
+    host_display_start(16, 32, GENEALOGY_UNSET, GENEALOGY_UNSET);
+}
+
+void tearDown(void)
+{
+    host_display_stop();
+}
+
+// Indexed buffers get the same palette, so the colours drawn are always in it
+static displayManager_buffer_t* make_buffer(const char* name, uint32_t width, uint32_t height,
+                                            displayManager_format_E format)
+{
+    displayManager_buffer_t* buf = display_manager_create_buffer_ex(name, width, height, 0, 0,
+                                                                    DISPLAY_MANAGER_LAYER_BACKGROUND, format);
+    TEST_ASSERT_NOT_NULL(buf);
+    if (buf->palette) {
+        TEST_ASSERT_EQUAL(ESP_OK, display_manager_setBufferPalette(buf, palette, PALETTE_SIZE));
+    }
+    return buf;
+}
+
+static void free_buffer(displayManager_buffer_t* buf)
+{
+    display_manager_free_buffer(buf);
+    display_manager_renderFrame(); // Reclaims it
+}
+
+static uint32_t random_color(displayManager_format_E format)
+{
+    if (format == DISPLAY_FORMAT_INDEXED8 || format == DISPLAY_FORMAT_INDEXED4) {
+        return palette[rand() % PALETTE_SIZE];
+    }
+    return (uint32_t)rand() & 0xFFFFFF;
+}
+
+// Mostly around the buffer, sometimes far off it either way
+static int32_t random_coord(int32_t size)
+{
+    switch (rand() % 16) {
+        case 0:
+            return rand() % 200000 - 100000;
+        case 1:
+            return (rand() % 2) ? INT32_MAX - rand() % 4 : INT32_MIN + rand() % 4;
+        default:
+            return rand() % (3 * size) - size;
+    }
+}
+
+// Every pixel of a buffer as RGB888
+static void read_pixels(const displayManager_buffer_t* buf, uint32_t* out)
+{
+    for (uint32_t y = 0; y < buf->height; y++) {
+        const uint32_t* row = display_manager_expandRow(buf, buf->buffer8, 0, y, buf->width, &out[y * buf->width]);
+        memmove(&out[y * buf->width], row, buf->width * sizeof(uint32_t));
+    }
+}
+
+// The reference plotter: one pixel at a time through display_manager_setBufferPixel,
+// skipping anything off the buffer
+static void plot(displayManager_buffer_t* buf, int64_t x, int64_t y, uint32_t color)
+{
+    if (x >= 0 && y >= 0 && x < buf->width && y < buf->height) {
+        display_manager_setBufferPixel(buf, x, y, color);
+    }
+}
+
+// The same random pixels in both buffers, then neither dirty
+static void fill_background(displayManager_buffer_t* got, displayManager_buffer_t* want)
+{
+    for (uint32_t y = 0; y < got->height; y++) {
+        for (uint32_t x = 0; x < got->width; x++) {
+            uint32_t color = random_color(got->format);
+            display_manager_setBufferPixel(got, x, y, color);
+            display_manager_setBufferPixel(want, x, y, color);
+        }
+    }
+    got->dirty = false;
+    want->dirty = false;
+}
+
+// got matches want, and every pixel that changed from before lies in got's dirty rect
+static void assert_drawn(const displayManager_buffer_t* got, const displayManager_buffer_t* want,
+                         const uint32_t* before, const char* what)
+{
+    static uint32_t gotPixels[TEST_WIDTH * TEST_HEIGHT * 4];
+    static uint32_t wantPixels[TEST_WIDTH * TEST_HEIGHT * 4];
+    read_pixels(got, gotPixels);
+    read_pixels(want, wantPixels);
+    for (uint32_t y = 0; y < got->height; y++) {
+        for (uint32_t x = 0; x < got->width; x++) {
+            uint32_t i = y * got->width + x;
+            if (gotPixels[i] != wantPixels[i]) {
+                char message[160];
+                snprintf(message, sizeof(message), "%s, format %d: pixel (%lu, %lu) is %08lX, want %08lX",
+                         what, got->format, (unsigned long)x, (unsigned long)y,
+                         (unsigned long)gotPixels[i], (unsigned long)wantPixels[i]);
+                TEST_FAIL_MESSAGE(message);
+            }
+            if (gotPixels[i] != before[i]) {
+                TEST_ASSERT_TRUE_MESSAGE(got->dirty && x >= got->dirty_x0 && x <= got->dirty_x1 &&
+                                         y >= got->dirty_y0 && y <= got->dirty_y1, what);
+            }
+        }
+    }
+}
+
+static bool in_rect(int64_t px, int64_t py, int64_t x, int64_t y, int64_t width, int64_t height)
+{
+    return px >= x && px < x + width && py >= y && py < y + height;
+}
+
+// Rectangles, outlines and spans, partly, wholly or far off the buffer
+static void test_rects_match_reference(void)
+{
+    for (int format = 0; format < NUM_FORMATS; format++) {
+        displayManager_buffer_t* got = make_buffer("got", TEST_WIDTH, TEST_HEIGHT, format);
+        displayManager_buffer_t* want = make_buffer("want", TEST_WIDTH, TEST_HEIGHT, format);
+        static uint32_t before[TEST_WIDTH * TEST_HEIGHT];
+        for (int it = 0; it < 3000; it++) {
+            fill_background(got, want);
+            read_pixels(got, before);
+            int32_t x = random_coord(TEST_WIDTH);
+            int32_t y = random_coord(TEST_HEIGHT);
+            int32_t w = (rand() % 8 == 0) ? random_coord(TEST_WIDTH) : rand() % (2 * TEST_WIDTH);
+            int32_t h = (rand() % 8 == 0) ? random_coord(TEST_HEIGHT) : rand() % (2 * TEST_HEIGHT);
+            uint32_t color = random_color(format);
+            int op = rand() % 5;
+            switch (op) {
+                case 0:
+                    graphics_fillRect(got, x, y, w, h, color);
+                    break;
+                case 1:
+                    graphics_drawRect(got, x, y, w, h, color);
+                    break;
+                case 2:
+                    graphics_drawHLine(got, x, y, w, color);
+                    h = 1;
+                    break;
+                case 3:
+                    graphics_drawVLine(got, x, y, h, color);
+                    w = 1;
+                    break;
+                default:
+                    // The old entry point, with byte coordinates
+                    x = (uint8_t)x;
+                    y = (uint8_t)y;
+                    w = (uint8_t)w;
+                    h = (uint8_t)h;
+                    graphics_drawRectangle(got, x, y, w, h, color);
+                    break;
+            }
+            for (int64_t py = 0; py < TEST_HEIGHT; py++) {
+                for (int64_t px = 0; px < TEST_WIDTH; px++) {
+                    bool edge = (px == x || px == (int64_t)x + w - 1 || py == y || py == (int64_t)y + h - 1);
+                    if (in_rect(px, py, x, y, w, h) && (op != 1 || edge)) {
+                        plot(want, px, py, color);
+                    }
+                }
+            }
+            assert_drawn(got, want, before, (op == 1) ? "outline" : "rect");
+        }
+        free_buffer(got);
+        free_buffer(want);
+    }
+}
+
+// Blocks copied between every pair of formats and within one buffer, overlapping itself
+static void test_blits_match_reference(void)
+{
+    static uint32_t source[2 * TEST_WIDTH * 2 * TEST_HEIGHT];
+    static uint32_t before[TEST_WIDTH * TEST_HEIGHT];
+    for (int from = 0; from < NUM_FORMATS; from++) {
+        for (int to = 0; to < NUM_FORMATS; to++) {
+            displayManager_buffer_t* got = make_buffer("got", TEST_WIDTH, TEST_HEIGHT, to);
+            displayManager_buffer_t* want = make_buffer("want", TEST_WIDTH, TEST_HEIGHT, to);
+            displayManager_buffer_t* src = make_buffer("src", 2 * TEST_WIDTH - 5, TEST_HEIGHT + 4, from);
+            for (int it = 0; it < 500; it++) {
+                bool self = (from == to) && rand() % 3 == 0;
+                fill_background(got, want);
+                for (uint32_t y = 0; y < src->height; y++) {
+                    for (uint32_t x = 0; x < src->width; x++) {
+                        // Transparent pixels are copied like any other
+                        uint32_t color = (rand() % 10 == 0) ? TRANSPARENT : random_color(from);
+                        display_manager_setBufferPixel(src, x, y, color);
+                    }
+                }
+                read_pixels(got, before);
+                const displayManager_buffer_t* from_buf = self ? got : src;
+                read_pixels(self ? want : src, source);
+
+                int32_t x = random_coord(TEST_WIDTH);
+                int32_t y = random_coord(TEST_HEIGHT);
+                int32_t sx = random_coord(from_buf->width);
+                int32_t sy = random_coord(from_buf->height);
+                int32_t w = rand() % (2 * TEST_WIDTH);
+                int32_t h = rand() % (2 * TEST_HEIGHT);
+                graphics_blit(got, x, y, from_buf, sx, sy, w, h);
+                for (int64_t py = 0; py < TEST_HEIGHT; py++) {
+                    for (int64_t px = 0; px < TEST_WIDTH; px++) {
+                        int64_t qx = sx + (px - x);
+                        int64_t qy = sy + (py - y);
+                        if (in_rect(px, py, x, y, w, h) && in_rect(qx, qy, 0, 0, from_buf->width, from_buf->height)) {
+                            plot(want, px, py, source[qy * from_buf->width + qx]);
+                        }
+                    }
+                }
+                assert_drawn(got, want, before, self ? "self blit" : "blit");
+            }
+            free_buffer(src);
+            free_buffer(got);
+            free_buffer(want);
+        }
+    }
+}
+
+// Every step of a line, unclipped, with the rounding graphics_drawLine uses: step i of
+// the major axis is offset floor((2 * i * minor + major) / (2 * major)) along the minor one
+static void reference_line(displayManager_buffer_t* buf, int64_t x1, int64_t y1, int64_t x2, int64_t y2,
+                           uint32_t color)
+{
+    int64_t dx = llabs(x2 - x1);
+    int64_t dy = llabs(y2 - y1);
+    int64_t sx = (x1 < x2) ? 1 : -1;
+    int64_t sy = (y1 < y2) ? 1 : -1;
+    bool xMajor = (dx >= dy);
+    int64_t major = xMajor ? dx : dy;
+    int64_t minor = xMajor ? dy : dx;
+    for (int64_t i = 0; i <= major; i++) {
+        int64_t q = major ? (2 * i * minor + major) / (2 * major) : 0;
+        plot(buf, x1 + sx * (xMajor ? i : q), y1 + sy * (xMajor ? q : i), color);
+    }
+}
+
+// Lines at every angle and length, from on the buffer to far off it
+static void test_lines_match_reference(void)
+{
+    static uint32_t before[TEST_WIDTH * TEST_HEIGHT];
+    for (int format = 0; format < NUM_FORMATS; format++) {
+        displayManager_buffer_t* got = make_buffer("got", TEST_WIDTH, TEST_HEIGHT, format);
+        displayManager_buffer_t* want = make_buffer("want", TEST_WIDTH, TEST_HEIGHT, format);
+        for (int it = 0; it < 4000; it++) {
+            fill_background(got, want);
+            read_pixels(got, before);
+            int32_t span = (rand() % 16 == 0) ? 20000 : 3 * TEST_WIDTH;
+            int32_t x1 = rand() % (2 * span) - span + TEST_WIDTH / 2;
+            int32_t y1 = rand() % (2 * span) - span + TEST_HEIGHT / 2;
+            int32_t x2 = x1 + rand() % 9 - 4; // Short ones too, and axis-aligned ones
+            int32_t y2 = y1 + rand() % 9 - 4;
+            if (rand() % 2) {
+                x2 = rand() % (2 * span) - span + TEST_WIDTH / 2;
+                y2 = rand() % (2 * span) - span + TEST_HEIGHT / 2;
+            }
+            uint32_t color = random_color(format);
+            graphics_drawLine(got, x1, y1, x2, y2, color);
+            reference_line(want, x1, y1, x2, y2, color);
+            assert_drawn(got, want, before, "line");
+        }
+        free_buffer(got);
+        free_buffer(want);
+    }
+}
+
+static bool in_range(int32_t v)
+{
+    return v >= -GRAPHICS_MAX_COORD && v <= GRAPHICS_MAX_COORD;
+}
+
+// Ends anywhere in the int32_t range: lines within GRAPHICS_MAX_COORD clip to the right
+// pixels, checked against the reference when short enough to step, and others draw nothing
+static void test_lines_at_the_ends_of_the_range(void)
+{
+    static uint32_t before[TEST_WIDTH * TEST_HEIGHT];
+    displayManager_buffer_t* got = make_buffer("got", TEST_WIDTH, TEST_HEIGHT, DISPLAY_FORMAT_RGB888);
+    displayManager_buffer_t* want = make_buffer("want", TEST_WIDTH, TEST_HEIGHT, DISPLAY_FORMAT_RGB888);
+    uint32_t checked = 0;
+    uint32_t rejected = 0;
+    for (int it = 0; it < 2000; it++) {
+        fill_background(got, want);
+        read_pixels(got, before);
+        int32_t x1 = random_coord(TEST_WIDTH);
+        int32_t y1 = random_coord(TEST_HEIGHT);
+        int32_t x2 = random_coord(TEST_WIDTH);
+        int32_t y2 = random_coord(TEST_HEIGHT);
+        if (rand() % 4 == 0) {
+            // Just within or just past the limit
+            int32_t edge = GRAPHICS_MAX_COORD + rand() % 3 - 1;
+            x1 = (rand() % 2) ? edge : -edge;
+        }
+        graphics_drawLine(got, x1, y1, x2, y2, 0x123456);
+        bool drawn = in_range(x1) && in_range(y1) && in_range(x2) && in_range(y2);
+        if (drawn && llabs((int64_t)x2 - x1) <= 200000 && llabs((int64_t)y2 - y1) <= 200000) {
+            reference_line(want, x1, y1, x2, y2, 0x123456);
+            assert_drawn(got, want, before, "long line");
+            checked++;
+        } else if (!drawn) {
+            assert_drawn(got, want, before, "line past the limit");
+            rejected++;
+        }
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, checked);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, rejected);
+    free_buffer(got);
+    free_buffer(want);
+}
+
+// Reference masks for shapes, on a canvas large enough to hold them whole, so rows
+// that cross the buffer get the extents of the whole shape
+#define MASK_SIZE 512
+#define MASK_ORIGIN 200 // Mask coordinates of buffer (0, 0)
+
+static uint8_t mask[MASK_SIZE][MASK_SIZE];
+static int32_t mask_x0, mask_y0, mask_x1, mask_y1; // Area set so far
+
+static void mask_clear(void)
+{
+    for (int32_t y = mask_y0; y <= mask_y1; y++) {
+        memset(&mask[y][mask_x0], 0, mask_x1 - mask_x0 + 1);
+    }
+    mask_x0 = mask_y0 = MASK_SIZE;
+    mask_x1 = mask_y1 = -1;
+}
+
+static void mask_set(int64_t x, int64_t y)
+{
+    x += MASK_ORIGIN;
+    y += MASK_ORIGIN;
+    TEST_ASSERT_TRUE(x >= 0 && y >= 0 && x < MASK_SIZE && y < MASK_SIZE);
+    mask[y][x] = 1;
+    mask_x0 = MIN(mask_x0, x);
+    mask_y0 = MIN(mask_y0, y);
+    mask_x1 = MAX(mask_x1, x);
+    mask_y1 = MAX(mask_y1, y);
+}
+
+// The same steps as reference_line, into the mask
+static void mask_line(int64_t x1, int64_t y1, int64_t x2, int64_t y2)
+{
+    int64_t dx = llabs(x2 - x1);
+    int64_t dy = llabs(y2 - y1);
+    bool xMajor = (dx >= dy);
+    int64_t major = xMajor ? dx : dy;
+    int64_t minor = xMajor ? dy : dx;
+    for (int64_t i = 0; i <= major; i++) {
+        int64_t q = major ? (2 * i * minor + major) / (2 * major) : 0;
+        mask_set(x1 + ((x1 < x2) ? 1 : -1) * (xMajor ? i : q), y1 + ((y1 < y2) ? 1 : -1) * (xMajor ? q : i));
+    }
+}
+
+// Textbook midpoint circle, all eight octants a pixel at a time
+static void mask_circle(int32_t cx, int32_t cy, int32_t radius)
+{
+    int32_t x = radius;
+    int32_t y = 0;
+    int32_t d = 1 - radius;
+    while (x >= y) {
+        mask_set(cx + x, cy + y);
+        mask_set(cx - x, cy + y);
+        mask_set(cx + x, cy - y);
+        mask_set(cx - x, cy - y);
+        mask_set(cx + y, cy + x);
+        mask_set(cx - y, cy + x);
+        mask_set(cx + y, cy - x);
+        mask_set(cx - y, cy - x);
+        y++;
+        if (d < 0) {
+            d += 2 * y + 1;
+        } else {
+            x--;
+            d += 2 * (y - x) + 1;
+        }
+    }
+}
+
+static void mask_polygon(const graphics_point_t* points, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        const graphics_point_t* to = &points[(i + 1) % count];
+        mask_line(points[i].x, points[i].y, to->x, to->y);
+    }
+}
+
+// A filled shape is its outline and everything between, row by row
+static void mask_fill(void)
+{
+    for (int32_t y = mask_y0; y <= mask_y1; y++) {
+        int32_t left = mask_x0;
+        int32_t right = mask_x1;
+        while (left <= right && !mask[y][left]) {
+            left++;
+        }
+        while (right >= left && !mask[y][right]) {
+            right--;
+        }
+        if (left <= right) {
+            memset(&mask[y][left], 1, right - left + 1);
+        }
+    }
+}
+
+static void mask_plot(displayManager_buffer_t* buf, uint32_t color)
+{
+    for (int32_t y = mask_y0; y <= mask_y1; y++) {
+        for (int32_t x = mask_x0; x <= mask_x1; x++) {
+            if (mask[y][x]) {
+                plot(buf, x - MASK_ORIGIN, y - MASK_ORIGIN, color);
+            }
+        }
+    }
+}
+
+typedef enum
+{
+    SHAPE_CIRCLE,
+    SHAPE_TRIANGLE,
+    SHAPE_POLYGON,
+    NUM_SHAPES,
+} shape_E;
+
+typedef struct
+{
+    shape_E shape;
+    bool fill;
+    graphics_point_t points[GRAPHICS_MAX_POLYGON_POINTS]; // Centre of a circle in points[0]
+    uint32_t count;
+    int32_t radius;
+} shape_t;
+
+static void random_shape(shape_t* shape)
+{
+    shape->shape = rand() % NUM_SHAPES;
+    shape->fill = rand() % 2;
+    shape->count = (shape->shape == SHAPE_CIRCLE) ? 1 :
+                   (shape->shape == SHAPE_TRIANGLE) ? 3 : 1 + rand() % GRAPHICS_MAX_POLYGON_POINTS;
+    bool large = (rand() % 8 == 0);
+    for (uint32_t i = 0; i < shape->count; i++) {
+        shape->points[i].x = large ? rand() % 380 - 180 : rand() % (3 * TEST_WIDTH) - TEST_WIDTH;
+        shape->points[i].y = large ? rand() % 380 - 180 : rand() % (3 * TEST_HEIGHT) - TEST_HEIGHT;
+    }
+    shape->radius = large ? rand() % 150 : rand() % 20;
+    if (shape->shape == SHAPE_CIRCLE && large) {
+        shape->points[0].x = rand() % 80 - 30;
+        shape->points[0].y = rand() % 80 - 30;
+    }
+}
+
+static void draw_shape(displayManager_buffer_t* buf, const shape_t* shape, uint32_t color)
+{
+    const graphics_point_t* p = shape->points;
+    switch (shape->shape) {
+        case SHAPE_CIRCLE:
+            shape->fill ? graphics_fillCircle(buf, p[0].x, p[0].y, shape->radius, color) :
+                          graphics_drawCircle(buf, p[0].x, p[0].y, shape->radius, color);
+            break;
+        case SHAPE_TRIANGLE:
+            shape->fill ? graphics_fillTriangle(buf, p[0].x, p[0].y, p[1].x, p[1].y, p[2].x, p[2].y, color) :
+                          graphics_drawTriangle(buf, p[0].x, p[0].y, p[1].x, p[1].y, p[2].x, p[2].y, color);
+            break;
+        default:
+            shape->fill ? graphics_fillPolygon(buf, p, shape->count, color) :
+                          graphics_drawPolygon(buf, p, shape->count, color);
+            break;
+    }
+}
+
+static void mask_shape(const shape_t* shape)
+{
+    mask_clear();
+    if (shape->shape == SHAPE_CIRCLE) {
+        mask_circle(shape->points[0].x, shape->points[0].y, shape->radius);
+    } else {
+        mask_polygon(shape->points, shape->count);
+    }
+    if (shape->fill) {
+        mask_fill();
+    }
+}
+
+static const char* const shape_names[NUM_SHAPES] = { "circle", "triangle", "polygon" };
+
+// Circles, triangles and polygons, outlined and filled, partly or wholly off the buffer
+static void test_shapes_match_masks(void)
+{
+    static uint32_t before[TEST_WIDTH * TEST_HEIGHT];
+    mask_x0 = mask_y0 = 0;
+    mask_x1 = mask_y1 = MASK_SIZE - 1;
+    for (int format = 0; format < NUM_FORMATS; format++) {
+        displayManager_buffer_t* got = make_buffer("got", TEST_WIDTH, TEST_HEIGHT, format);
+        displayManager_buffer_t* want = make_buffer("want", TEST_WIDTH, TEST_HEIGHT, format);
+        for (int it = 0; it < 3000; it++) {
+            fill_background(got, want);
+            read_pixels(got, before);
+            shape_t shape;
+            random_shape(&shape);
+            uint32_t color = random_color(format);
+            draw_shape(got, &shape, color);
+            mask_shape(&shape);
+            mask_plot(want, color);
+            assert_drawn(got, want, before, shape_names[shape.shape]);
+        }
+        free_buffer(got);
+        free_buffer(want);
+    }
+}
+
+// Twice the signed area of (a, b, p): which side of a to b the point p lies on
+static int64_t edge_side(graphics_point_t a, graphics_point_t b, int32_t x, int32_t y)
+{
+    return (int64_t)(b.x - a.x) * (y - a.y) - (int64_t)(b.y - a.y) * (x - a.x);
+}
+
+// A triangle's outline is its three lines, and filling it covers every pixel centre
+// inside it
+static void test_triangles_cover_their_insides(void)
+{
+    displayManager_buffer_t* filled = make_buffer("filled", TEST_WIDTH, TEST_HEIGHT, DISPLAY_FORMAT_RGB888);
+    displayManager_buffer_t* outline = make_buffer("outline", TEST_WIDTH, TEST_HEIGHT, DISPLAY_FORMAT_RGB888);
+    displayManager_buffer_t* lines = make_buffer("lines", TEST_WIDTH, TEST_HEIGHT, DISPLAY_FORMAT_RGB888);
+    uint32_t inside = 0;
+    for (int it = 0; it < 5000; it++) {
+        graphics_point_t p[3];
+        for (int i = 0; i < 3; i++) {
+            p[i].x = rand() % (3 * TEST_WIDTH) - TEST_WIDTH;
+            p[i].y = rand() % (3 * TEST_HEIGHT) - TEST_HEIGHT;
+        }
+        if (edge_side(p[0], p[1], p[2].x, p[2].y) == 0) {
+            continue; // Flat: every point of the line through it would count as inside
+        }
+        memset(filled->buffer, 0, TEST_WIDTH * TEST_HEIGHT * sizeof(uint32_t));
+        memset(outline->buffer, 0, TEST_WIDTH * TEST_HEIGHT * sizeof(uint32_t));
+        memset(lines->buffer, 0, TEST_WIDTH * TEST_HEIGHT * sizeof(uint32_t));
+        graphics_fillTriangle(filled, p[0].x, p[0].y, p[1].x, p[1].y, p[2].x, p[2].y, 1);
+        graphics_drawTriangle(outline, p[0].x, p[0].y, p[1].x, p[1].y, p[2].x, p[2].y, 1);
+        for (int i = 0; i < 3; i++) {
+            graphics_drawLine(lines, p[i].x, p[i].y, p[(i + 1) % 3].x, p[(i + 1) % 3].y, 1);
+        }
+        TEST_ASSERT_EQUAL_HEX32_ARRAY(lines->buffer, outline->buffer, TEST_WIDTH * TEST_HEIGHT);
+
+        for (int32_t y = 0; y < TEST_HEIGHT; y++) {
+            for (int32_t x = 0; x < TEST_WIDTH; x++) {
+                int64_t a = edge_side(p[0], p[1], x, y);
+                int64_t b = edge_side(p[1], p[2], x, y);
+                int64_t c = edge_side(p[2], p[0], x, y);
+                if ((a >= 0 && b >= 0 && c >= 0) || (a <= 0 && b <= 0 && c <= 0)) {
+                    TEST_ASSERT_EQUAL_HEX32(1, filled->buffer[y * TEST_WIDTH + x]);
+                    inside++;
+                }
+                if (outline->buffer[y * TEST_WIDTH + x]) {
+                    TEST_ASSERT_EQUAL_HEX32(1, filled->buffer[y * TEST_WIDTH + x]);
+                }
+            }
+        }
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, inside);
+    free_buffer(filled);
+    free_buffer(outline);
+    free_buffer(lines);
+}
+
+// Corners and centres anywhere in the int32_t range must not trip UBSan, and shapes
+// reaching past GRAPHICS_MAX_COORD draw nothing
+static void test_shapes_at_the_ends_of_the_range(void)
+{
+    static uint32_t before[TEST_WIDTH * TEST_HEIGHT];
+    displayManager_buffer_t* got = make_buffer("got", TEST_WIDTH, TEST_HEIGHT, DISPLAY_FORMAT_RGB888);
+    displayManager_buffer_t* want = make_buffer("want", TEST_WIDTH, TEST_HEIGHT, DISPLAY_FORMAT_RGB888);
+    uint32_t rejected = 0;
+    for (int it = 0; it < 20000; it++) {
+        fill_background(got, want);
+        read_pixels(got, before);
+        shape_t shape;
+        random_shape(&shape);
+        bool drawn = true;
+        for (uint32_t i = 0; i < shape.count; i++) {
+            shape.points[i].x = random_coord(TEST_WIDTH);
+            shape.points[i].y = random_coord(TEST_HEIGHT);
+            drawn = drawn && in_range(shape.points[i].x) && in_range(shape.points[i].y);
+        }
+        shape.radius = rand() % 40;
+        if (shape.shape == SHAPE_CIRCLE && rand() % 8 == 0) {
+            // Centred on the buffer, with a radius just past the limit
+            shape.points[0].x = TEST_WIDTH / 2;
+            shape.points[0].y = TEST_HEIGHT / 2;
+            shape.radius = GRAPHICS_MAX_COORD + rand() % 2 + 1;
+            drawn = false;
+        }
+        draw_shape(got, &shape, 0x123456);
+        if (!drawn) {
+            assert_drawn(got, want, before, "shape past the limit");
+            rejected++;
+        }
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, rejected);
+    free_buffer(got);
+    free_buffer(want);
+}
+
+// What graphics_drawRectangle did before the span kernels: a bounds check and
+// display_manager_setBufferPixel for every pixel
+static void baseline_fill(displayManager_buffer_t* buf, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            plot(buf, x + col, y + row, color);
+        }
+    }
+}
+
+// And a blit the same way, reading each source pixel on its own
+static void baseline_blit(displayManager_buffer_t* dst, int32_t x, int32_t y,
+                          const displayManager_buffer_t* src, int32_t w, int32_t h)
+{
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t col = 0; col < w; col++) {
+            uint32_t color;
+            const uint32_t* px = display_manager_expandRow(src, src->buffer8, col, row, 1, &color);
+            plot(dst, x + col, y + row, *px);
+        }
+    }
+}
+
+// What graphics_drawLine did before it clipped: Bresenham over every step, each
+// pixel bounds checked and set on its own
+static void baseline_line(displayManager_buffer_t* buf, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                          uint32_t color)
+{
+    int32_t dx = abs(x2 - x1);
+    int32_t dy = abs(y2 - y1);
+    int32_t sx = (x1 < x2) ? 1 : -1;
+    int32_t sy = (y1 < y2) ? 1 : -1;
+    int32_t err = dx - dy;
+    while (true) {
+        plot(buf, x1, y1, color);
+        if (x1 == x2 && y1 == y2) {
+            break;
+        }
+        int32_t err2 = err * 2;
+        if (err2 > -dy) {
+            err -= dy;
+            x1 += sx;
+        }
+        if (err2 < dx) {
+            err += dx;
+            y1 += sy;
+        }
+    }
+}
+
+typedef enum
+{
+    BENCH_FILL,
+    BENCH_FILL_CLIPPED,
+    BENCH_OUTLINE,
+    BENCH_HLINE,
+    BENCH_BLIT,
+    BENCH_LINE_H,
+    BENCH_LINE_DIAGONAL,
+    BENCH_LINE_LONG,
+    NUM_BENCH,
+} bench_E;
+
+static const char* const bench_names[NUM_BENCH] = {
+    "fill 32x16", "fill 32x16 half off", "outline 32x16", "hline 32", "blit 32x16",
+    "line 32 across", "line corner to corner", "line of 2000 steps, 32 on screen",
+};
+
+static void bench_run(bench_E bench, bool baseline, displayManager_buffer_t* buf,
+                      displayManager_buffer_t* src, uint32_t color)
+{
+    switch (bench) {
+        case BENCH_FILL:
+            baseline ? baseline_fill(buf, 0, 0, 32, 16, color) : graphics_fillRect(buf, 0, 0, 32, 16, color);
+            break;
+        case BENCH_FILL_CLIPPED:
+            baseline ? baseline_fill(buf, 16, 8, 32, 16, color) : graphics_fillRect(buf, 16, 8, 32, 16, color);
+            break;
+        case BENCH_OUTLINE:
+            if (baseline) {
+                baseline_fill(buf, 0, 0, 32, 1, color);
+                baseline_fill(buf, 0, 15, 32, 1, color);
+                baseline_fill(buf, 0, 1, 1, 14, color);
+                baseline_fill(buf, 31, 1, 1, 14, color);
+            } else {
+                graphics_drawRect(buf, 0, 0, 32, 16, color);
+            }
+            break;
+        case BENCH_HLINE:
+            baseline ? baseline_fill(buf, 0, 5, 32, 1, color) : graphics_drawHLine(buf, 0, 5, 32, color);
+            break;
+        case BENCH_BLIT:
+            baseline ? baseline_blit(buf, 0, 0, src, 32, 16) : graphics_blit(buf, 0, 0, src, 0, 0, 32, 16);
+            break;
+        case BENCH_LINE_H:
+            baseline ? baseline_line(buf, 0, 7, 31, 7, color) : graphics_drawLine(buf, 0, 7, 31, 7, color);
+            break;
+        case BENCH_LINE_DIAGONAL:
+            baseline ? baseline_line(buf, 0, 0, 31, 15, color) : graphics_drawLine(buf, 0, 0, 31, 15, color);
+            break;
+        default:
+            baseline ? baseline_line(buf, -984, -4, 1015, 11, color) : graphics_drawLine(buf, -984, -4, 1015, 11, color);
+            break;
+    }
+}
+
+// Nanoseconds per call, best of 5
+static double time_bench(bench_E bench, bool baseline, displayManager_format_E format)
+{
+    displayManager_buffer_t* buf = make_buffer("bench", 32, 16, format);
+    displayManager_buffer_t* src = make_buffer("src", 32, 16, format);
+    baseline_fill(src, 0, 0, 32, 16, random_color(format));
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 20000; i++) {
+            bench_run(bench, baseline, buf, src, palette[i % PALETTE_SIZE]);
+            __asm__ volatile("" ::: "memory");
+        }
+        double ns = (esp_timer_get_time() - start) * 1000.0 / 20000;
+        best = (ns < best) ? ns : best;
+    }
+    free_buffer(src);
+    free_buffer(buf);
+    return best;
+}
+
+static void test_benchmark_primitives(void)
+{
+    const displayManager_format_E formats[] = { DISPLAY_FORMAT_RGB888, DISPLAY_FORMAT_INDEXED4 };
+    for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+        for (int bench = 0; bench < NUM_BENCH; bench++) {
+            double baseline = time_bench(bench, true, formats[f]);
+            double spans = time_bench(bench, false, formats[f]);
+            char message[128];
+            snprintf(message, sizeof(message), "%s %s: per pixel %.0f ns, clipped %.0f ns",
+                     bench_names[bench], formats[f] == DISPLAY_FORMAT_RGB888 ? "RGB888" : "indexed4",
+                     baseline, spans);
+            TEST_MESSAGE(message);
+        }
+    }
+}
+
+// Nanoseconds per shape on a 32x16 RGB888 buffer, best of 5: drawn by the rasterizer,
+// and the same pixels set one at a time
+static void time_shape(const shape_t* shape, double* rasterized, double* per_pixel)
+{
+    static struct
+    {
+        int32_t x;
+        int32_t y;
+    } pixels[32 * 16];
+    displayManager_buffer_t* buf = make_buffer("bench", 32, 16, DISPLAY_FORMAT_RGB888);
+    mask_shape(shape);
+    uint32_t count = 0;
+    for (int32_t y = mask_y0; y <= mask_y1; y++) {
+        for (int32_t x = mask_x0; x <= mask_x1; x++) {
+            int32_t px = x - MASK_ORIGIN;
+            int32_t py = y - MASK_ORIGIN;
+            if (mask[y][x] && px >= 0 && py >= 0 && px < 32 && py < 16) {
+                pixels[count].x = px;
+                pixels[count++].y = py;
+            }
+        }
+    }
+    *rasterized = 1e30;
+    *per_pixel = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 20000; i++) {
+            draw_shape(buf, shape, palette[i % PALETTE_SIZE]);
+            __asm__ volatile("" ::: "memory");
+        }
+        double ns = (esp_timer_get_time() - start) * 1000.0 / 20000;
+        *rasterized = (ns < *rasterized) ? ns : *rasterized;
+
+        start = esp_timer_get_time();
+        for (int i = 0; i < 20000; i++) {
+            for (uint32_t p = 0; p < count; p++) {
+                plot(buf, pixels[p].x, pixels[p].y, palette[i % PALETTE_SIZE]);
+            }
+            __asm__ volatile("" ::: "memory");
+        }
+        ns = (esp_timer_get_time() - start) * 1000.0 / 20000;
+        *per_pixel = (ns < *per_pixel) ? ns : *per_pixel;
+    }
+    free_buffer(buf);
+}
+
+static void test_benchmark_shapes(void)
+{
+    const struct
+    {
+        const char* name;
+        shape_t shape;
+    } benches[] = {
+        { "circle r7", { SHAPE_CIRCLE, false, { { 16, 8 } }, 1, 7 } },
+        { "filled circle r7", { SHAPE_CIRCLE, true, { { 16, 8 } }, 1, 7 } },
+        { "filled circle r20, clipped", { SHAPE_CIRCLE, true, { { 16, 8 } }, 1, 20 } },
+        { "triangle", { SHAPE_TRIANGLE, false, { { 2, 1 }, { 29, 4 }, { 12, 14 } }, 3, 0 } },
+        { "filled triangle", { SHAPE_TRIANGLE, true, { { 2, 1 }, { 29, 4 }, { 12, 14 } }, 3, 0 } },
+        { "filled octagon", { SHAPE_POLYGON, true,
+                              { { 11, 0 }, { 20, 0 }, { 27, 4 }, { 27, 11 }, { 20, 15 }, { 11, 15 }, { 4, 11 }, { 4, 4 } },
+                              8, 0 } },
+    };
+    for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+        double rasterized;
+        double per_pixel;
+        time_shape(&benches[i].shape, &rasterized, &per_pixel);
+        char message[128];
+        snprintf(message, sizeof(message), "%s on 32x16: per pixel %.0f ns, rasterized %.0f ns",
+                 benches[i].name, per_pixel, rasterized);
+        TEST_MESSAGE(message);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_rects_match_reference);
+    RUN_TEST(test_blits_match_reference);
+    RUN_TEST(test_lines_match_reference);
+    RUN_TEST(test_lines_at_the_ends_of_the_range);
+    RUN_TEST(test_shapes_match_masks);
+    RUN_TEST(test_triangles_cover_their_insides);
+    RUN_TEST(test_shapes_at_the_ends_of_the_range);
+    RUN_TEST(test_benchmark_primitives);
+    RUN_TEST(test_benchmark_shapes);
+    return UNITY_END();
+}
@@ -0,0 +1,470 @@
+// Host tests for the WS2812B encoder in lib/neopixel. Run with: pio test -e native
+#include <unity.h>
+
+#include "neopixel.c"
+
+#include "esp_timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_PIXELS 512 // A 16x32 panel
+
+// The encoder before it went word-at-a-time: one byte of ws2812b_color_map at a time
+static void baseline_setpixel(uint8_t* buffer, uint32_t index, uint32_t rgb)
+{
+    uint32_t offset = index * WS2182B_BYTES_PER_PIXEL;
+    const uint8_t* sequence = ws2812b_color_map[NP_RGB2GREEN(rgb)];
+    for (int i = 0; i < WS2182B_BYTES_PER_PIXEL; ++i, ++offset) {
+        if (i == 3) {
+            sequence = ws2812b_color_map[NP_RGB2RED(rgb)];
+        }
+        if (i == 6) {
+            sequence = ws2812b_color_map[NP_RGB2BLUE(rgb)];
+        }
+        buffer[offset ^ 1] = sequence[i % WS2182B_BYTES_PER_COLOR];
+    }
+}
+
+// Straight from the protocol, bit by bit: G, R, B, each MSB first, each bit sent as
+// three serialized bits, written as 16-bit little-endian words
+static void reference_encode(uint8_t* buffer, const uint32_t* rgb, uint32_t pixels)
+{
+    uint32_t bit = 0;
+    memset(buffer, 0, pixels * WS2182B_BYTES_PER_PIXEL);
+    for (uint32_t p = 0; p < pixels; p++) {
+        uint32_t grb = (NP_RGB2GREEN(rgb[p]) << 16) | (NP_RGB2RED(rgb[p]) << 8) | NP_RGB2BLUE(rgb[p]);
+        for (int b = 23; b >= 0; b--) {
+            uint32_t code = ((grb >> b) & 1) ? WS2812B_ONE : WS2812B_ZERO;
+            for (int s = 2; s >= 0; s--, bit++) {
+                if ((code >> s) & 1) {
+                    buffer[(bit / 8) ^ 1] |= 0x80 >> (bit % 8);
+                }
+            }
+        }
+    }
+}
+
+static uint32_t random_rgb(void)
+{
+    return ((uint32_t)rand() << 8 ^ (uint32_t)rand()) & 0xFFFFFF;
+}
+
+static uint32_t frame[TEST_PIXELS];
+static uint8_t expected[TEST_PIXELS * WS2182B_BYTES_PER_PIXEL];
+static uint8_t actual[TEST_PIXELS * WS2182B_BYTES_PER_PIXEL];
+
+void setUp(void)
+{
+    srand(1);
+}
+
+void tearDown(void)
+{
+}
+
+static void test_color_map_matches_protocol(void)
+{
+    // Pixels are 9 bytes but the buffer is written in 16-bit words, so they come in pairs
+    uint8_t bits[2 * WS2182B_BYTES_PER_PIXEL];
+    for (uint32_t v = 0; v < 256; v++) {
+        uint32_t rgb[2] = { NP_RGB(v, v, v), NP_RGB(v, 255 - v, v ^ 0x5A) };
+        reference_encode(bits, rgb, 2);
+        baseline_setpixel(actual, 0, rgb[0]);
+        baseline_setpixel(actual, 1, rgb[1]);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(bits, actual, sizeof(bits));
+    }
+}
+
+static void test_encode_group_matches_baseline(void)
+{
+    for (uint32_t round = 0; round < 2000; round++) {
+        for (uint32_t i = 0; i < WS2812B_GROUP_PIXELS; i++) {
+            // Mix in the extremes, where a shift into the wrong byte shows
+            uint32_t pick = rand() % 4;
+            frame[i] = (pick == 0) ? 0x000000 : (pick == 1) ? 0xFFFFFF : random_rgb();
+        }
+        for (uint32_t i = 0; i < WS2812B_GROUP_PIXELS; i++) {
+            baseline_setpixel(expected, i, frame[i]);
+        }
+        uint32_t words[WS2812B_GROUP_WORDS];
+        encode_group(words, frame, ws2812b_code_map);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, (const uint8_t*)words, sizeof(words));
+    }
+}
+
+static void test_setpixel_matches_baseline(void)
+{
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        frame[i] = random_rgb();
+        baseline_setpixel(expected, i, frame[i]);
+        setpixel(actual, i, frame[i], ws2812b_code_map);
+    }
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, actual, sizeof(expected));
+    reference_encode(actual, frame, TEST_PIXELS);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, actual, sizeof(expected));
+}
+
+// Nanoseconds per pixel, best of a few runs
+static double time_per_pixel(void (*encode)(void))
+{
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 200; i++) {
+            encode();
+        }
+        double ns = (double)(esp_timer_get_time() - start) * 1000.0 / (200.0 * TEST_PIXELS);
+        best = (ns < best) ? ns : best;
+    }
+    return best;
+}
+
+static void encode_baseline(void)
+{
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        baseline_setpixel(actual, i, frame[i]);
+    }
+    __asm__ volatile("" : : "r"(actual) : "memory");
+}
+
+static void encode_groups(void)
+{
+    for (uint32_t i = 0; i < TEST_PIXELS; i += WS2812B_GROUP_PIXELS) {
+        encode_group((uint32_t*)&actual[i * WS2182B_BYTES_PER_PIXEL], &frame[i], ws2812b_code_map);
+    }
+    __asm__ volatile("" : : "r"(actual) : "memory");
+}
+
+static void test_benchmark_encoders(void)
+{
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        frame[i] = random_rgb();
+    }
+    double baseline = time_per_pixel(encode_baseline);
+    double groups = time_per_pixel(encode_groups);
+    char message[128];
+    snprintf(message, sizeof(message), "%d pixels: byte at a time %.2f ns/pixel, word at a time %.2f ns/pixel",
+             TEST_PIXELS, baseline, groups);
+    TEST_MESSAGE(message);
+}
+
+// The transmit task's side of the hand-over
+static const uint8_t* transmit(tNpContext* c)
+{
+    return take_frame(c);
+}
+
+// What a full re-encode of the frame puts in a transmit buffer
+static void encode_all(uint8_t* buffer, const tNpContext* c, const uint32_t* rgb)
+{
+    memset(buffer, 0, c->bufferSize);
+    for (uint32_t i = 0; i < c->pixels; i++) {
+        setpixel(buffer, i, rgb[i], c->codeMap);
+    }
+}
+
+static void test_incremental_encode_matches_full(void)
+{
+    // 29 pixels leave a short trailing group, 512 is a whole panel
+    const uint32_t sizes[] = { 29, TEST_PIXELS };
+    static uint8_t full[TEST_PIXELS * WS2182B_BYTES_PER_PIXEL + WS2812B_RESET_BYTES];
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t pixels = sizes[s];
+        tNpContext* c = (tNpContext*)neopixel_Init(pixels, 0);
+        TEST_ASSERT_NOT_NULL(c);
+        memset(frame, 0, sizeof(frame));
+
+        for (uint32_t round = 0; round < 3000; round++) {
+            // A run of a few pixels, some of them unchanged
+            uint32_t first = rand() % pixels;
+            uint32_t room = pixels - first;
+            uint32_t count = 1 + rand() % ((room < 40) ? room : 40);
+            uint32_t run[40];
+            uint32_t changed = 0;
+            for (uint32_t i = 0; i < count; i++) {
+                run[i] = (rand() % 3 == 0) ? frame[first + i] : random_rgb();
+                changed += (run[i] != frame[first + i]);
+                frame[first + i] = run[i];
+            }
+            TEST_ASSERT_TRUE(neopixel_SetPixel(c, run, first, count));
+            TEST_ASSERT_EQUAL_UINT32(changed, neopixel_GetDirtyCount(c));
+
+            // Whichever buffer goes out next must hold the whole current frame
+            if (changed > 0) {
+                TEST_ASSERT_TRUE(c->ready);
+                encode_all(full, c, frame);
+                TEST_ASSERT_EQUAL_HEX8_ARRAY(full, c->buffer[c->back], c->bufferSize);
+            }
+            if (rand() % 2) {
+                transmit(c);
+            }
+        }
+        neopixel_Deinit(c);
+    }
+}
+
+static void test_unchanged_frame_is_not_sent(void)
+{
+    tNpContext* c = (tNpContext*)neopixel_Init(TEST_PIXELS, 0);
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        frame[i] = random_rgb();
+    }
+    TEST_ASSERT_TRUE(neopixel_SetPixel(c, frame, 0, TEST_PIXELS));
+    TEST_ASSERT_NOT_NULL(transmit(c));
+
+    TEST_ASSERT_TRUE(neopixel_SetPixel(c, frame, 0, TEST_PIXELS));
+    TEST_ASSERT_EQUAL_UINT32(0, neopixel_GetDirtyCount(c));
+    TEST_ASSERT_NULL(transmit(c));
+    neopixel_Deinit(c);
+}
+
+static void test_run_past_the_end_is_cut(void)
+{
+    tNpContext* c = (tNpContext*)neopixel_Init(8, 0);
+    uint32_t run[4] = { 1, 2, 3, 4 };
+    TEST_ASSERT_FALSE(neopixel_SetPixel(c, run, 6, 4));
+    TEST_ASSERT_EQUAL_UINT32(2, neopixel_GetDirtyCount(c));
+    TEST_ASSERT_EQUAL_HEX32(1, c->shadow[6]);
+    TEST_ASSERT_EQUAL_HEX32(2, c->shadow[7]);
+    TEST_ASSERT_FALSE(neopixel_SetPixel(c, run, 8, 1));
+    neopixel_Deinit(c);
+}
+
+static void test_sent_buffer_is_never_written(void)
+{
+    static uint8_t sent[TEST_PIXELS * WS2182B_BYTES_PER_PIXEL + WS2812B_RESET_BYTES];
+    static uint8_t full[TEST_PIXELS * WS2182B_BYTES_PER_PIXEL + WS2812B_RESET_BYTES];
+    tNpContext* c = (tNpContext*)neopixel_Init(TEST_PIXELS, 0);
+    memset(frame, 0, sizeof(frame));
+    const uint8_t* front = NULL;
+
+    for (uint32_t round = 0; round < 3000; round++) {
+        // Writers publish any number of frames while one is on the wire
+        uint32_t writes = rand() % 4;
+        for (uint32_t w = 0; w < writes; w++) {
+            uint32_t index = rand() % TEST_PIXELS;
+            frame[index] = random_rgb();
+            neopixel_SetPixel(c, &frame[index], index, 1);
+            if (front) {
+                TEST_ASSERT_EQUAL_HEX8_ARRAY(sent, front, c->bufferSize);
+            }
+        }
+
+        // The next take gets the latest frame, the ones in between are skipped
+        const uint8_t* taken = transmit(c);
+        if (taken == NULL) {
+            continue; // Nothing published since the last take
+        }
+        TEST_ASSERT_TRUE(taken != front);
+        TEST_ASSERT_TRUE(taken != c->buffer[c->back]);
+        encode_all(full, c, frame);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(full, taken, c->bufferSize);
+        TEST_ASSERT_NULL(transmit(c)); // Nothing new until the next publish
+        front = taken;
+        memcpy(sent, front, c->bufferSize);
+    }
+    neopixel_Deinit(c);
+}
+
+// Driver-style levels: a gamma curve, then brightness out of 256
+static void make_levels(uint8_t* levels, uint32_t bright, bool gamma)
+{
+    for (uint32_t v = 0; v < 256; v++) {
+        uint32_t corrected = gamma ? (v * v + 127) / 255 : v;
+        levels[v] = (uint8_t)((corrected * bright) / 256);
+    }
+}
+
+// Applying the levels to each pixel and encoding that, as before they were folded in
+static uint32_t level_rgb(const uint8_t* levels, uint32_t rgb)
+{
+    return NP_RGB(levels[NP_RGB2RED(rgb)], levels[NP_RGB2GREEN(rgb)], levels[NP_RGB2BLUE(rgb)]);
+}
+
+static void test_level_map_matches_scaled_pixels(void)
+{
+    static uint8_t full[TEST_PIXELS * WS2182B_BYTES_PER_PIXEL + WS2812B_RESET_BYTES];
+    const uint32_t brightness[] = { 0, 1, 77, 128, 200, 255 };
+    tNpContext* c = (tNpContext*)neopixel_Init(TEST_PIXELS, 0);
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        frame[i] = random_rgb();
+    }
+    neopixel_SetPixel(c, frame, 0, TEST_PIXELS);
+
+    uint8_t levels[256];
+    for (uint32_t b = 0; b < sizeof(brightness) / sizeof(brightness[0]); b++) {
+        for (int gamma = 0; gamma < 2; gamma++) {
+            make_levels(levels, brightness[b], gamma);
+            transmit(c);
+            neopixel_SetLevelMap(c, levels);
+            TEST_ASSERT_FALSE(c->ready); // Sent with the next frame, not on its own
+            neopixel_SetPixel(c, frame, 0, TEST_PIXELS);
+            TEST_ASSERT_EQUAL_UINT32(0, neopixel_GetDirtyCount(c));
+            TEST_ASSERT_TRUE(c->ready); // Every pixel is re-encoded and sent
+
+            memset(full, 0, c->bufferSize);
+            for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+                baseline_setpixel(full, i, level_rgb(levels, frame[i]));
+            }
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(full, c->buffer[c->back], c->bufferSize);
+
+            // Pixels written later go through the same levels
+            uint32_t index = rand() % TEST_PIXELS;
+            frame[index] = random_rgb();
+            neopixel_SetPixel(c, &frame[index], index, 1);
+            baseline_setpixel(full, index, level_rgb(levels, frame[index]));
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(full, c->buffer[c->back], c->bufferSize);
+        }
+    }
+
+    // NULL is the identity again
+    transmit(c);
+    neopixel_SetLevelMap(c, NULL);
+    neopixel_SetPixel(c, frame, 0, TEST_PIXELS);
+    encode_all(full, c, frame);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(ws2812b_code_map, c->codeMap, 256);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(full, c->buffer[c->back], c->bufferSize);
+    neopixel_Deinit(c);
+}
+
+static const uint8_t* bench_levels;
+
+static void encode_scaled(void)
+{
+    for (uint32_t i = 0; i < TEST_PIXELS; i += WS2812B_GROUP_PIXELS) {
+        uint32_t scaled[WS2812B_GROUP_PIXELS];
+        for (uint32_t k = 0; k < WS2812B_GROUP_PIXELS; k++) {
+            scaled[k] = level_rgb(bench_levels, frame[i + k]);
+        }
+        encode_group((uint32_t*)&actual[i * WS2182B_BYTES_PER_PIXEL], scaled, ws2812b_code_map);
+    }
+    __asm__ volatile("" : : "r"(actual) : "memory");
+}
+
+static void test_level_map_and_pixels_send_one_frame(void)
+{
+    static uint8_t full[TEST_PIXELS * WS2182B_BYTES_PER_PIXEL + WS2812B_RESET_BYTES];
+    tNpContext* c = (tNpContext*)neopixel_Init(TEST_PIXELS, 0);
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        frame[i] = random_rgb();
+    }
+    neopixel_SetPixel(c, frame, 0, TEST_PIXELS);
+    TEST_ASSERT_NOT_NULL(transmit(c));
+
+    // The driver's order on a brightness change: new levels, then the frame
+    uint8_t levels[256];
+    make_levels(levels, 77, true);
+    neopixel_SetLevelMap(c, levels);
+    TEST_ASSERT_NULL(transmit(c));
+    frame[3] = random_rgb();
+    frame[300] = random_rgb();
+    neopixel_SetPixel(c, frame, 0, TEST_PIXELS);
+
+    // One frame with both the new levels and the new pixels, and nothing after it
+    const uint8_t* taken = transmit(c);
+    TEST_ASSERT_NOT_NULL(taken);
+    memset(full, 0, c->bufferSize);
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        baseline_setpixel(full, i, level_rgb(levels, frame[i]));
+    }
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(full, taken, c->bufferSize);
+    TEST_ASSERT_NULL(transmit(c));
+
+    // Once sent, an unchanged frame sends nothing again
+    neopixel_SetPixel(c, frame, 0, TEST_PIXELS);
+    TEST_ASSERT_NULL(transmit(c));
+    neopixel_Deinit(c);
+}
+
+static void test_benchmark_level_map(void)
+{
+    uint8_t levels[256];
+    make_levels(levels, 128, true);
+    bench_levels = levels;
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        frame[i] = random_rgb();
+    }
+    double scaled = time_per_pixel(encode_scaled);
+    double folded = time_per_pixel(encode_groups); // The levels live in the code map
+
+    // What a brightness change costs: a new code map and a full re-encode
+    tNpContext* c = (tNpContext*)neopixel_Init(TEST_PIXELS, 0);
+    neopixel_SetPixel(c, frame, 0, TEST_PIXELS);
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 200; i++) {
+            make_levels(levels, 64 + (i & 127), true);
+            neopixel_SetLevelMap(c, levels);
+            neopixel_SetPixel(c, frame, 0, TEST_PIXELS);
+            transmit(c);
+        }
+        double us = (double)(esp_timer_get_time() - start) / 200.0;
+        best = (us < best) ? us : best;
+    }
+    neopixel_Deinit(c);
+
+    char message[192];
+    snprintf(message, sizeof(message),
+             "levels per pixel %.2f ns/pixel, folded into the code map %.2f ns/pixel, "
+             "brightness change %.2f us per %d-pixel frame", scaled, folded, best, TEST_PIXELS);
+    TEST_MESSAGE(message);
+}
+
+// Microseconds per neopixel_SetPixel of a whole frame, alternating between two frames
+// that differ in some pixels
+static double time_set_frame(tNpContext* c, uint32_t changes)
+{
+    static uint32_t other[TEST_PIXELS];
+    memcpy(other, frame, sizeof(other));
+    for (uint32_t k = 0; k < changes; k++) {
+        other[(k * 7919) % TEST_PIXELS] ^= 0x010101; // Distinct pixels while changes <= TEST_PIXELS
+    }
+    double best = 1e30;
+    for (int run = 0; run < 5; run++) {
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < 200; i++) {
+            neopixel_SetPixel(c, (i & 1) ? other : frame, 0, TEST_PIXELS);
+            transmit(c);
+        }
+        double us = (double)(esp_timer_get_time() - start) / 200.0;
+        best = (us < best) ? us : best;
+    }
+    return best;
+}
+
+static void test_benchmark_incremental(void)
+{
+    tNpContext* c = (tNpContext*)neopixel_Init(TEST_PIXELS, 0);
+    for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+        frame[i] = random_rgb();
+    }
+    double one = time_set_frame(c, 1);
+    double some = time_set_frame(c, 16);
+    double all = time_set_frame(c, TEST_PIXELS);
+    char message[160];
+    snprintf(message, sizeof(message),
+             "%d-pixel frame: 1 changed %.2f us, 16 changed %.2f us, all changed %.2f us",
+             TEST_PIXELS, one, some, all);
+    TEST_MESSAGE(message);
+    neopixel_Deinit(c);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_color_map_matches_protocol);
+    RUN_TEST(test_encode_group_matches_baseline);
+    RUN_TEST(test_setpixel_matches_baseline);
+    RUN_TEST(test_benchmark_encoders);
+    RUN_TEST(test_incremental_encode_matches_full);
+    RUN_TEST(test_unchanged_frame_is_not_sent);
+    RUN_TEST(test_run_past_the_end_is_cut);
+    RUN_TEST(test_sent_buffer_is_never_written);
+    RUN_TEST(test_benchmark_incremental);
+    RUN_TEST(test_level_map_matches_scaled_pixels);
+    RUN_TEST(test_level_map_and_pixels_send_one_frame);
+    RUN_TEST(test_benchmark_level_map);
+    return UNITY_END();
+}